@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""Generate src/bus_profile.h from the full-drive ID summary.
+
+One entry per 11-bit ID seen on the bus with its average broadcast rate and
+the average bits one of its frames takes on the wire. The CAN filter planner
+uses the rates to weigh which unwanted IDs a hardware acceptance filter would
+let through; the bus-load estimator uses rate x bits for the traffic the
+filter hides from it.
+
+Runs standalone or as a PlatformIO pre: extra script.
+"""
+
+from __future__ import annotations
+
+import argparse
+import csv
+from pathlib import Path
+
+
+# SOF through CRC are bit-stuffed; CRC delimiter, ACK, EOF and intermission are not.
+UNSTUFFED_TAIL_BITS = 1 + 2 + 7 + 3
+
+
+def frame_bits(can_id: int, data: bytes) -> int:
+    """Bits on the wire for a standard data frame, stuff bits counted exactly.
+
+    Same walk as canFrameBits() in src/bus_load.cpp.
+    """
+    bits = [0]
+    bits += [(can_id >> i) & 1 for i in range(10, -1, -1)]
+    bits += [0, 0, 0]  # RTR, IDE, r0
+    bits += [(len(data) >> i) & 1 for i in range(3, -1, -1)]
+    for byte in data:
+        bits += [(byte >> i) & 1 for i in range(7, -1, -1)]
+    crc = 0
+    for b in bits:
+        nxt = b ^ ((crc >> 14) & 1)
+        crc = (crc << 1) & 0x7FFF
+        if nxt:
+            crc ^= 0x4599
+    bits += [(crc >> i) & 1 for i in range(14, -1, -1)]
+    stuffed, last, run = 0, None, 0
+    for b in bits:
+        if b == last:
+            run += 1
+            if run == 5:
+                stuffed += 1
+                last, run = 1 - b, 1
+        else:
+            last, run = b, 1
+    return len(bits) + stuffed + UNSTUFFED_TAIL_BITS
+
+
+def mean_bits(can_id: int, raw: dict) -> int:
+    """Frame-count weighted over the most common DLCs and payloads."""
+    dlcs = [tuple(int(x) for x in part.split(":")) for part in (raw["dlc"] or "8:1").split()]
+    dlc = max(dlcs, key=lambda d: d[1])[0]
+    total = weight = 0
+    for part in (raw["top_payloads"] or "").split(";"):
+        part = part.strip()
+        if " x" not in part:
+            continue
+        payload, count = part.rsplit(" x", 1)
+        data = bytes(int(b, 16) for b in payload.split()[:dlc])
+        total += frame_bits(can_id, data) * int(count)
+        weight += int(count)
+    if weight == 0:
+        return frame_bits(can_id, bytes(dlc))
+    return round(total / weight)
+
+
+def load(path: Path) -> list[tuple[int, int, int]]:
+    entries = []
+    with path.open(newline="") as f:
+        for raw in csv.DictReader(f):
+            can_id = int(raw["id_dec"])
+            mean_us = float(raw["mean_us"] or 0)
+            if can_id > 0x7FF or mean_us <= 0:
+                continue
+            deci_hz = min(0xFFFF, round(10 * 1_000_000 / mean_us))
+            entries.append((can_id, max(1, deci_hz), mean_bits(can_id, raw)))
+    return sorted(entries)
+
+
+def generate(entries: list[tuple[int, int, int]], source: str) -> str:
+    out = [
+        f"// Generated by scripts/gen_bus_profile.py from {source}.",
+        "// Do not edit by hand.",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        "// Average rate of each standard ID on the car's bus, tenths of a Hz, and",
+        "// the average bits one of its frames takes on the wire (stuffing included).",
+        "struct BusProfileEntry {",
+        "    uint16_t id;",
+        "    uint16_t deciHz;",
+        "    uint8_t bits;",
+        "};",
+        "",
+        "constexpr BusProfileEntry busProfile[] = {",
+    ]
+    for can_id, deci_hz, bits in entries:
+        out.append(f"    {{0x{can_id:03X}, {deci_hz}, {bits}}},")
+    out.append("};")
+    out.append("")
+    out.append(f"constexpr uint16_t BUS_PROFILE_COUNT = {len(entries)};")
+    out.append("")
+    return "\n".join(out)
+
+
+def run(project_dir: Path) -> None:
+    repo = project_dir.parent
+    source = repo / "analysis" / "full_drive_1_id_summary.csv"
+    target = project_dir / "src" / "bus_profile.h"
+    text = generate(load(source), source.relative_to(repo).as_posix())
+    if not target.exists() or target.read_text() != text:
+        target.write_text(text)
+        print(f"gen_bus_profile: wrote {target}")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--project-dir", type=Path, default=Path(__file__).resolve().parent.parent)
+    args = parser.parse_args()
+    run(args.project_dir)
+
+
+try:
+    Import("env")  # noqa: F821 - injected by PlatformIO when run as an extra script
+    run(Path(env.subst("$PROJECT_DIR")))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main()
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""Generate src/can_decoders.h from the Toyota DBCs plus our body overlay.
+
+Every selected broadcast message becomes a namespace under dbc:: with its ID,
+DLC and, per signal, a <name>_raw() that returns the integer field and a
+<name>() that applies scale and offset. The bit layout goes into a DbcField
+template (src/dbc_signal.h), so nothing about it is worked out at run time.
+
+Where more than one DBC defines a message, the first source in SOURCES wins:
+our overlay, then the 2010 Prius PT DBC, then the 2017 Toyota reference.
+
+Runs standalone or as a PlatformIO pre: extra script.
+"""
+
+from __future__ import annotations
+
+import argparse
+import re
+from pathlib import Path
+
+
+SOURCES = [
+    "prius_v_2016_body_misc_overlay.dbc",
+    "toyota_prius_2010_pt.dbc",
+    "toyota_2017_ref_pt.dbc",
+]
+
+# Messages the firmware decodes or is about to.
+MESSAGES = [
+    0x024,  # KINEMATICS
+    0x025,  # STEER_ANGLE_SENSOR
+    0x0AA,  # WHEEL_SPEEDS
+    0x0B4,  # SPEED
+    0x127,  # GEAR_PACKET
+    0x1C4,  # POWERTRAIN (engine RPM)
+    0x247,  # energy display bar
+    0x3B0,  # HVAC ACN1S07
+    0x49B,  # drive mode flags
+    0x58E,  # steering wheel buttons
+    0x610,  # dimmer / rheostat
+    0x620,  # ambient light + dim state
+]
+
+BO_RE = re.compile(r"^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+\S+")
+SG_RE = re.compile(
+    r"^\s*SG_\s+(\w+)\s*(\S+)?\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*"
+    r"\(([^,]+),([^)]+)\)\s*\[([^|]+)\|([^\]]+)\]\s*\"([^\"]*)\""
+)
+
+
+class Signal:
+    def __init__(self, m: re.Match) -> None:
+        self.name = m.group(1)
+        self.multiplex = m.group(2)
+        self.start = int(m.group(3))
+        self.length = int(m.group(4))
+        self.motorola = m.group(5) == "0"
+        self.signed = m.group(6) == "-"
+        self.scale = float(m.group(7))
+        self.offset = float(m.group(8))
+        self.min = float(m.group(9))
+        self.max = float(m.group(10))
+        self.unit = m.group(11)
+
+
+class Message:
+    def __init__(self, can_id: int, name: str, dlc: int, source: str) -> None:
+        self.can_id = can_id
+        self.name = name
+        self.dlc = dlc
+        self.source = source
+        self.signals: list[Signal] = []
+
+
+def load_dbc(path: Path) -> dict[int, Message]:
+    messages: dict[int, Message] = {}
+    current: Message | None = None
+    for line in path.read_text(errors="replace").splitlines():
+        bo = BO_RE.match(line)
+        if bo:
+            current = Message(int(bo.group(1)), bo.group(2), int(bo.group(3)), path.name)
+            messages[current.can_id] = current
+            continue
+        sg = SG_RE.match(line)
+        if sg and current is not None:
+            sig = Signal(sg)
+            if sig.multiplex is None and 1 <= sig.length <= 32:
+                current.signals.append(sig)
+            continue
+        if not line.strip():
+            current = None
+    return messages
+
+
+def pick_messages(dbcs: list[dict[int, Message]]) -> list[Message]:
+    picked = []
+    for can_id in MESSAGES:
+        for dbc in dbcs:
+            if can_id in dbc and dbc[can_id].signals:
+                picked.append(dbc[can_id])
+                break
+        else:
+            raise SystemExit(f"gen_can_decoders: no DBC defines 0x{can_id:03X}")
+    return picked
+
+
+def c_float(v: float) -> str:
+    text = repr(float(v))
+    if "e" not in text and "." not in text:
+        text += ".0"
+    return text + "f"
+
+
+def generate(messages: list[Message]) -> str:
+    out = [
+        "// Generated by scripts/gen_can_decoders.py from SavvyCANstuff/" + ", ".join(SOURCES) + ".",
+        "// Do not edit by hand.",
+        "#pragma once",
+        "",
+        '#include "dbc_signal.h"',
+        "",
+        "namespace dbc {",
+        "",
+    ]
+    table = []
+    for msg in messages:
+        ns = msg.name.lower()
+        out.append(f"// 0x{msg.can_id:03X} {msg.name} ({msg.source})")
+        out.append(f"namespace {ns} {{")
+        out.append(f"constexpr uint16_t ID = 0x{msg.can_id:03X};")
+        out.append(f"constexpr uint8_t DLC = {msg.dlc};")
+        for sig in msg.signals:
+            fn = sig.name.lower()
+            field = (f"DbcField<{sig.start}, {sig.length}, {'true' if sig.motorola else 'false'}, "
+                     f"{'true' if sig.signed else 'false'}>")
+            unit = f" {sig.unit}" if sig.unit else ""
+            out.append(f"// {sig.name} {sig.start}|{sig.length}@{0 if sig.motorola else 1}"
+                       f"{'-' if sig.signed else '+'} ({sig.scale:g},{sig.offset:g}){unit}")
+            out.append(f"using {fn}_field = {field};")
+            out.append(f"inline {fn}_field::Raw {fn}_raw(const uint8_t* d) {{ return {fn}_field::raw(d); }}")
+            body = f"(float){fn}_raw(d)" if sig.scale == 1 else f"{fn}_raw(d) * {c_float(sig.scale)}"
+            if sig.offset != 0:
+                body += f" {'-' if sig.offset < 0 else '+'} {c_float(abs(sig.offset))}"
+            out.append(f"inline float {fn}(const uint8_t* d) {{ return {body}; }}")
+            table.append(
+                f"    {{{ns}::ID, \"{msg.name}\", \"{sig.name}\", {sig.start}, {sig.length}, "
+                f"{'true' if sig.motorola else 'false'}, {'true' if sig.signed else 'false'}, "
+                f"{c_float(sig.scale)}, {c_float(sig.offset)}, {c_float(sig.min)}, {c_float(sig.max)}, "
+                f"{ns}::{fn}_field::bits, {ns}::{fn}}},"
+            )
+        out.append(f"}} // namespace {ns}")
+        out.append("")
+    out.append("// Every signal above, for the capture check (src/host/dbc_check.cpp).")
+    out.append("inline constexpr DbcSignalInfo SIGNALS[] = {")
+    out.extend(table)
+    out.append("};")
+    out.append("")
+    out.append("} // namespace dbc")
+    out.append("")
+    return "\n".join(out)
+
+
+def run(project_dir: Path) -> None:
+    repo = project_dir.parent
+    dbcs = [load_dbc(repo / "SavvyCANstuff" / name) for name in SOURCES]
+    target = project_dir / "src" / "can_decoders.h"
+    text = generate(pick_messages(dbcs))
+    if not target.exists() or target.read_text() != text:
+        target.write_text(text)
+        print(f"gen_can_decoders: wrote {target}")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--project-dir", type=Path, default=Path(__file__).resolve().parent.parent)
+    args = parser.parse_args()
+    run(args.project_dir)
+
+
+try:
+    Import("env")  # noqa: F821 - injected by PlatformIO when run as an extra script
+    run(Path(env.subst("$PROJECT_DIR")))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main()
@@ -0,0 +1,388 @@
+#!/usr/bin/env python3
+"""Generate src/pid_catalog.h from the Torque PID CSV plus our local overlay.
+
+Each CSV row becomes one catalog entry with its request (header, service, PID),
+the payload length it needs and a decode function with the equation compiled
+in. Rows that only send a command (no reply) or decode to text are skipped.
+
+Equations that are linear in the reply bytes also get a scaled-integer form:
+an integer raw() over the bytes plus a FixedScale type (src/fixed_point.h)
+with the scale and offset, so the adapter can carry them without floats.
+
+Runs standalone or as a PlatformIO pre: extra script.
+"""
+
+from __future__ import annotations
+
+import argparse
+import csv
+import math
+import re
+from fractions import Fraction
+from pathlib import Path
+
+
+TOKEN_RE = re.compile(r"\{[A-Z]+:\d\}|[A-Z]+|\d+(?:\.\d+)?|[-+*/()]")
+
+
+class Row:
+    def __init__(self, raw: dict[str, str], source: str) -> None:
+        self.name = raw["Name"].strip()
+        self.short = raw["ShortName"].strip()
+        self.mode_pid = raw["ModeAndPID"].strip().upper()
+        self.equation = raw["Equation"].strip()
+        self.units = raw["Units"].strip()
+        self.header = int(raw["Header"].strip(), 16)
+        self.source = source
+
+    @property
+    def service(self) -> int:
+        return int(self.mode_pid[:2], 16)
+
+    @property
+    def pid(self) -> int:
+        return int(self.mode_pid[2:4], 16)
+
+
+def letter_index(var: str) -> int | None:
+    """Torque names reply bytes A..Z then AA..AZ. Longer runs are text fields."""
+    if len(var) == 1:
+        return ord(var) - ord("A")
+    if len(var) == 2 and var[0] == "A":
+        return 26 + ord(var[1]) - ord("A")
+    return None
+
+
+def compile_equation(equation: str) -> tuple[str, int] | None:
+    """Return (C++ expression over p[], highest payload index used) or None."""
+    out: list[str] = []
+    max_index = 0
+    pos = 0
+    for match in TOKEN_RE.finditer(equation):
+        if equation[pos:match.start()].strip():
+            return None
+        pos = match.end()
+        tok = match.group(0)
+        if tok.startswith("{"):
+            var, bit = tok[1:-1].split(":")
+            idx = letter_index(var)
+            if idx is None:
+                return None
+            out.append(f"((p[{idx + 2}] >> {bit}) & 1)")
+            max_index = max(max_index, idx + 2)
+        elif tok[0].isalpha():
+            idx = letter_index(tok)
+            if idx is None:
+                return None
+            out.append(f"p[{idx + 2}]")
+            max_index = max(max_index, idx + 2)
+        elif tok[0].isdigit():
+            out.append(f"{float(tok)!r}f")
+        else:
+            out.append(tok)
+    if equation[pos:].strip() or not out:
+        return None
+    expr = " ".join(out).replace("( ", "(").replace(" )", ")")
+    return expr, max_index
+
+
+class Linear:
+    """sum(coef * term) + const, terms being C expressions for a byte or a bit."""
+
+    def __init__(self, terms: dict[str, Fraction] | None = None, const: Fraction = Fraction(0)) -> None:
+        self.terms = {k: v for k, v in (terms or {}).items() if v != 0}
+        self.const = const
+
+    def scaled(self, k: Fraction) -> "Linear":
+        return Linear({t: c * k for t, c in self.terms.items()}, self.const * k)
+
+    def plus(self, other: "Linear", sign: int = 1) -> "Linear":
+        terms = dict(self.terms)
+        for t, c in other.terms.items():
+            terms[t] = terms.get(t, Fraction(0)) + sign * c
+        return Linear(terms, self.const + sign * other.const)
+
+
+class NotLinear(Exception):
+    pass
+
+
+def linearize(equation: str) -> Linear | None:
+    """Parse a Torque equation into a Linear, or None if it isn't one."""
+    toks = [m.group(0) for m in TOKEN_RE.finditer(equation)]
+    pos = 0
+
+    def peek() -> str | None:
+        return toks[pos] if pos < len(toks) else None
+
+    def take() -> str:
+        nonlocal pos
+        pos += 1
+        return toks[pos - 1]
+
+    def atom() -> Linear:
+        tok = take()
+        if tok == "(":
+            inner = expr()
+            if take() != ")":
+                raise NotLinear
+            return inner
+        if tok == "-":
+            return atom().scaled(Fraction(-1))
+        if tok.startswith("{"):
+            var, bit = tok[1:-1].split(":")
+            idx = letter_index(var)
+            if idx is None:
+                raise NotLinear
+            return Linear({f"((p[{idx + 2}] >> {bit}) & 1)": Fraction(1)})
+        if tok[0].isalpha():
+            idx = letter_index(tok)
+            if idx is None:
+                raise NotLinear
+            return Linear({f"p[{idx + 2}]": Fraction(1)})
+        if tok[0].isdigit():
+            return Linear(const=Fraction(tok))
+        raise NotLinear
+
+    def term() -> Linear:
+        left = atom()
+        while peek() in ("*", "/"):
+            op = take()
+            right = atom()
+            if op == "*":
+                if not right.terms:
+                    left = left.scaled(right.const)
+                elif not left.terms:
+                    left = right.scaled(left.const)
+                else:
+                    raise NotLinear
+            else:
+                if right.terms or right.const == 0:
+                    raise NotLinear
+                left = left.scaled(1 / right.const)
+        return left
+
+    def expr() -> Linear:
+        left = term()
+        while peek() in ("+", "-"):
+            op = take()
+            left = left.plus(term(), 1 if op == "+" else -1)
+        return left
+
+    try:
+        result = expr()
+    except (NotLinear, IndexError):
+        return None
+    if pos != len(toks) or not result.terms:
+        return None
+    return result
+
+
+INT32_MAX = 2**31 - 1
+REP_TYPES = [("uint8_t", 0, 255), ("int8_t", -128, 127), ("uint16_t", 0, 65535),
+             ("int16_t", -32768, 32767), ("int32_t", -2**31, INT32_MAX)]
+
+
+def fixed_form(lin: Linear) -> tuple[str, str, tuple[int, int, int, int]] | None:
+    """(C++ raw expression, raw type, (num, den, ofs_num, ofs_den)) or None.
+
+    The scale is the largest rational that leaves every byte coefficient an
+    integer. An offset that is a whole number of raw steps is folded into raw.
+    """
+    coefs = list(lin.terms.values())
+    num = 0
+    den = 1
+    for c in coefs:
+        num = math.gcd(num, abs(c.numerator))
+        den = den * c.denominator // math.gcd(den, c.denominator)
+    scale = Fraction(num, den)
+    ints = {t: int(c / scale) for t, c in lin.terms.items()}
+
+    offset = lin.const
+    folded = 0
+    if (offset / scale).denominator == 1:
+        folded = int(offset / scale)
+        offset = Fraction(0)
+
+    lo = folded + sum(min(0, k * (1 if "&" in t else 255)) for t, k in ints.items())
+    hi = folded + sum(max(0, k * (1 if "&" in t else 255)) for t, k in ints.items())
+    rep = next((name for name, rlo, rhi in REP_TYPES if rlo <= lo and hi <= rhi), None)
+    if rep is None:
+        return None
+    values = (scale.numerator, scale.denominator, offset.numerator, offset.denominator)
+    if any(abs(v) > INT32_MAX for v in values):
+        return None
+
+    parts = []
+    for t in sorted(ints, key=lambda t: int(re.search(r"p\[(\d+)\]", t).group(1))):
+        k = ints[t]
+        mag = t if abs(k) == 1 else f"{abs(k)} * {t}"
+        parts.append(("- " if k < 0 else "+ ") + mag if parts else ("-" if k < 0 else "") + mag)
+    if folded:
+        parts.append(f"{'-' if folded < 0 else '+'} {abs(folded)}")
+    return " ".join(parts), rep, values
+
+
+def ident(text: str) -> str:
+    return re.sub(r"_+", "_", re.sub(r"[^A-Z0-9]", "_", text.upper())).strip("_")
+
+
+def load_rows(paths: list[Path]) -> list[Row]:
+    rows: dict[tuple[int, str, str], Row] = {}
+    for path in paths:
+        with path.open(newline="", encoding="utf-8", errors="replace") as fh:
+            for raw in csv.DictReader(fh):
+                row = Row(raw, path.name)
+                # Later files (the overlay) replace rows with the same key.
+                rows[(row.header, row.mode_pid, row.short)] = row
+    return list(rows.values())
+
+
+def generate(rows: list[Row]) -> str:
+    entries = []
+    requests: dict[tuple[int, int, int], int] = {}
+    seen_names: set[str] = set()
+
+    for row in rows:
+        if len(row.mode_pid) != 4 or row.service not in (0x01, 0x21):
+            continue  # actuator commands, no reply to decode
+        compiled = compile_equation(row.equation)
+        if compiled is None:
+            continue  # ASCII fields (model code etc.)
+        expr, max_index = compiled
+
+        name = f"PID_{row.header:03X}_{row.mode_pid}_{ident(row.short)}"
+        while name in seen_names:
+            name += "_X"
+        seen_names.add(name)
+
+        key = (row.header, row.service, row.pid)
+        requests[key] = max(requests.get(key, 0), max_index + 1)
+        lin = linearize(row.equation)
+        fixed = fixed_form(lin) if lin is not None else None
+        entries.append((name, key, expr, row, fixed))
+
+    req_keys = sorted(requests)
+    req_names = {key: f"PIDREQ_{key[0]:03X}_{key[1]:02X}{key[2]:02X}" for key in req_keys}
+
+    out = []
+    out.append("// Generated by scripts/gen_pid_catalog.py from the Torque CSV and")
+    out.append("// SavvyCANstuff/prius_v_2016_pid_overlay.csv. Do not edit by hand.")
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append('#include "fixed_point.h"')
+    out.append("")
+    out.append("// One diagnostic request. Replies come back on requestId + 8 and must echo")
+    out.append("// (service | 0x40, pid). minLen counts the two echo bytes.")
+    out.append("struct PidRequest {")
+    out.append("    uint32_t requestId;")
+    out.append("    uint32_t responseId;")
+    out.append("    uint8_t service;")
+    out.append("    uint8_t pid;")
+    out.append("    uint8_t minLen;")
+    out.append("};")
+    out.append("")
+    out.append("// One decoded value. decode() takes the full reply payload, A is p[2].")
+    out.append("// Linear equations also have decodeRaw(), the integer the value is carried")
+    out.append("// in, with decode(p) == raw * scale + offset; the rest have nullptr.")
+    out.append("struct PidDef {")
+    out.append("    uint8_t request;")
+    out.append("    float (*decode)(const uint8_t* p);")
+    out.append("    const char* shortName;")
+    out.append("    const char* units;")
+    out.append("    int32_t (*decodeRaw)(const uint8_t* p);")
+    out.append("    FixedScaleInfo scale;")
+    out.append("};")
+    out.append("")
+    out.append("enum : uint8_t {")
+    for key in req_keys:
+        out.append(f"    {req_names[key]},")
+    out.append("    PID_REQUEST_COUNT")
+    out.append("};")
+    out.append("")
+    out.append("enum : uint16_t {")
+    for name, _, _, _, _ in entries:
+        out.append(f"    {name},")
+    out.append("    PID_CATALOG_COUNT")
+    out.append("};")
+    out.append("")
+    out.append("namespace pid_decode {")
+    for name, _, expr, row, _ in entries:
+        out.append(f"// {row.name}: {row.equation} [{row.units}]")
+        out.append(f"inline float {name.lower()}(const uint8_t* p) {{ return (float)({expr}); }}")
+    out.append("} // namespace pid_decode")
+    out.append("")
+    out.append("// Scaled-integer forms of the linear equations above.")
+    out.append("namespace pid_fixed {")
+    for name, _, _, _, fixed in entries:
+        if fixed is None:
+            continue
+        raw_expr, rep, (num, den, ofs_num, ofs_den) = fixed
+        args = f"{rep}, {num}, {den}" + (f", {ofs_num}, {ofs_den}" if ofs_num else "")
+        out.append(f"namespace {name.lower()} {{")
+        out.append(f"using scale = FixedScale<{args}>;")
+        out.append(f"inline int32_t raw(const uint8_t* p) {{ return {raw_expr}; }}")
+        out.append("}")
+    out.append("} // namespace pid_fixed")
+    out.append("")
+    out.append("// The same by catalog index, for code that knows the PID at compile time:")
+    out.append("// PidFixed<PID>::raw(p) inlines to the byte arithmetic where")
+    out.append("// pidCatalog[PID].decodeRaw(p) is a call through the table.")
+    out.append("template <uint16_t PID>")
+    out.append("struct PidFixed;")
+    for name, _, _, _, fixed in entries:
+        if fixed is not None:
+            ns = f"pid_fixed::{name.lower()}"
+            out.append(f"template <> struct PidFixed<{name}> {{")
+            out.append(f"    using scale = {ns}::scale;")
+            out.append(f"    static int32_t raw(const uint8_t* p) {{ return {ns}::raw(p); }}")
+            out.append("};")
+    out.append("")
+    out.append("constexpr PidRequest pidRequests[PID_REQUEST_COUNT] = {")
+    for key in req_keys:
+        header, service, pid = key
+        out.append(f"    {{0x{header:03X}, 0x{header + 8:03X}, 0x{service:02X}, 0x{pid:02X}, {requests[key]}}},")
+    out.append("};")
+    out.append("")
+    out.append("constexpr PidDef pidCatalog[PID_CATALOG_COUNT] = {")
+    for name, key, _, row, fixed in entries:
+        short = row.short.replace('"', "'")
+        units = row.units.replace('"', "'").encode("ascii", "replace").decode()
+        if fixed is None:
+            raw = "nullptr, {1, 1, 0, 1}"
+        else:
+            raw = f"pid_fixed::{name.lower()}::raw, pid_fixed::{name.lower()}::scale::info()"
+        out.append(f"    {{{req_names[key]}, pid_decode::{name.lower()}, \"{short}\", \"{units}\", {raw}}},")
+    out.append("};")
+    out.append("")
+    return "\n".join(out)
+
+
+def run(project_dir: Path) -> None:
+    repo = project_dir.parent
+    sources = [
+        repo / "SavvyCANstuff" / "GenIII Prius 4-24-12 (US).csv",
+        repo / "SavvyCANstuff" / "prius_v_2016_pid_overlay.csv",
+    ]
+    target = project_dir / "src" / "pid_catalog.h"
+    text = generate(load_rows(sources))
+    if not target.exists() or target.read_text() != text:
+        target.write_text(text)
+        print(f"gen_pid_catalog: wrote {target}")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--project-dir", type=Path, default=Path(__file__).resolve().parent.parent)
+    args = parser.parse_args()
+    run(args.project_dir)
+
+
+try:
+    Import("env")  # noqa: F821 - injected by PlatformIO when run as an extra script
+    run(Path(env.subst("$PROJECT_DIR")))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main()
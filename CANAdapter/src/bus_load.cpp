@@ -0,0 +1,346 @@
+#include "bus_load.h"
+
+#include <atomic>
+
+namespace {
+
+constexpr uint8_t RING = BUS_LOAD_BUCKETS + 1;  // closed buckets plus the one filling
+constexpr uint32_t BUCKET_CAPACITY = BUS_LOAD_BITRATE / (1000000 / BUS_LOAD_BUCKET_US);
+constexpr uint32_t WINDOW_CAPACITY = BUCKET_CAPACITY * BUS_LOAD_BUCKETS;
+constexpr uint8_t UNSTUFFED_TAIL_BITS = 1 + 2 + 7 + 3;  // CRC delimiter, ACK, EOF, intermission
+constexpr uint16_t CRC15_POLY = 0x4599;
+constexpr uint16_t SCALE_STEP = 50;
+constexpr uint8_t BUSY_HOLD = 2;                 // buckets between halvings
+constexpr uint8_t CAP_HOLD = BUS_LOAD_BUCKETS;   // let the window see a cut before the next step
+constexpr uint16_t EMPTY_ID = 0xFFFF;
+constexpr uint8_t OTHER = BUS_LOAD_MAX_IDS;      // pooled slot past the table
+
+constexpr uint8_t FLAG_TX = 1;
+constexpr uint8_t FLAG_INDUCED = 2;
+
+struct IdSlot {
+    uint16_t id;
+    uint8_t flags;
+    uint32_t frames;
+    uint16_t bits[RING];
+};
+
+struct Bucket {
+    uint32_t rxBits;       // everything the RX task saw, induced included
+    uint32_t inducedBits;
+    uint32_t txBits;
+    uint32_t unseenBits;
+};
+
+// Shared by the RX and TX tasks and loop().
+portMUX_TYPE loadMux = portMUX_INITIALIZER_UNLOCKED;
+IdSlot slots[BUS_LOAD_MAX_IDS + 1];
+Bucket buckets[RING] = {};
+uint8_t cur = 0;
+uint32_t bucketStartUs = 0;
+bool started = false;
+uint8_t closedPending = 0;    // buckets closed since busLoadService last looked
+uint32_t unseenBitsPerSec = 0;
+
+std::atomic<uint16_t> txScale{1000};
+
+// loop() only.
+uint8_t busyHold = 0;
+uint8_t capHold = 0;
+uint32_t busyBackoffs = 0;
+uint32_t capBackoffs = 0;
+
+struct WireBits {
+    uint8_t count;
+    uint8_t stuffed;
+    uint8_t last;
+    uint8_t run;
+    uint16_t crc;
+
+    void stuff(uint8_t b) {
+        count++;
+        if (b == last) {
+            if (++run == 5) {
+                stuffed++;
+                last = (uint8_t)!b;
+                run = 1;
+            }
+        } else {
+            last = b;
+            run = 1;
+        }
+    }
+
+    void put(uint32_t v, uint8_t n) {
+        while (n--) {
+            const uint8_t b = (v >> n) & 1;
+            const bool flip = b ^ ((crc >> 14) & 1);
+            crc = (uint16_t)((crc << 1) & 0x7FFF);
+            if (flip) crc ^= CRC15_POLY;
+            stuff(b);
+        }
+    }
+};
+
+// Starts the bucket after cur. Called with loadMux held.
+void openNext() {
+    cur = (uint8_t)((cur + 1) % RING);
+    buckets[cur] = {};
+    buckets[cur].unseenBits = unseenBitsPerSec / (1000000 / BUS_LOAD_BUCKET_US);
+    for (IdSlot& s : slots) s.bits[cur] = 0;
+}
+
+// Rolls the buckets forward to nowUs. Called with loadMux held.
+void advance(uint32_t nowUs) {
+    if (!started) {
+        for (IdSlot& s : slots) s = {EMPTY_ID, 0, 0, {}};
+        slots[OTHER].id = 0;
+        bucketStartUs = nowUs;
+        started = true;
+        return;
+    }
+    uint8_t rolled = 0;
+    while ((int32_t)(nowUs - bucketStartUs) >= (int32_t)BUS_LOAD_BUCKET_US) {
+        if (rolled == RING) {  // away for longer than the window
+            bucketStartUs = nowUs;
+            break;
+        }
+        openNext();
+        bucketStartUs += BUS_LOAD_BUCKET_US;
+        rolled++;
+        if (closedPending < RING) closedPending++;
+    }
+}
+
+IdSlot& slotFor(uint16_t id) {
+    uint8_t i = (uint8_t)(id % BUS_LOAD_MAX_IDS);
+    for (uint8_t n = 0; n < BUS_LOAD_MAX_IDS; n++) {
+        IdSlot& s = slots[i];
+        if (s.id == id) return s;
+        if (s.id == EMPTY_ID) {
+            s.id = id;
+            return s;
+        }
+        i = (uint8_t)((i + 1) % BUS_LOAD_MAX_IDS);
+    }
+    return slots[OTHER];
+}
+
+inline uint16_t addSat(uint16_t a, uint32_t b) {
+    const uint32_t sum = a + b;
+    return sum > UINT16_MAX ? UINT16_MAX : (uint16_t)sum;
+}
+
+void record(const CanDriverFrame& frame, uint32_t us, bool tx) {
+    const uint8_t bits = canFrameBits(frame);
+    portENTER_CRITICAL(&loadMux);
+    advance(us);
+    IdSlot& s = frame.extended ? slots[OTHER] : slotFor((uint16_t)frame.id);
+    s.frames++;
+    s.bits[cur] = addSat(s.bits[cur], bits);
+    Bucket& b = buckets[cur];
+    if (tx) {
+        s.flags |= FLAG_TX;
+        b.txBits += bits;
+    } else {
+        b.rxBits += bits;
+        if (s.flags & FLAG_INDUCED) b.inducedBits += bits;
+    }
+    portEXIT_CRITICAL(&loadMux);
+}
+
+// Window sums over the closed buckets. Called with loadMux held.
+Bucket windowSum(uint32_t& peakBits) {
+    Bucket w = {};
+    peakBits = 0;
+    for (uint8_t i = 0; i < RING; i++) {
+        if (i == cur) continue;
+        const Bucket& b = buckets[i];
+        w.rxBits += b.rxBits;
+        w.inducedBits += b.inducedBits;
+        w.txBits += b.txBits;
+        w.unseenBits += b.unseenBits;
+        const uint32_t total = b.rxBits + b.txBits + b.unseenBits;
+        if (total > peakBits) peakBits = total;
+    }
+    return w;
+}
+
+inline uint16_t perMille(uint64_t part, uint32_t whole) {
+    if (whole == 0) return 0;
+    const uint64_t pm = part * 1000 / whole;
+    return pm > UINT16_MAX ? UINT16_MAX : (uint16_t)pm;
+}
+
+// One closed bucket's worth of scale adjustment.
+// The car's peaks win over everything: they halve the scale even while an
+// earlier cut for our own share is still settling, and hold off the climb back.
+void adjust(const Bucket& last, const Bucket& window) {
+    if (busyHold) busyHold--;
+    if (capHold) capHold--;
+    uint16_t scale = txScale.load(std::memory_order_relaxed);
+    const uint32_t carBits = last.rxBits - last.inducedBits + last.unseenBits;
+    const bool busy = perMille(carBits, BUCKET_CAPACITY) >= BUS_LOAD_BUSY_PERMILLE;
+    const uint16_t ours = perMille((uint64_t)window.txBits + window.inducedBits, WINDOW_CAPACITY);
+    if (busy) {
+        if (busyHold) return;
+        scale /= 2;
+        busyHold = BUSY_HOLD;
+        busyBackoffs++;
+    } else if (capHold) {
+        return;
+    } else if (ours > BUS_LOAD_OUR_CAP_PERMILLE) {
+        scale = (uint16_t)((uint32_t)scale * BUS_LOAD_OUR_CAP_PERMILLE / ours);
+        capHold = CAP_HOLD;
+        capBackoffs++;
+    } else {
+        scale = scale + SCALE_STEP > 1000 ? 1000 : scale + SCALE_STEP;
+    }
+    if (scale < BUS_LOAD_MIN_SCALE) scale = BUS_LOAD_MIN_SCALE;
+    txScale.store(scale, std::memory_order_relaxed);
+}
+
+} // namespace
+
+uint8_t canFrameBits(const CanDriverFrame& frame) {
+    WireBits w = {0, 0, 2, 0, 0};
+    const uint8_t dlc = frame.length > 8 ? 8 : frame.length;
+    w.put(0, 1);  // SOF
+    if (frame.extended) {
+        w.put(frame.id >> 18, 11);
+        w.put(3, 2);  // SRR, IDE
+        w.put(frame.id, 18);
+        w.put(frame.rtr ? 1 : 0, 1);
+        w.put(0, 2);  // r1, r0
+    } else {
+        w.put(frame.id, 11);
+        w.put(frame.rtr ? 1 : 0, 1);
+        w.put(0, 2);  // IDE, r0
+    }
+    w.put(frame.length, 4);
+    if (!frame.rtr) {
+        for (uint8_t i = 0; i < dlc; i++) w.put(frame.data[i], 8);
+    }
+    const uint16_t crc = w.crc;
+    for (uint8_t n = 15; n--;) w.stuff((crc >> n) & 1);
+    return (uint8_t)(w.count + w.stuffed + UNSTUFFED_TAIL_BITS);
+}
+
+void busLoadOnRx(const CanDriverFrame& frame) {
+    record(frame, frame.us, false);
+}
+
+void busLoadOnTx(const CanDriverFrame& frame, uint32_t us) {
+    record(frame, us, true);
+}
+
+void busLoadMarkInduced(uint16_t id) {
+    portENTER_CRITICAL(&loadMux);
+    advance((uint32_t)esp_timer_get_time());
+    slotFor(id).flags |= FLAG_INDUCED;
+    portEXIT_CRITICAL(&loadMux);
+}
+
+void busLoadSetUnseen(uint32_t bitsPerSec) {
+    portENTER_CRITICAL(&loadMux);
+    unseenBitsPerSec = bitsPerSec;
+    portEXIT_CRITICAL(&loadMux);
+}
+
+bool busLoadService(uint32_t nowUs) {
+    Bucket last = {};
+    Bucket window = {};
+    uint8_t closed = 0;
+    portENTER_CRITICAL(&loadMux);
+    advance(nowUs);
+    closed = closedPending;
+    closedPending = 0;
+    if (closed) {
+        uint32_t peak;
+        last = buckets[(cur + RING - 1) % RING];
+        window = windowSum(peak);
+    }
+    portEXIT_CRITICAL(&loadMux);
+
+    // Several at once only when loop() stalled; the newest speaks for them.
+    if (closed) adjust(last, window);
+    return closed != 0;
+}
+
+uint16_t busLoadTxScale() {
+    return txScale.load(std::memory_order_relaxed);
+}
+
+BusLoadStats busLoadStats() {
+    BusLoadStats s = {};
+    uint32_t peak = 0;
+    portENTER_CRITICAL(&loadMux);
+    const Bucket w = windowSum(peak);
+    portEXIT_CRITICAL(&loadMux);
+
+    const uint32_t total = w.rxBits + w.txBits + w.unseenBits;
+    const uint32_t ours = w.txBits + w.inducedBits;
+    s.loadPerMille = perMille(total, WINDOW_CAPACITY);
+    s.peakPerMille = perMille(peak, BUCKET_CAPACITY);
+    s.carPerMille = perMille(total - ours, WINDOW_CAPACITY);
+    s.ourPerMille = perMille(ours, WINDOW_CAPACITY);
+    s.ourSharePerMille = perMille(ours, total);
+    s.unseenPerMille = perMille(w.unseenBits, WINDOW_CAPACITY);
+    s.txScale = busLoadTxScale();
+    s.busyBackoffs = busyBackoffs;
+    s.capBackoffs = capBackoffs;
+    return s;
+}
+
+void busLoadPrint() {
+    const BusLoadStats s = busLoadStats();
+    Serial.printf("Bus load %u.%u%% (peak 100ms %u.%u%%): car %u.%u%% (%u.%u%% unseen, from profile), "
+                  "ours %u.%u%% = %u.%u%% of traffic\n",
+                  s.loadPerMille / 10, s.loadPerMille % 10, s.peakPerMille / 10, s.peakPerMille % 10,
+                  s.carPerMille / 10, s.carPerMille % 10, s.unseenPerMille / 10, s.unseenPerMille % 10,
+                  s.ourPerMille / 10, s.ourPerMille % 10, s.ourSharePerMille / 10, s.ourSharePerMille % 10);
+    Serial.printf("  tx scale %u/1000, backoffs: busy %lu, our cap %lu\n", s.txScale,
+                  (unsigned long)s.busyBackoffs, (unsigned long)s.capBackoffs);
+
+    // Per ID over the window, busiest first.
+    struct Row {
+        bool other;
+        uint16_t id;
+        uint8_t flags;
+        uint32_t frames;
+        uint32_t bits;
+    };
+    Row rows[BUS_LOAD_MAX_IDS + 1];
+    uint8_t count = 0;
+    portENTER_CRITICAL(&loadMux);
+    for (uint8_t i = 0; i <= BUS_LOAD_MAX_IDS; i++) {
+        const IdSlot& slot = slots[i];
+        if (slot.frames == 0) continue;
+        Row r = {i == OTHER, slot.id, slot.flags, slot.frames, 0};
+        for (uint8_t b = 0; b < RING; b++) {
+            if (b != cur) r.bits += slot.bits[b];
+        }
+        rows[count++] = r;
+    }
+    portEXIT_CRITICAL(&loadMux);
+    for (uint8_t i = 1; i < count; i++) {
+        const Row r = rows[i];
+        uint8_t j = i;
+        for (; j > 0 && rows[j - 1].bits < r.bits; j--) rows[j] = rows[j - 1];
+        rows[j] = r;
+    }
+    Serial.println("  id      frames   bit/s  permille");
+    for (uint8_t i = 0; i < count; i++) {
+        const Row& r = rows[i];
+        char name[8];
+        if (r.other) {
+            snprintf(name, sizeof(name), "other");
+        } else {
+            snprintf(name, sizeof(name), "%03X", r.id);
+        }
+        Serial.printf("  %-5s %8lu %7lu %5u %s\n", name, (unsigned long)r.frames,
+                      (unsigned long)(r.bits * 1000000ULL / (BUS_LOAD_BUCKETS * BUS_LOAD_BUCKET_US)),
+                      perMille(r.bits, WINDOW_CAPACITY),
+                      r.flags & FLAG_TX ? "tx" : r.flags & FLAG_INDUCED ? "reply" : "");
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "can_driver.h"
+#include "fixed_point.h"
+
+// How busy the bus is and how much of that is us. Every frame the RX task
+// takes from the driver and every frame the TX task gets onto the bus is
+// costed in bits on the wire (header, DLC, data, CRC and the stuff bits they
+// actually need, plus the unstuffed tail), per ID and in total, into 100 ms
+// buckets over a sliding one second window. Traffic the acceptance filter
+// hides from us comes from the recorded bus profile instead (rate x average
+// frame bits), so it is there in the total but doesn't move with the car.
+//
+// "Ours" is what we send plus the replies it provokes (IDs marked induced:
+// the diag response IDs), so a fast poll counts for both of its frames.
+//
+// At the end of each bucket the TX scale (per mille of each throttled class's
+// normal rate) is adjusted: halved while the car's own traffic is above
+// BUS_LOAD_BUSY_PERMILLE, cut in proportion while our part of the bus is
+// above BUS_LOAD_OUR_CAP_PERMILLE, otherwise raised a step at a time back to
+// 1000. can_tx scales its PID and keepalive token rates by it and the poll
+// scheduler stretches its periods by it.
+//
+// Fixed memory: BUS_LOAD_MAX_IDS per-ID slots, anything past that is pooled
+// as "other". Recording is safe from the RX and TX tasks at once; everything
+// else is for loop().
+
+constexpr uint32_t BUS_LOAD_BITRATE = 500000;
+constexpr uint8_t BUS_LOAD_BUCKETS = 10;
+constexpr uint32_t BUS_LOAD_BUCKET_US = 100000;
+constexpr uint8_t BUS_LOAD_MAX_IDS = 48;
+constexpr uint16_t BUS_LOAD_BUSY_PERMILLE = 500;     // car's traffic, any one bucket
+constexpr uint16_t BUS_LOAD_OUR_CAP_PERMILLE = 100;  // ours, over the window
+constexpr uint16_t BUS_LOAD_MIN_SCALE = 125;         // never throttle below 1/8
+
+using BusLoadPercent = FixedScale<uint16_t, 1, 10>;  // the per mille figures below
+
+struct BusLoadStats {
+    uint16_t loadPerMille;      // whole bus, last second
+    uint16_t peakPerMille;      // busiest bucket in that second
+    uint16_t carPerMille;       // everything that isn't ours, last second
+    uint16_t ourPerMille;       // ours, last second, as a part of the bus
+    uint16_t ourSharePerMille;  // ours as a part of the traffic
+    uint16_t unseenPerMille;    // modelled from the profile, in loadPerMille
+    uint16_t txScale;           // per mille, see above
+    uint32_t busyBackoffs;      // buckets that halved the scale
+    uint32_t capBackoffs;       // buckets that cut it for our own share
+};
+
+// Exact bits on the wire for one data or remote frame.
+uint8_t canFrameBits(const CanDriverFrame& frame);
+
+void busLoadOnRx(const CanDriverFrame& frame);              // RX task, frame.us
+void busLoadOnTx(const CanDriverFrame& frame, uint32_t us); // TX task, once on the bus
+void busLoadMarkInduced(uint16_t id);                       // replies to our requests
+void busLoadSetUnseen(uint32_t bitsPerSec);                 // from the filter plan
+
+// Closes finished buckets and moves the TX scale. True if one closed.
+bool busLoadService(uint32_t nowUs);
+
+uint16_t busLoadTxScale();  // any task
+BusLoadStats busLoadStats();
+void busLoadPrint();
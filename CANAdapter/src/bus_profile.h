@@ -0,0 +1,133 @@
+// Generated by scripts/gen_bus_profile.py from analysis/full_drive_1_id_summary.csv.
+// Do not edit by hand.
+#pragma once
+
+#include <stdint.h>
+
+// Average rate of each standard ID on the car's bus, tenths of a Hz, and
+// the average bits one of its frames takes on the wire (stuffing included).
+struct BusProfileEntry {
+    uint16_t id;
+    uint16_t deciHz;
+    uint8_t bits;
+};
+
+constexpr BusProfileEntry busProfile[] = {
+    {0x020, 823, 114},
+    {0x024, 823, 120},
+    {0x025, 823, 119},
+    {0x0AA, 823, 112},
+    {0x0B4, 411, 123},
+    {0x0B6, 206, 85},
+    {0x127, 610, 119},
+    {0x1AA, 206, 105},
+    {0x1C4, 425, 124},
+    {0x224, 411, 125},
+    {0x230, 411, 111},
+    {0x232, 411, 85},
+    {0x235, 411, 104},
+    {0x245, 424, 93},
+    {0x247, 424, 92},
+    {0x260, 495, 123},
+    {0x262, 247, 92},
+    {0x320, 206, 121},
+    {0x32A, 206, 66},
+    {0x351, 165, 86},
+    {0x361, 155, 121},
+    {0x381, 2, 125},
+    {0x382, 2, 66},
+    {0x383, 5, 125},
+    {0x384, 3, 105},
+    {0x386, 3, 104},
+    {0x387, 10, 123},
+    {0x389, 10, 123},
+    {0x38B, 10, 115},
+    {0x38E, 10, 124},
+    {0x38F, 10, 123},
+    {0x394, 33, 57},
+    {0x399, 10, 114},
+    {0x39B, 10, 96},
+    {0x3A5, 11, 124},
+    {0x3B0, 10, 101},
+    {0x3B1, 10, 122},
+    {0x3B3, 20, 76},
+    {0x3B6, 10, 122},
+    {0x3B7, 33, 123},
+    {0x3B9, 10, 76},
+    {0x3BB, 10, 86},
+    {0x3BC, 10, 124},
+    {0x3BD, 10, 57},
+    {0x3D3, 19, 67},
+    {0x3E0, 10, 124},
+    {0x3E6, 3, 98},
+    {0x3E7, 3, 115},
+    {0x3E8, 3, 127},
+    {0x3E9, 3, 125},
+    {0x3F9, 40, 118},
+    {0x3FA, 33, 58},
+    {0x413, 10, 122},
+    {0x420, 10, 121},
+    {0x421, 10, 124},
+    {0x423, 10, 57},
+    {0x42F, 10, 124},
+    {0x434, 10, 123},
+    {0x435, 10, 118},
+    {0x436, 10, 124},
+    {0x437, 10, 124},
+    {0x440, 17, 124},
+    {0x442, 17, 121},
+    {0x443, 17, 120},
+    {0x44D, 17, 121},
+    {0x45C, 17, 122},
+    {0x45F, 17, 122},
+    {0x498, 20, 121},
+    {0x499, 20, 121},
+    {0x49A, 20, 118},
+    {0x49B, 20, 120},
+    {0x49C, 20, 121},
+    {0x49D, 20, 117},
+    {0x49E, 20, 119},
+    {0x49F, 20, 123},
+    {0x4A0, 20, 121},
+    {0x4A1, 20, 117},
+    {0x4A2, 20, 118},
+    {0x4A6, 12, 115},
+    {0x4A7, 20, 120},
+    {0x4A8, 20, 124},
+    {0x4C1, 11, 126},
+    {0x4C3, 11, 123},
+    {0x4C6, 10, 122},
+    {0x4C7, 10, 121},
+    {0x4C8, 10, 124},
+    {0x4DD, 10, 123},
+    {0x58E, 10, 124},
+    {0x610, 21, 120},
+    {0x611, 10, 117},
+    {0x612, 1, 122},
+    {0x613, 5, 124},
+    {0x614, 1, 122},
+    {0x615, 1, 120},
+    {0x616, 5, 123},
+    {0x618, 1, 123},
+    {0x619, 1, 119},
+    {0x61A, 1, 121},
+    {0x61C, 1, 124},
+    {0x620, 33, 122},
+    {0x621, 10, 123},
+    {0x622, 10, 125},
+    {0x623, 10, 123},
+    {0x624, 10, 120},
+    {0x626, 10, 123},
+    {0x630, 10, 125},
+    {0x632, 10, 123},
+    {0x633, 10, 123},
+    {0x635, 10, 124},
+    {0x638, 10, 123},
+    {0x639, 10, 124},
+    {0x63B, 20, 119},
+    {0x680, 10, 126},
+    {0x6C0, 33, 122},
+    {0x6F0, 10, 121},
+};
+
+constexpr uint16_t BUS_PROFILE_COUNT = 115;
@@ -0,0 +1,275 @@
+// Generated by scripts/gen_can_decoders.py from SavvyCANstuff/prius_v_2016_body_misc_overlay.dbc, toyota_prius_2010_pt.dbc, toyota_2017_ref_pt.dbc.
+// Do not edit by hand.
+#pragma once
+
+#include "dbc_signal.h"
+
+namespace dbc {
+
+// 0x024 KINEMATICS (prius_v_2016_body_misc_overlay.dbc)
+namespace kinematics {
+constexpr uint16_t ID = 0x024;
+constexpr uint8_t DLC = 8;
+// YAW_RATE 1|10@0+ (0.244,-125) deg/s
+using yaw_rate_field = DbcField<1, 10, true, false>;
+inline yaw_rate_field::Raw yaw_rate_raw(const uint8_t* d) { return yaw_rate_field::raw(d); }
+inline float yaw_rate(const uint8_t* d) { return yaw_rate_raw(d) * 0.244f - 125.0f; }
+// STEERING_TORQUE 17|10@0+ (1,-512)
+using steering_torque_field = DbcField<17, 10, true, false>;
+inline steering_torque_field::Raw steering_torque_raw(const uint8_t* d) { return steering_torque_field::raw(d); }
+inline float steering_torque(const uint8_t* d) { return (float)steering_torque_raw(d) - 512.0f; }
+// ACCEL_Y 33|10@0+ (0.03589,-18.375) m/s^2
+using accel_y_field = DbcField<33, 10, true, false>;
+inline accel_y_field::Raw accel_y_raw(const uint8_t* d) { return accel_y_field::raw(d); }
+inline float accel_y(const uint8_t* d) { return accel_y_raw(d) * 0.03589f - 18.375f; }
+} // namespace kinematics
+
+// 0x025 STEER_ANGLE_SENSOR (toyota_prius_2010_pt.dbc)
+namespace steer_angle_sensor {
+constexpr uint16_t ID = 0x025;
+constexpr uint8_t DLC = 8;
+// STEER_ANGLE 3|12@0- (1.5,0) deg
+using steer_angle_field = DbcField<3, 12, true, true>;
+inline steer_angle_field::Raw steer_angle_raw(const uint8_t* d) { return steer_angle_field::raw(d); }
+inline float steer_angle(const uint8_t* d) { return steer_angle_raw(d) * 1.5f; }
+// STEER_FRACTION 39|4@0- (0.1,0) deg
+using steer_fraction_field = DbcField<39, 4, true, true>;
+inline steer_fraction_field::Raw steer_fraction_raw(const uint8_t* d) { return steer_fraction_field::raw(d); }
+inline float steer_fraction(const uint8_t* d) { return steer_fraction_raw(d) * 0.1f; }
+// STEER_RATE 35|12@0- (1,0) deg/s
+using steer_rate_field = DbcField<35, 12, true, true>;
+inline steer_rate_field::Raw steer_rate_raw(const uint8_t* d) { return steer_rate_field::raw(d); }
+inline float steer_rate(const uint8_t* d) { return (float)steer_rate_raw(d); }
+} // namespace steer_angle_sensor
+
+// 0x0AA WHEEL_SPEEDS (prius_v_2016_body_misc_overlay.dbc)
+namespace wheel_speeds {
+constexpr uint16_t ID = 0x0AA;
+constexpr uint8_t DLC = 8;
+// WHEEL_SPEED_FR 6|15@0+ (0.01,-67.67) km/h
+using wheel_speed_fr_field = DbcField<6, 15, true, false>;
+inline wheel_speed_fr_field::Raw wheel_speed_fr_raw(const uint8_t* d) { return wheel_speed_fr_field::raw(d); }
+inline float wheel_speed_fr(const uint8_t* d) { return wheel_speed_fr_raw(d) * 0.01f - 67.67f; }
+// WHEEL_SPEED_FL 22|15@0+ (0.01,-67.67) km/h
+using wheel_speed_fl_field = DbcField<22, 15, true, false>;
+inline wheel_speed_fl_field::Raw wheel_speed_fl_raw(const uint8_t* d) { return wheel_speed_fl_field::raw(d); }
+inline float wheel_speed_fl(const uint8_t* d) { return wheel_speed_fl_raw(d) * 0.01f - 67.67f; }
+// WHEEL_SPEED_RR 38|15@0+ (0.01,-67.67) km/h
+using wheel_speed_rr_field = DbcField<38, 15, true, false>;
+inline wheel_speed_rr_field::Raw wheel_speed_rr_raw(const uint8_t* d) { return wheel_speed_rr_field::raw(d); }
+inline float wheel_speed_rr(const uint8_t* d) { return wheel_speed_rr_raw(d) * 0.01f - 67.67f; }
+// WHEEL_SPEED_RL 54|15@0+ (0.01,-67.67) km/h
+using wheel_speed_rl_field = DbcField<54, 15, true, false>;
+inline wheel_speed_rl_field::Raw wheel_speed_rl_raw(const uint8_t* d) { return wheel_speed_rl_field::raw(d); }
+inline float wheel_speed_rl(const uint8_t* d) { return wheel_speed_rl_raw(d) * 0.01f - 67.67f; }
+} // namespace wheel_speeds
+
+// 0x0B4 SPEED (toyota_prius_2010_pt.dbc)
+namespace speed {
+constexpr uint16_t ID = 0x0B4;
+constexpr uint8_t DLC = 8;
+// CHECKSUM 63|8@0+ (1,0)
+using checksum_field = DbcField<63, 8, true, false>;
+inline checksum_field::Raw checksum_raw(const uint8_t* d) { return checksum_field::raw(d); }
+inline float checksum(const uint8_t* d) { return (float)checksum_raw(d); }
+// SPEED 47|16@0+ (0.0062,0) mph
+using speed_field = DbcField<47, 16, true, false>;
+inline speed_field::Raw speed_raw(const uint8_t* d) { return speed_field::raw(d); }
+inline float speed(const uint8_t* d) { return speed_raw(d) * 0.0062f; }
+// ENCODER 39|8@0+ (1,0)
+using encoder_field = DbcField<39, 8, true, false>;
+inline encoder_field::Raw encoder_raw(const uint8_t* d) { return encoder_field::raw(d); }
+inline float encoder(const uint8_t* d) { return (float)encoder_raw(d); }
+} // namespace speed
+
+// 0x127 GEAR_PACKET (toyota_prius_2010_pt.dbc)
+namespace gear_packet {
+constexpr uint16_t ID = 0x127;
+constexpr uint8_t DLC = 8;
+// CAR_MOVEMENT 39|8@0- (1,0)
+using car_movement_field = DbcField<39, 8, true, true>;
+inline car_movement_field::Raw car_movement_raw(const uint8_t* d) { return car_movement_field::raw(d); }
+inline float car_movement(const uint8_t* d) { return (float)car_movement_raw(d); }
+// COUNTER 55|8@0+ (1,0)
+using counter_field = DbcField<55, 8, true, false>;
+inline counter_field::Raw counter_raw(const uint8_t* d) { return counter_field::raw(d); }
+inline float counter(const uint8_t* d) { return (float)counter_raw(d); }
+// CHECKSUM 63|8@0+ (1,0)
+using checksum_field = DbcField<63, 8, true, false>;
+inline checksum_field::Raw checksum_raw(const uint8_t* d) { return checksum_field::raw(d); }
+inline float checksum(const uint8_t* d) { return (float)checksum_raw(d); }
+// GEAR 47|4@0+ (1,0)
+using gear_field = DbcField<47, 4, true, false>;
+inline gear_field::Raw gear_raw(const uint8_t* d) { return gear_field::raw(d); }
+inline float gear(const uint8_t* d) { return (float)gear_raw(d); }
+} // namespace gear_packet
+
+// 0x1C4 POWERTRAIN (toyota_prius_2010_pt.dbc)
+namespace powertrain {
+constexpr uint16_t ID = 0x1C4;
+constexpr uint8_t DLC = 8;
+// ENGINE_RPM 7|16@0+ (1,0) rpm
+using engine_rpm_field = DbcField<7, 16, true, false>;
+inline engine_rpm_field::Raw engine_rpm_raw(const uint8_t* d) { return engine_rpm_field::raw(d); }
+inline float engine_rpm(const uint8_t* d) { return (float)engine_rpm_raw(d); }
+// CHECKSUM 63|8@0+ (1,0)
+using checksum_field = DbcField<63, 8, true, false>;
+inline checksum_field::Raw checksum_raw(const uint8_t* d) { return checksum_field::raw(d); }
+inline float checksum(const uint8_t* d) { return (float)checksum_raw(d); }
+} // namespace powertrain
+
+// 0x247 PRIUSV_ENERGY_DISPLAY (prius_v_2016_body_misc_overlay.dbc)
+namespace priusv_energy_display {
+constexpr uint16_t ID = 0x247;
+constexpr uint8_t DLC = 5;
+// ENERGY_FLOW_STATE 0|4@1+ (1,0)
+using energy_flow_state_field = DbcField<0, 4, false, false>;
+inline energy_flow_state_field::Raw energy_flow_state_raw(const uint8_t* d) { return energy_flow_state_field::raw(d); }
+inline float energy_flow_state(const uint8_t* d) { return (float)energy_flow_state_raw(d); }
+// ENERGY_BAR 8|8@1- (1,0)
+using energy_bar_field = DbcField<8, 8, false, true>;
+inline energy_bar_field::Raw energy_bar_raw(const uint8_t* d) { return energy_bar_field::raw(d); }
+inline float energy_bar(const uint8_t* d) { return (float)energy_bar_raw(d); }
+// ENERGY_BAR_MODE_RAW 16|8@1+ (1,0)
+using energy_bar_mode_raw_field = DbcField<16, 8, false, false>;
+inline energy_bar_mode_raw_field::Raw energy_bar_mode_raw_raw(const uint8_t* d) { return energy_bar_mode_raw_field::raw(d); }
+inline float energy_bar_mode_raw(const uint8_t* d) { return (float)energy_bar_mode_raw_raw(d); }
+} // namespace priusv_energy_display
+
+// 0x3B0 PRIUSV_HVAC_ACN1S07_OVERLAY (prius_v_2016_body_misc_overlay.dbc)
+namespace priusv_hvac_acn1s07_overlay {
+constexpr uint16_t ID = 0x3B0;
+constexpr uint8_t DLC = 6;
+// HVAC_TEMP_RAW_D2 8|8@1+ (1,0)
+using hvac_temp_raw_d2_field = DbcField<8, 8, false, false>;
+inline hvac_temp_raw_d2_field::Raw hvac_temp_raw_d2_raw(const uint8_t* d) { return hvac_temp_raw_d2_field::raw(d); }
+inline float hvac_temp_raw_d2(const uint8_t* d) { return (float)hvac_temp_raw_d2_raw(d); }
+// HVAC_AMBIENT_OR_TEMP_RAW_D4 24|8@1+ (1,0)
+using hvac_ambient_or_temp_raw_d4_field = DbcField<24, 8, false, false>;
+inline hvac_ambient_or_temp_raw_d4_field::Raw hvac_ambient_or_temp_raw_d4_raw(const uint8_t* d) { return hvac_ambient_or_temp_raw_d4_field::raw(d); }
+inline float hvac_ambient_or_temp_raw_d4(const uint8_t* d) { return (float)hvac_ambient_or_temp_raw_d4_raw(d); }
+// HVAC_STATUS_BYTE_6 40|8@1+ (1,0)
+using hvac_status_byte_6_field = DbcField<40, 8, false, false>;
+inline hvac_status_byte_6_field::Raw hvac_status_byte_6_raw(const uint8_t* d) { return hvac_status_byte_6_field::raw(d); }
+inline float hvac_status_byte_6(const uint8_t* d) { return (float)hvac_status_byte_6_raw(d); }
+} // namespace priusv_hvac_acn1s07_overlay
+
+// 0x49B PRIUSV_DRIVE_MODE_STATUS (prius_v_2016_body_misc_overlay.dbc)
+namespace priusv_drive_mode_status {
+constexpr uint16_t ID = 0x49B;
+constexpr uint8_t DLC = 8;
+// EV_MODE_ACTIVE 33|1@1+ (1,0)
+using ev_mode_active_field = DbcField<33, 1, false, false>;
+inline ev_mode_active_field::Raw ev_mode_active_raw(const uint8_t* d) { return ev_mode_active_field::raw(d); }
+inline float ev_mode_active(const uint8_t* d) { return (float)ev_mode_active_raw(d); }
+// PWR_MODE_ACTIVE 34|1@1+ (1,0)
+using pwr_mode_active_field = DbcField<34, 1, false, false>;
+inline pwr_mode_active_field::Raw pwr_mode_active_raw(const uint8_t* d) { return pwr_mode_active_field::raw(d); }
+inline float pwr_mode_active(const uint8_t* d) { return (float)pwr_mode_active_raw(d); }
+// ECO_MODE_ACTIVE 35|1@1+ (1,0)
+using eco_mode_active_field = DbcField<35, 1, false, false>;
+inline eco_mode_active_field::Raw eco_mode_active_raw(const uint8_t* d) { return eco_mode_active_field::raw(d); }
+inline float eco_mode_active(const uint8_t* d) { return (float)eco_mode_active_raw(d); }
+// DRIVE_MODE_FLAGS_RAW 32|8@1+ (1,0)
+using drive_mode_flags_raw_field = DbcField<32, 8, false, false>;
+inline drive_mode_flags_raw_field::Raw drive_mode_flags_raw_raw(const uint8_t* d) { return drive_mode_flags_raw_field::raw(d); }
+inline float drive_mode_flags_raw(const uint8_t* d) { return (float)drive_mode_flags_raw_raw(d); }
+} // namespace priusv_drive_mode_status
+
+// 0x58E PRIUSV_STEERING_WHEEL_BUTTONS (prius_v_2016_body_misc_overlay.dbc)
+namespace priusv_steering_wheel_buttons {
+constexpr uint16_t ID = 0x58E;
+constexpr uint8_t DLC = 8;
+// STEERING_BUTTON_CODE 40|8@1+ (1,0)
+using steering_button_code_field = DbcField<40, 8, false, false>;
+inline steering_button_code_field::Raw steering_button_code_raw(const uint8_t* d) { return steering_button_code_field::raw(d); }
+inline float steering_button_code(const uint8_t* d) { return (float)steering_button_code_raw(d); }
+} // namespace priusv_steering_wheel_buttons
+
+// 0x610 PRIUSV_DIMMER_RHEOSTAT_STATUS (prius_v_2016_body_misc_overlay.dbc)
+namespace priusv_dimmer_rheostat_status {
+constexpr uint16_t ID = 0x610;
+constexpr uint8_t DLC = 8;
+// DIMMER_EVENT_OR_ACTIVE_FLAG 15|1@1+ (1,0)
+using dimmer_event_or_active_flag_field = DbcField<15, 1, false, false>;
+inline dimmer_event_or_active_flag_field::Raw dimmer_event_or_active_flag_raw(const uint8_t* d) { return dimmer_event_or_active_flag_field::raw(d); }
+inline float dimmer_event_or_active_flag(const uint8_t* d) { return (float)dimmer_event_or_active_flag_raw(d); }
+// DIMMER_LEVEL_RAW 16|8@1+ (1,0)
+using dimmer_level_raw_field = DbcField<16, 8, false, false>;
+inline dimmer_level_raw_field::Raw dimmer_level_raw_raw(const uint8_t* d) { return dimmer_level_raw_field::raw(d); }
+inline float dimmer_level_raw(const uint8_t* d) { return (float)dimmer_level_raw_raw(d); }
+// DIMMER_DOWN_OR_DISPLAY_OFF_RAW 24|8@1+ (1,0)
+using dimmer_down_or_display_off_raw_field = DbcField<24, 8, false, false>;
+inline dimmer_down_or_display_off_raw_field::Raw dimmer_down_or_display_off_raw_raw(const uint8_t* d) { return dimmer_down_or_display_off_raw_field::raw(d); }
+inline float dimmer_down_or_display_off_raw(const uint8_t* d) { return (float)dimmer_down_or_display_off_raw_raw(d); }
+// DIMMER_BYTE_6_RAW 40|8@1+ (1,0)
+using dimmer_byte_6_raw_field = DbcField<40, 8, false, false>;
+inline dimmer_byte_6_raw_field::Raw dimmer_byte_6_raw_raw(const uint8_t* d) { return dimmer_byte_6_raw_field::raw(d); }
+inline float dimmer_byte_6_raw(const uint8_t* d) { return (float)dimmer_byte_6_raw_raw(d); }
+// DIMMER_BYTE_7_RAW 48|8@1+ (1,0)
+using dimmer_byte_7_raw_field = DbcField<48, 8, false, false>;
+inline dimmer_byte_7_raw_field::Raw dimmer_byte_7_raw_raw(const uint8_t* d) { return dimmer_byte_7_raw_field::raw(d); }
+inline float dimmer_byte_7_raw(const uint8_t* d) { return (float)dimmer_byte_7_raw_raw(d); }
+} // namespace priusv_dimmer_rheostat_status
+
+// 0x620 PRIUSV_LIGHT_AMBIENT_STATUS (prius_v_2016_body_misc_overlay.dbc)
+namespace priusv_light_ambient_status {
+constexpr uint16_t ID = 0x620;
+constexpr uint8_t DLC = 8;
+// AMBIENT_LIGHT_RAW 23|16@0+ (1,0)
+using ambient_light_raw_field = DbcField<23, 16, true, false>;
+inline ambient_light_raw_field::Raw ambient_light_raw_raw(const uint8_t* d) { return ambient_light_raw_field::raw(d); }
+inline float ambient_light_raw(const uint8_t* d) { return (float)ambient_light_raw_raw(d); }
+// ILLUMINATION_DIM_ACTIVE 38|1@1+ (1,0)
+using illumination_dim_active_field = DbcField<38, 1, false, false>;
+inline illumination_dim_active_field::Raw illumination_dim_active_raw(const uint8_t* d) { return illumination_dim_active_field::raw(d); }
+inline float illumination_dim_active(const uint8_t* d) { return (float)illumination_dim_active_raw(d); }
+// LIGHT_STATUS_BYTE_8 56|8@1+ (1,0)
+using light_status_byte_8_field = DbcField<56, 8, false, false>;
+inline light_status_byte_8_field::Raw light_status_byte_8_raw(const uint8_t* d) { return light_status_byte_8_field::raw(d); }
+inline float light_status_byte_8(const uint8_t* d) { return (float)light_status_byte_8_raw(d); }
+} // namespace priusv_light_ambient_status
+
+// Every signal above, for the capture check (src/host/dbc_check.cpp).
+inline constexpr DbcSignalInfo SIGNALS[] = {
+    {kinematics::ID, "KINEMATICS", "YAW_RATE", 1, 10, true, false, 0.244f, -125.0f, -125.0f, 125.0f, kinematics::yaw_rate_field::bits, kinematics::yaw_rate},
+    {kinematics::ID, "KINEMATICS", "STEERING_TORQUE", 17, 10, true, false, 1.0f, -512.0f, -512.0f, 511.0f, kinematics::steering_torque_field::bits, kinematics::steering_torque},
+    {kinematics::ID, "KINEMATICS", "ACCEL_Y", 33, 10, true, false, 0.03589f, -18.375f, -18.375f, 18.34f, kinematics::accel_y_field::bits, kinematics::accel_y},
+    {steer_angle_sensor::ID, "STEER_ANGLE_SENSOR", "STEER_ANGLE", 3, 12, true, true, 1.5f, 0.0f, -500.0f, 500.0f, steer_angle_sensor::steer_angle_field::bits, steer_angle_sensor::steer_angle},
+    {steer_angle_sensor::ID, "STEER_ANGLE_SENSOR", "STEER_FRACTION", 39, 4, true, true, 0.1f, 0.0f, -0.7f, 0.7f, steer_angle_sensor::steer_fraction_field::bits, steer_angle_sensor::steer_fraction},
+    {steer_angle_sensor::ID, "STEER_ANGLE_SENSOR", "STEER_RATE", 35, 12, true, true, 1.0f, 0.0f, -2000.0f, 2000.0f, steer_angle_sensor::steer_rate_field::bits, steer_angle_sensor::steer_rate},
+    {wheel_speeds::ID, "WHEEL_SPEEDS", "WHEEL_SPEED_FR", 6, 15, true, false, 0.01f, -67.67f, 0.0f, 250.0f, wheel_speeds::wheel_speed_fr_field::bits, wheel_speeds::wheel_speed_fr},
+    {wheel_speeds::ID, "WHEEL_SPEEDS", "WHEEL_SPEED_FL", 22, 15, true, false, 0.01f, -67.67f, 0.0f, 250.0f, wheel_speeds::wheel_speed_fl_field::bits, wheel_speeds::wheel_speed_fl},
+    {wheel_speeds::ID, "WHEEL_SPEEDS", "WHEEL_SPEED_RR", 38, 15, true, false, 0.01f, -67.67f, 0.0f, 250.0f, wheel_speeds::wheel_speed_rr_field::bits, wheel_speeds::wheel_speed_rr},
+    {wheel_speeds::ID, "WHEEL_SPEEDS", "WHEEL_SPEED_RL", 54, 15, true, false, 0.01f, -67.67f, 0.0f, 250.0f, wheel_speeds::wheel_speed_rl_field::bits, wheel_speeds::wheel_speed_rl},
+    {speed::ID, "SPEED", "CHECKSUM", 63, 8, true, false, 1.0f, 0.0f, 0.0f, 255.0f, speed::checksum_field::bits, speed::checksum},
+    {speed::ID, "SPEED", "SPEED", 47, 16, true, false, 0.0062f, 0.0f, 0.0f, 115.0f, speed::speed_field::bits, speed::speed},
+    {speed::ID, "SPEED", "ENCODER", 39, 8, true, false, 1.0f, 0.0f, 0.0f, 255.0f, speed::encoder_field::bits, speed::encoder},
+    {gear_packet::ID, "GEAR_PACKET", "CAR_MOVEMENT", 39, 8, true, true, 1.0f, 0.0f, 0.0f, 255.0f, gear_packet::car_movement_field::bits, gear_packet::car_movement},
+    {gear_packet::ID, "GEAR_PACKET", "COUNTER", 55, 8, true, false, 1.0f, 0.0f, 0.0f, 255.0f, gear_packet::counter_field::bits, gear_packet::counter},
+    {gear_packet::ID, "GEAR_PACKET", "CHECKSUM", 63, 8, true, false, 1.0f, 0.0f, 0.0f, 255.0f, gear_packet::checksum_field::bits, gear_packet::checksum},
+    {gear_packet::ID, "GEAR_PACKET", "GEAR", 47, 4, true, false, 1.0f, 0.0f, 0.0f, 15.0f, gear_packet::gear_field::bits, gear_packet::gear},
+    {powertrain::ID, "POWERTRAIN", "ENGINE_RPM", 7, 16, true, false, 1.0f, 0.0f, 0.0f, 65535.0f, powertrain::engine_rpm_field::bits, powertrain::engine_rpm},
+    {powertrain::ID, "POWERTRAIN", "CHECKSUM", 63, 8, true, false, 1.0f, 0.0f, 0.0f, 255.0f, powertrain::checksum_field::bits, powertrain::checksum},
+    {priusv_energy_display::ID, "PRIUSV_ENERGY_DISPLAY", "ENERGY_FLOW_STATE", 0, 4, false, false, 1.0f, 0.0f, 0.0f, 15.0f, priusv_energy_display::energy_flow_state_field::bits, priusv_energy_display::energy_flow_state},
+    {priusv_energy_display::ID, "PRIUSV_ENERGY_DISPLAY", "ENERGY_BAR", 8, 8, false, true, 1.0f, 0.0f, -128.0f, 127.0f, priusv_energy_display::energy_bar_field::bits, priusv_energy_display::energy_bar},
+    {priusv_energy_display::ID, "PRIUSV_ENERGY_DISPLAY", "ENERGY_BAR_MODE_RAW", 16, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_energy_display::energy_bar_mode_raw_field::bits, priusv_energy_display::energy_bar_mode_raw},
+    {priusv_hvac_acn1s07_overlay::ID, "PRIUSV_HVAC_ACN1S07_OVERLAY", "HVAC_TEMP_RAW_D2", 8, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_hvac_acn1s07_overlay::hvac_temp_raw_d2_field::bits, priusv_hvac_acn1s07_overlay::hvac_temp_raw_d2},
+    {priusv_hvac_acn1s07_overlay::ID, "PRIUSV_HVAC_ACN1S07_OVERLAY", "HVAC_AMBIENT_OR_TEMP_RAW_D4", 24, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_hvac_acn1s07_overlay::hvac_ambient_or_temp_raw_d4_field::bits, priusv_hvac_acn1s07_overlay::hvac_ambient_or_temp_raw_d4},
+    {priusv_hvac_acn1s07_overlay::ID, "PRIUSV_HVAC_ACN1S07_OVERLAY", "HVAC_STATUS_BYTE_6", 40, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_hvac_acn1s07_overlay::hvac_status_byte_6_field::bits, priusv_hvac_acn1s07_overlay::hvac_status_byte_6},
+    {priusv_drive_mode_status::ID, "PRIUSV_DRIVE_MODE_STATUS", "EV_MODE_ACTIVE", 33, 1, false, false, 1.0f, 0.0f, 0.0f, 1.0f, priusv_drive_mode_status::ev_mode_active_field::bits, priusv_drive_mode_status::ev_mode_active},
+    {priusv_drive_mode_status::ID, "PRIUSV_DRIVE_MODE_STATUS", "PWR_MODE_ACTIVE", 34, 1, false, false, 1.0f, 0.0f, 0.0f, 1.0f, priusv_drive_mode_status::pwr_mode_active_field::bits, priusv_drive_mode_status::pwr_mode_active},
+    {priusv_drive_mode_status::ID, "PRIUSV_DRIVE_MODE_STATUS", "ECO_MODE_ACTIVE", 35, 1, false, false, 1.0f, 0.0f, 0.0f, 1.0f, priusv_drive_mode_status::eco_mode_active_field::bits, priusv_drive_mode_status::eco_mode_active},
+    {priusv_drive_mode_status::ID, "PRIUSV_DRIVE_MODE_STATUS", "DRIVE_MODE_FLAGS_RAW", 32, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_drive_mode_status::drive_mode_flags_raw_field::bits, priusv_drive_mode_status::drive_mode_flags_raw},
+    {priusv_steering_wheel_buttons::ID, "PRIUSV_STEERING_WHEEL_BUTTONS", "STEERING_BUTTON_CODE", 40, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_steering_wheel_buttons::steering_button_code_field::bits, priusv_steering_wheel_buttons::steering_button_code},
+    {priusv_dimmer_rheostat_status::ID, "PRIUSV_DIMMER_RHEOSTAT_STATUS", "DIMMER_EVENT_OR_ACTIVE_FLAG", 15, 1, false, false, 1.0f, 0.0f, 0.0f, 1.0f, priusv_dimmer_rheostat_status::dimmer_event_or_active_flag_field::bits, priusv_dimmer_rheostat_status::dimmer_event_or_active_flag},
+    {priusv_dimmer_rheostat_status::ID, "PRIUSV_DIMMER_RHEOSTAT_STATUS", "DIMMER_LEVEL_RAW", 16, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_dimmer_rheostat_status::dimmer_level_raw_field::bits, priusv_dimmer_rheostat_status::dimmer_level_raw},
+    {priusv_dimmer_rheostat_status::ID, "PRIUSV_DIMMER_RHEOSTAT_STATUS", "DIMMER_DOWN_OR_DISPLAY_OFF_RAW", 24, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_dimmer_rheostat_status::dimmer_down_or_display_off_raw_field::bits, priusv_dimmer_rheostat_status::dimmer_down_or_display_off_raw},
+    {priusv_dimmer_rheostat_status::ID, "PRIUSV_DIMMER_RHEOSTAT_STATUS", "DIMMER_BYTE_6_RAW", 40, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_dimmer_rheostat_status::dimmer_byte_6_raw_field::bits, priusv_dimmer_rheostat_status::dimmer_byte_6_raw},
+    {priusv_dimmer_rheostat_status::ID, "PRIUSV_DIMMER_RHEOSTAT_STATUS", "DIMMER_BYTE_7_RAW", 48, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_dimmer_rheostat_status::dimmer_byte_7_raw_field::bits, priusv_dimmer_rheostat_status::dimmer_byte_7_raw},
+    {priusv_light_ambient_status::ID, "PRIUSV_LIGHT_AMBIENT_STATUS", "AMBIENT_LIGHT_RAW", 23, 16, true, false, 1.0f, 0.0f, 0.0f, 65535.0f, priusv_light_ambient_status::ambient_light_raw_field::bits, priusv_light_ambient_status::ambient_light_raw},
+    {priusv_light_ambient_status::ID, "PRIUSV_LIGHT_AMBIENT_STATUS", "ILLUMINATION_DIM_ACTIVE", 38, 1, false, false, 1.0f, 0.0f, 0.0f, 1.0f, priusv_light_ambient_status::illumination_dim_active_field::bits, priusv_light_ambient_status::illumination_dim_active},
+    {priusv_light_ambient_status::ID, "PRIUSV_LIGHT_AMBIENT_STATUS", "LIGHT_STATUS_BYTE_8", 56, 8, false, false, 1.0f, 0.0f, 0.0f, 255.0f, priusv_light_ambient_status::light_status_byte_8_field::bits, priusv_light_ambient_status::light_status_byte_8},
+};
+
+} // namespace dbc
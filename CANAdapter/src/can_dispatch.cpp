@@ -0,0 +1,104 @@
+#include "can_dispatch.h"
+
+#include "bus_profile.h"
+
+namespace {
+
+constexpr uint16_t MIX_FRAMES = 1024;   // about one second of the recorded bus
+constexpr uint8_t PASSES = 50;
+
+volatile uint32_t sink = 0;
+
+void benchDecode(const CanDriverFrame& frame, const uint8_t* slots, unsigned long) {
+    sink += frame.data[0] + slots[0];
+}
+
+// Every ID on the bus gets a route: the "dozens of DBC messages" case.
+struct BenchRoutes {
+    CanRoute routes[BUS_PROFILE_COUNT];
+    constexpr BenchRoutes() : routes{} {
+        for (uint16_t i = 0; i < BUS_PROFILE_COUNT; i++) {
+            routes[i] = {busProfile[i].id, benchDecode, {(uint8_t)i, CAN_SLOT_NONE, CAN_SLOT_NONE, CAN_SLOT_NONE}};
+        }
+    }
+};
+
+constexpr BenchRoutes BENCH_ROUTES;
+constexpr CanDispatch<BUS_PROFILE_COUNT> BENCH_DISPATCH(BENCH_ROUTES.routes);
+
+bool linearDispatch(const CanDriverFrame& frame, unsigned long now) {
+    for (const CanRoute& r : BENCH_ROUTES.routes) {
+        if (r.id == frame.id) {
+            r.decode(frame, r.slots, now);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Frames in proportion to each ID's rate, shuffled so the order isn't sorted
+// by ID (which would flatter the linear scan's branch predictor).
+uint16_t buildMix(CanDriverFrame* frames, uint32_t* busDeciHz) {
+    uint32_t total = 0;
+    for (const BusProfileEntry& e : busProfile) total += e.deciHz;
+    *busDeciHz = total;
+
+    uint16_t n = 0;
+    for (const BusProfileEntry& e : busProfile) {
+        uint32_t count = (uint32_t)e.deciHz * MIX_FRAMES / total;
+        if (count == 0) count = 1;
+        for (uint32_t k = 0; k < count && n < MIX_FRAMES; k++) {
+            CanDriverFrame& f = frames[n++];
+            memset(&f, 0, sizeof(f));
+            f.id = e.id;
+            f.length = 8;
+            f.data[0] = (uint8_t)k;
+        }
+    }
+    uint32_t seed = 0x2545F491;
+    for (uint16_t i = n - 1; i > 0; i--) {
+        seed = seed * 1664525 + 1013904223;
+        const uint16_t j = (uint16_t)(seed % (i + 1));
+        const CanDriverFrame t = frames[i];
+        frames[i] = frames[j];
+        frames[j] = t;
+    }
+    return n;
+}
+
+template <typename Fn>
+uint32_t timeNs(const CanDriverFrame* frames, uint16_t n, Fn fn) {
+    const int64_t start = esp_timer_get_time();
+    for (uint8_t p = 0; p < PASSES; p++) {
+        for (uint16_t i = 0; i < n; i++) fn(frames[i], 0);
+    }
+    const int64_t us = esp_timer_get_time() - start;
+    return (uint32_t)(us * 1000 / ((int64_t)PASSES * n));
+}
+
+} // namespace
+
+void canDispatchBenchmark() {
+    CanDriverFrame* frames = (CanDriverFrame*)malloc(sizeof(CanDriverFrame) * MIX_FRAMES);
+    if (frames == nullptr) {
+        Serial.println("dispatch bench: no memory");
+        return;
+    }
+    uint32_t busDeciHz = 0;
+    const uint16_t n = buildMix(frames, &busDeciHz);
+
+    const uint32_t tableNs = timeNs(frames, n, [](const CanDriverFrame& f, unsigned long now) {
+        return BENCH_DISPATCH.dispatch(f, now);
+    });
+    const uint32_t linearNs = timeNs(frames, n, linearDispatch);
+    free(frames);
+
+    // At full bus rate, microseconds of CPU per second = ns/frame * fps / 1000.
+    const uint32_t fps = busDeciHz / 10;
+    Serial.printf("dispatch bench: %u routes, %u frames x %u passes, bus %lu fps\n",
+                  (unsigned)BUS_PROFILE_COUNT, n, PASSES, (unsigned long)fps);
+    Serial.printf("  table  %4lu ns/frame  %5lu us/s at full bus\n",
+                  (unsigned long)tableNs, (unsigned long)(tableNs * fps / 1000));
+    Serial.printf("  linear %4lu ns/frame  %5lu us/s at full bus\n",
+                  (unsigned long)linearNs, (unsigned long)(linearNs * fps / 1000));
+}
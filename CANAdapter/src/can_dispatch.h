@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "can_driver.h"
+
+// ID -> decoder lookup for received frames. The routes are a constexpr list
+// and the 11-bit index over them is built from it at compile time, so a
+// lookup is one byte load whatever the number of routes:
+//
+//   constexpr CanRoute ROUTES[] = {{0x1C4, decodeRpm, {SIG_ENGINE_RPM}}, ...};
+//   static_assert(canRoutesValid(ROUTES), "...");
+//   constexpr CanDispatch<sizeof(ROUTES) / sizeof(ROUTES[0])> dispatch(ROUTES);
+//   dispatch.dispatch(frame, now);
+//
+// Slots are whatever the decoder wants them to be (SignalId values, an ECU
+// number); unused ones are CAN_SLOT_NONE.
+
+constexpr uint8_t CAN_ROUTE_MAX_SLOTS = 4;
+constexpr uint8_t CAN_SLOT_NONE = 0xFF;
+constexpr uint16_t CAN_STD_ID_COUNT = 0x800;
+
+using CanDecodeFn = void (*)(const CanDriverFrame& frame, const uint8_t* slots, unsigned long now);
+
+struct CanRoute {
+    uint16_t id;
+    CanDecodeFn decode;
+    uint8_t slots[CAN_ROUTE_MAX_SLOTS];
+};
+
+// Standard IDs only, each at most once.
+template <size_t N>
+constexpr bool canRoutesValid(const CanRoute (&routes)[N]) {
+    for (size_t i = 0; i < N; i++) {
+        if (routes[i].id >= CAN_STD_ID_COUNT || routes[i].decode == nullptr) return false;
+        for (size_t j = i + 1; j < N; j++) {
+            if (routes[i].id == routes[j].id) return false;
+        }
+    }
+    return true;
+}
+
+template <size_t N>
+class CanDispatch {
+    static_assert(N > 0 && N < 0xFF, "route index is a byte, 0xFF means none");
+
+public:
+    // routes must hold N entries that pass canRoutesValid().
+    constexpr explicit CanDispatch(const CanRoute* routes) : routes_{}, index_{} {
+        for (uint16_t id = 0; id < CAN_STD_ID_COUNT; id++) index_[id] = NONE;
+        for (size_t i = 0; i < N; i++) {
+            routes_[i] = routes[i];
+            if (routes[i].id < CAN_STD_ID_COUNT) index_[routes[i].id] = (uint8_t)i;
+        }
+    }
+
+    // True if a decoder ran.
+    bool dispatch(const CanDriverFrame& frame, unsigned long now) const {
+        if (frame.extended || frame.id >= CAN_STD_ID_COUNT) return false;
+        const uint8_t i = index_[frame.id];
+        if (i == NONE) return false;
+        routes_[i].decode(frame, routes_[i].slots, now);
+        return true;
+    }
+
+    constexpr size_t size() const { return N; }
+    constexpr const CanRoute& route(size_t i) const { return routes_[i]; }
+
+private:
+    static constexpr uint8_t NONE = 0xFF;
+    CanRoute routes_[N];
+    uint8_t index_[CAN_STD_ID_COUNT];
+};
+
+// Times dispatch against a linear scan over the same number of routes, with
+// frames drawn from the recorded bus mix (bus_profile.h), and prints the
+// cost per frame and per second of full-bus traffic.
+void canDispatchBenchmark();
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The one owner of the CAN controller. can_rx and can_tx sit on top of this
+// and never talk to TWAI directly. Two backends implement it:
+//
+//   can_driver_twai.cpp      ESP32 TWAI (the car)
+//   can_driver_socketcan.cpp Linux SocketCAN, e.g. vcan0 fed by canplayer
+//                            from a candump, for soak runs on a PC
+//
+// Only one backend is compiled per build. No Arduino types in here so the
+// host build can use it as is.
+
+constexpr uint8_t CAN_DRIVER_MAX_FILTERS = 2;  // TWAI dual filter mode
+
+struct CanDriverFrame {
+    uint32_t us;        // receive time (backend clock, microseconds); unused on TX
+    uint32_t id;
+    uint8_t length;
+    bool extended;
+    bool rtr;
+    uint8_t data[8];
+};
+
+// Standard 11-bit IDs. mask bits set = must match. count 0 accepts everything.
+struct CanAcceptance {
+    uint8_t count;
+    uint16_t id[CAN_DRIVER_MAX_FILTERS];
+    uint16_t mask[CAN_DRIVER_MAX_FILTERS];
+};
+
+struct CanDriverConfig {
+    int txPin;              // TWAI only
+    int rxPin;
+    const char* interface;  // SocketCAN only, e.g. "vcan0"
+    uint32_t bitrate;       // TWAI only; SocketCAN takes it from `ip link`
+    uint16_t rxQueueLen;
+    uint16_t txQueueLen;
+    CanAcceptance acceptance;
+};
+
+enum CanBusState : uint8_t {
+    CAN_BUS_STOPPED = 0,
+    CAN_BUS_ACTIVE,
+    CAN_BUS_PASSIVE,      // error passive: TEC or REC over 127
+    CAN_BUS_OFF,
+    CAN_BUS_RECOVERING
+};
+
+struct CanDriverStats {
+    CanBusState state;
+    uint8_t txErrorCounter;
+    uint8_t rxErrorCounter;
+    uint16_t txQueued;         // frames in the driver TX queue right now
+    uint16_t rxQueued;         // frames in the driver RX queue right now
+    uint16_t rxQueueHighWater; // sampled by canDriverService()
+    uint32_t received;
+    uint32_t transmitted;
+    uint32_t txFailed;         // refused or timed out in canDriverTransmit
+    uint32_t rxMissed;         // driver RX queue full
+    uint32_t rxOverrun;        // controller FIFO overrun
+    uint32_t arbLost;
+    uint32_t busErrors;
+    uint32_t errorPassiveEvents;
+    uint32_t busOffEvents;
+    uint32_t recoveries;
+};
+
+bool canDriverBegin(const CanDriverConfig& config);
+
+// Swap the acceptance filter while running. On TWAI this reinstalls the
+// driver, so frames already in its RX queue are lost; call it from the main
+// loop and only when the wanted set actually changed.
+bool canDriverSetAcceptance(const CanAcceptance& acceptance);
+
+// Block up to timeoutMs (UINT32_MAX = forever). Safe from one RX task and
+// one TX task at the same time.
+bool canDriverReceive(CanDriverFrame& out, uint32_t timeoutMs);
+bool canDriverTransmit(const CanDriverFrame& frame, uint32_t timeoutMs);
+
+// Call often from the main loop: reads alerts, counts them and brings the
+// controller back after bus-off.
+void canDriverService();
+
+CanDriverStats canDriverStats();
+const char* canBusStateName(CanBusState state);
+void canDriverPrintStats();
@@ -0,0 +1,168 @@
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include "can_driver.h"
+
+#include <atomic>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+// Host backend for soak runs and benchmarks, e.g.
+//   ip link add dev vcan0 type vcan && ip link set up vcan0
+//   canplayer -I candumps/<drive>.log vcan0=can0 &
+// There is no controller behind vcan, so error counters and bus state stay
+// at "active" and only the socket's own drop counter is real.
+
+namespace {
+
+int sock = -1;
+bool running = false;
+std::atomic<uint32_t> received{0};
+std::atomic<uint32_t> transmitted{0};
+std::atomic<uint32_t> txFailed{0};
+std::atomic<uint32_t> rxMissed{0};  // SO_RXQ_OVFL: dropped because the socket buffer was full
+
+uint32_t monotonicUs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000);
+}
+
+bool waitFor(short events, uint32_t timeoutMs) {
+    pollfd p = {sock, events, 0};
+    const int ms = timeoutMs == UINT32_MAX ? -1 : (int)timeoutMs;
+    return poll(&p, 1, ms) > 0 && (p.revents & events);
+}
+
+void applyFilter(const CanAcceptance& a) {
+    can_filter filters[CAN_DRIVER_MAX_FILTERS] = {};  // one zero filter = accept all
+    uint8_t n = 1;
+    if (a.count > 0) {
+        n = a.count > CAN_DRIVER_MAX_FILTERS ? CAN_DRIVER_MAX_FILTERS : a.count;
+        for (uint8_t i = 0; i < n; i++) {
+            filters[i].can_id = a.id[i];
+            filters[i].can_mask = a.mask[i] | CAN_EFF_FLAG;  // standard frames only, like TWAI
+        }
+    }
+    setsockopt(sock, SOL_CAN_RAW, CAN_RAW_FILTER, filters, sizeof(can_filter) * n);
+}
+
+} // namespace
+
+bool canDriverBegin(const CanDriverConfig& config) {
+    const char* ifname = config.interface ? config.interface : "vcan0";
+    sock = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (sock < 0) return false;
+
+    ifreq ifr = {};
+    strncpy(ifr.ifr_name, ifname, IFNAMSIZ - 1);
+    if (ioctl(sock, SIOCGIFINDEX, &ifr) < 0) {
+        close(sock);
+        sock = -1;
+        return false;
+    }
+
+    applyFilter(config.acceptance);
+    const int on = 1;
+    setsockopt(sock, SOL_SOCKET, SO_RXQ_OVFL, &on, sizeof(on));
+    if (config.rxQueueLen > 0) {
+        const int bytes = config.rxQueueLen * (int)sizeof(can_frame) * 2;
+        setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &bytes, sizeof(bytes));
+    }
+
+    sockaddr_can addr = {};
+    addr.can_family = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (bind(sock, (sockaddr*)&addr, sizeof(addr)) < 0) {
+        close(sock);
+        sock = -1;
+        return false;
+    }
+    running = true;
+    return true;
+}
+
+bool canDriverSetAcceptance(const CanAcceptance& acceptance) {
+    if (sock < 0) return false;
+    applyFilter(acceptance);
+    return true;
+}
+
+bool canDriverReceive(CanDriverFrame& out, uint32_t timeoutMs) {
+    if (!running || !waitFor(POLLIN, timeoutMs)) return false;
+
+    can_frame cf;
+    char control[CMSG_SPACE(sizeof(uint32_t))];
+    iovec iov = {&cf, sizeof(cf)};
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    if (recvmsg(sock, &msg, MSG_DONTWAIT) != (ssize_t)sizeof(cf)) return false;
+
+    for (cmsghdr* c = CMSG_FIRSTHDR(&msg); c != nullptr; c = CMSG_NXTHDR(&msg, c)) {
+        if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SO_RXQ_OVFL) {
+            uint32_t drops;
+            memcpy(&drops, CMSG_DATA(c), sizeof(drops));
+            rxMissed.store(drops, std::memory_order_relaxed);  // running total from the kernel
+        }
+    }
+
+    out.us = monotonicUs();
+    out.extended = (cf.can_id & CAN_EFF_FLAG) != 0;
+    out.rtr = (cf.can_id & CAN_RTR_FLAG) != 0;
+    out.id = cf.can_id & (out.extended ? CAN_EFF_MASK : CAN_SFF_MASK);
+    out.length = cf.can_dlc > 8 ? 8 : cf.can_dlc;
+    memcpy(out.data, cf.data, out.length);
+    received.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool canDriverTransmit(const CanDriverFrame& frame, uint32_t timeoutMs) {
+    can_frame cf = {};
+    cf.can_id = frame.id | (frame.extended ? CAN_EFF_FLAG : 0) | (frame.rtr ? CAN_RTR_FLAG : 0);
+    cf.can_dlc = frame.length > 8 ? 8 : frame.length;
+    memcpy(cf.data, frame.data, cf.can_dlc);
+
+    bool ok = running && waitFor(POLLOUT, timeoutMs) &&
+              write(sock, &cf, sizeof(cf)) == (ssize_t)sizeof(cf);
+    if (!ok) {
+        txFailed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    transmitted.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void canDriverService() {}
+
+CanDriverStats canDriverStats() {
+    CanDriverStats s = {};
+    s.state = running ? CAN_BUS_ACTIVE : CAN_BUS_STOPPED;
+    s.received = received.load(std::memory_order_relaxed);
+    s.transmitted = transmitted.load(std::memory_order_relaxed);
+    s.txFailed = txFailed.load(std::memory_order_relaxed);
+    s.rxMissed = rxMissed.load(std::memory_order_relaxed);
+    return s;
+}
+
+const char* canBusStateName(CanBusState s) {
+    return s == CAN_BUS_STOPPED ? "stopped" : "active";
+}
+
+void canDriverPrintStats() {
+    const CanDriverStats s = canDriverStats();
+    printf("SocketCAN %s rx=%lu tx=%lu tx_failed=%lu dropped=%lu\n",
+           canBusStateName(s.state), (unsigned long)s.received,
+           (unsigned long)s.transmitted, (unsigned long)s.txFailed, (unsigned long)s.rxMissed);
+}
+
+#endif // __linux__ && !ARDUINO
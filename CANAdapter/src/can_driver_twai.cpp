@@ -0,0 +1,240 @@
+#ifdef ARDUINO
+
+#include "can_driver.h"
+
+#include <Arduino.h>
+#include <atomic>
+#include <driver/twai.h>
+
+namespace {
+
+constexpr uint32_t ALERTS = TWAI_ALERT_ERR_PASS | TWAI_ALERT_ERR_ACTIVE |
+                            TWAI_ALERT_BUS_OFF | TWAI_ALERT_BUS_RECOVERED;
+constexpr uint32_t RECEIVE_SLICE_MS = 50;  // bounds how long a filter swap waits on the RX task
+
+CanDriverConfig active = {};
+bool running = false;
+CanBusState state = CAN_BUS_STOPPED;
+
+// The RX and TX tasks hold a "user" reference around every twai_* call; a
+// filter swap raises `swapping` and waits for users to drain before
+// uninstalling. Increment-then-check on both sides, so neither can miss the
+// other.
+std::atomic<int> users{0};
+std::atomic<bool> swapping{false};
+
+// received is only written by the RX task, transmitted/txFailed only by the
+// TX task, the rest only by canDriverService().
+volatile uint32_t received = 0;
+volatile uint32_t transmitted = 0;
+volatile uint32_t txFailed = 0;
+uint32_t errorPassiveEvents = 0;
+uint32_t busOffEvents = 0;
+uint32_t recoveries = 0;
+uint16_t rxQueueHighWater = 0;
+
+inline TickType_t toTicks(uint32_t ms) {
+    return ms == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(ms);
+}
+
+bool enterDriver() {
+    users.fetch_add(1);
+    if (!swapping.load()) return true;
+    users.fetch_sub(1);
+    return false;
+}
+
+inline void leaveDriver() { users.fetch_sub(1); }
+
+twai_timing_config_t timingFor(uint32_t bitrate) {
+    switch (bitrate) {
+        case 125000: return TWAI_TIMING_CONFIG_125KBITS();
+        case 250000: return TWAI_TIMING_CONFIG_250KBITS();
+        case 1000000: return TWAI_TIMING_CONFIG_1MBITS();
+        default: return TWAI_TIMING_CONFIG_500KBITS();
+    }
+}
+
+// Standard frames only. Mask bits set in the TWAI registers mean "don't care",
+// the opposite of CanAcceptance.
+//   single: ID in 31..21, RTR 20, data bytes 0/1 in 15..0
+//   dual:   filter 1 ID in 31..21, filter 2 ID in 15..5; RTR and the data
+//           nibbles filter 1 also compares are left as don't care
+twai_filter_config_t filterFor(const CanAcceptance& a) {
+    twai_filter_config_t f = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+    if (a.count == 1) {
+        f.acceptance_code = (uint32_t)(a.id[0] & 0x7FF) << 21;
+        f.acceptance_mask = ((uint32_t)(~a.mask[0] & 0x7FF) << 21) | 0x001FFFFF;
+        f.single_filter = true;
+    } else if (a.count >= 2) {
+        f.acceptance_code = ((uint32_t)(a.id[0] & 0x7FF) << 21) | ((uint32_t)(a.id[1] & 0x7FF) << 5);
+        f.acceptance_mask = ((uint32_t)(~a.mask[0] & 0x7FF) << 21) | 0x001F0000 |
+                            ((uint32_t)(~a.mask[1] & 0x7FF) << 5) | 0x0000001F;
+        f.single_filter = false;
+    }
+    return f;
+}
+
+bool install(const CanDriverConfig& config) {
+    twai_general_config_t g = TWAI_GENERAL_CONFIG_DEFAULT((gpio_num_t)config.txPin,
+                                                          (gpio_num_t)config.rxPin, TWAI_MODE_NORMAL);
+    g.rx_queue_len = config.rxQueueLen;
+    g.tx_queue_len = config.txQueueLen;
+    g.alerts_enabled = ALERTS;
+    const twai_timing_config_t t = timingFor(config.bitrate);
+    const twai_filter_config_t f = filterFor(config.acceptance);
+
+    if (twai_driver_install(&g, &t, &f) != ESP_OK) return false;
+    if (twai_start() != ESP_OK) return false;
+    state = CAN_BUS_ACTIVE;
+    return true;
+}
+
+} // namespace
+
+bool canDriverBegin(const CanDriverConfig& config) {
+    active = config;
+    running = install(active);
+    return running;
+}
+
+bool canDriverSetAcceptance(const CanAcceptance& acceptance) {
+    active.acceptance = acceptance;
+    if (!running) return false;
+
+    swapping.store(true);
+    while (users.load() != 0) vTaskDelay(1);
+    twai_stop();
+    twai_driver_uninstall();
+    running = install(active);
+    if (!running) state = CAN_BUS_STOPPED;
+    swapping.store(false);
+    return running;
+}
+
+bool canDriverReceive(CanDriverFrame& out, uint32_t timeoutMs) {
+    twai_message_t msg;
+    // Wait in slices so a filter swap never has to wait on a forever-blocked task.
+    for (;;) {
+        const uint32_t sliceMs = timeoutMs < RECEIVE_SLICE_MS ? timeoutMs : RECEIVE_SLICE_MS;
+        bool got = false;
+        if (enterDriver()) {
+            got = twai_receive(&msg, toTicks(sliceMs)) == ESP_OK;
+            leaveDriver();
+        } else {
+            vTaskDelay(1);
+        }
+        if (got) break;
+        if (timeoutMs != UINT32_MAX) {
+            if (timeoutMs <= sliceMs) return false;
+            timeoutMs -= sliceMs;
+        }
+    }
+    out.us = (uint32_t)esp_timer_get_time();
+    out.id = msg.identifier;
+    out.extended = msg.extd;
+    out.rtr = msg.rtr;
+    out.length = msg.data_length_code > 8 ? 8 : msg.data_length_code;
+    memcpy(out.data, msg.data, out.length);
+    received++;
+    return true;
+}
+
+bool canDriverTransmit(const CanDriverFrame& frame, uint32_t timeoutMs) {
+    twai_message_t msg = {};
+    msg.identifier = frame.id;
+    msg.extd = frame.extended ? 1 : 0;
+    msg.rtr = frame.rtr ? 1 : 0;
+    msg.data_length_code = frame.length > 8 ? 8 : frame.length;
+    memcpy(msg.data, frame.data, msg.data_length_code);
+
+    bool sent = false;
+    if (enterDriver()) {
+        sent = twai_transmit(&msg, toTicks(timeoutMs)) == ESP_OK;
+        leaveDriver();
+    }
+    if (!sent) {
+        txFailed++;  // includes frames offered mid filter swap
+        return false;
+    }
+    transmitted++;
+    return true;
+}
+
+void canDriverService() {
+    if (!running) return;
+
+    twai_status_info_t info;
+    if (twai_get_status_info(&info) == ESP_OK && info.msgs_to_rx > rxQueueHighWater) {
+        rxQueueHighWater = info.msgs_to_rx;
+    }
+
+    uint32_t alerts = 0;
+    if (twai_read_alerts(&alerts, 0) != ESP_OK) return;
+    if (alerts & TWAI_ALERT_ERR_PASS) {
+        errorPassiveEvents++;
+        state = CAN_BUS_PASSIVE;
+    }
+    if (alerts & TWAI_ALERT_ERR_ACTIVE) state = CAN_BUS_ACTIVE;
+    // Bus-off needs an explicit recovery (128 x 11 recessive bits) and then a
+    // restart; queued TX frames are lost either way.
+    if (alerts & TWAI_ALERT_BUS_OFF) {
+        busOffEvents++;
+        state = CAN_BUS_RECOVERING;
+        twai_initiate_recovery();
+    }
+    if (alerts & TWAI_ALERT_BUS_RECOVERED) {
+        recoveries++;
+        if (twai_start() == ESP_OK) state = CAN_BUS_ACTIVE;
+        else state = CAN_BUS_STOPPED;
+    }
+}
+
+CanDriverStats canDriverStats() {
+    CanDriverStats s = {};
+    s.state = state;
+    s.rxQueueHighWater = rxQueueHighWater;
+    s.received = received;
+    s.transmitted = transmitted;
+    s.txFailed = txFailed;
+    s.errorPassiveEvents = errorPassiveEvents;
+    s.busOffEvents = busOffEvents;
+    s.recoveries = recoveries;
+    twai_status_info_t info;
+    if (twai_get_status_info(&info) == ESP_OK) {
+        if (info.state == TWAI_STATE_BUS_OFF) s.state = CAN_BUS_OFF;
+        s.txErrorCounter = info.tx_error_counter > 255 ? 255 : info.tx_error_counter;
+        s.rxErrorCounter = info.rx_error_counter > 255 ? 255 : info.rx_error_counter;
+        s.txQueued = info.msgs_to_tx;
+        s.rxQueued = info.msgs_to_rx;
+        s.rxMissed = info.rx_missed_count;
+        s.rxOverrun = info.rx_overrun_count;
+        s.arbLost = info.arb_lost_count;
+        s.busErrors = info.bus_error_count;
+    }
+    return s;
+}
+
+const char* canBusStateName(CanBusState s) {
+    switch (s) {
+        case CAN_BUS_ACTIVE: return "active";
+        case CAN_BUS_PASSIVE: return "passive";
+        case CAN_BUS_OFF: return "bus-off";
+        case CAN_BUS_RECOVERING: return "recovering";
+        default: return "stopped";
+    }
+}
+
+void canDriverPrintStats() {
+    const CanDriverStats s = canDriverStats();
+    Serial.printf("TWAI %s tec=%u rec=%u rxq=%u (high %u) txq=%u rx=%lu tx=%lu tx_failed=%lu\n",
+                  canBusStateName(s.state), s.txErrorCounter, s.rxErrorCounter,
+                  s.rxQueued, s.rxQueueHighWater, s.txQueued,
+                  (unsigned long)s.received, (unsigned long)s.transmitted, (unsigned long)s.txFailed);
+    Serial.printf("  missed=%lu overrun=%lu arb_lost=%lu bus_err=%lu err_passive=%lu bus_off=%lu recovered=%lu\n",
+                  (unsigned long)s.rxMissed, (unsigned long)s.rxOverrun, (unsigned long)s.arbLost,
+                  (unsigned long)s.busErrors, (unsigned long)s.errorPassiveEvents,
+                  (unsigned long)s.busOffEvents, (unsigned long)s.recoveries);
+}
+
+#endif // ARDUINO
@@ -0,0 +1,165 @@
+#include "can_filter.h"
+
+#include "bus_profile.h"
+
+namespace {
+
+constexpr uint16_t ID_MASK = 0x7FF;
+constexpr uint8_t EXHAUSTIVE_MAX_IDS = 12;  // 2^11 splits
+
+struct Pattern {
+    uint16_t code;
+    uint16_t mask;  // bits set = must match
+    bool used;
+};
+
+struct Cost {
+    uint32_t unwantedDeciHz;
+    uint16_t acceptedIds;
+};
+
+// Tightest code/mask covering every ID picked by sel (bit i = ids[i]).
+Pattern cover(const uint16_t* ids, uint8_t count, uint32_t sel) {
+    Pattern p = {0, ID_MASK, false};
+    uint16_t first = 0, diff = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (!(sel & (1UL << i))) continue;
+        if (!p.used) {
+            first = ids[i];
+            p.used = true;
+        }
+        diff |= ids[i] ^ first;
+    }
+    p.mask = (uint16_t)(~diff & ID_MASK);
+    p.code = first & p.mask;
+    return p;
+}
+
+inline bool matches(const Pattern& p, uint16_t id) {
+    return p.used && ((id ^ p.code) & p.mask) == 0;
+}
+
+inline uint16_t patternSize(const Pattern& p) {
+    return p.used ? (uint16_t)(1U << __builtin_popcount(~p.mask & ID_MASK)) : 0;
+}
+
+bool isWanted(const uint16_t* ids, uint8_t count, uint16_t id) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (ids[i] == id) return true;
+    }
+    return false;
+}
+
+// Profile entries for IDs nobody asked for, rebuilt per plan.
+BusProfileEntry unwanted[BUS_PROFILE_COUNT];
+uint16_t unwantedCount = 0;
+
+Cost costOf(const Pattern& a, const Pattern& b) {
+    Cost c = {0, 0};
+    for (uint16_t i = 0; i < unwantedCount; i++) {
+        if (matches(a, unwanted[i].id) || matches(b, unwanted[i].id)) c.unwantedDeciHz += unwanted[i].deciHz;
+    }
+    uint16_t overlap = 0;
+    if (a.used && b.used && ((a.code ^ b.code) & a.mask & b.mask) == 0) {
+        overlap = (uint16_t)(1U << __builtin_popcount(~(a.mask | b.mask) & ID_MASK));
+    }
+    c.acceptedIds = patternSize(a) + patternSize(b) - overlap;
+    return c;
+}
+
+inline bool cheaper(const Cost& x, const Cost& y) {
+    return x.unwantedDeciHz < y.unwantedDeciHz ||
+           (x.unwantedDeciHz == y.unwantedDeciHz && x.acceptedIds < y.acceptedIds);
+}
+
+} // namespace
+
+CanFilterPlan canFilterPlan(const uint16_t* ids, uint8_t count) {
+    CanFilterPlan plan = {};
+    if (count == 0 || count > 32) { // nothing to narrow down to: accept everything
+        plan.acceptedIds = ID_MASK + 1;
+        for (const BusProfileEntry& e : busProfile) plan.unwantedDeciHz += e.deciHz;
+        return plan;
+    }
+
+    unwantedCount = 0;
+    for (const BusProfileEntry& e : busProfile) {
+        if (!isWanted(ids, count, e.id)) unwanted[unwantedCount++] = e;
+    }
+
+    const uint32_t all = count == 32 ? 0xFFFFFFFFUL : (1UL << count) - 1;
+    Pattern bestA = cover(ids, count, all);
+    Pattern bestB = {0, ID_MASK, false};
+    Cost best = costOf(bestA, bestB);
+
+    auto consider = [&](uint32_t sel) {
+        sel &= all;
+        if (sel == 0 || sel == all) return;
+        const Pattern a = cover(ids, count, sel);
+        const Pattern b = cover(ids, count, all & ~sel);
+        const Cost c = costOf(a, b);
+        if (cheaper(c, best)) {
+            best = c;
+            bestA = a;
+            bestB = b;
+        }
+    };
+
+    if (count <= EXHAUSTIVE_MAX_IDS) {
+        // The last ID always lands in group B, so each split is tried once.
+        for (uint32_t sel = 1; sel < (1UL << (count - 1)); sel++) consider(sel);
+    } else {
+        // Too many to try every split: split on each ID bit, and at each
+        // point of the sorted order.
+        for (uint8_t bit = 0; bit < 11; bit++) {
+            uint32_t sel = 0;
+            for (uint8_t i = 0; i < count; i++) {
+                if (ids[i] & (1U << bit)) sel |= 1UL << i;
+            }
+            consider(sel);
+        }
+        for (uint8_t i = 0; i < count; i++) {
+            uint32_t sel = 0;
+            for (uint8_t j = 0; j < count; j++) {
+                if (ids[j] <= ids[i]) sel |= 1UL << j;
+            }
+            consider(sel);
+        }
+    }
+
+    plan.acceptance.count = bestB.used ? 2 : 1;
+    plan.acceptance.id[0] = bestA.code;
+    plan.acceptance.mask[0] = bestA.mask;
+    plan.acceptance.id[1] = bestB.code;
+    plan.acceptance.mask[1] = bestB.mask;
+    plan.acceptedIds = best.acceptedIds;
+    plan.unwantedDeciHz = best.unwantedDeciHz;
+    for (const BusProfileEntry& e : busProfile) {
+        if (matches(bestA, e.id) || matches(bestB, e.id)) {
+            if (isWanted(ids, count, e.id)) plan.wantedDeciHz += e.deciHz;
+        } else {
+            plan.rejectedDeciHz += e.deciHz;
+            plan.rejectedBitsPerSec += (uint32_t)e.deciHz * e.bits / 10;
+        }
+    }
+    return plan;
+}
+
+void canFilterPrintPlan(const CanFilterPlan& plan) {
+    const CanAcceptance& a = plan.acceptance;
+    if (a.count == 0) {
+        Serial.println("CAN filter: accept all");
+    } else {
+        Serial.printf("CAN filter: %s", a.count == 1 ? "single" : "dual");
+        for (uint8_t i = 0; i < a.count; i++) {
+            Serial.printf(" [%03X/%03X]", a.id[i], a.mask[i]);
+        }
+        Serial.println();
+    }
+    Serial.printf("  lets through %u IDs; profile: wanted %lu.%lu Hz, unwanted %lu.%lu Hz, "
+                  "hw rejects %lu.%lu Hz\n",
+                  plan.acceptedIds,
+                  (unsigned long)(plan.wantedDeciHz / 10), (unsigned long)(plan.wantedDeciHz % 10),
+                  (unsigned long)(plan.unwantedDeciHz / 10), (unsigned long)(plan.unwantedDeciHz % 10),
+                  (unsigned long)(plan.rejectedDeciHz / 10), (unsigned long)(plan.rejectedDeciHz % 10));
+}
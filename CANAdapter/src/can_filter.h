@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "can_driver.h"
+
+// Works out the TWAI acceptance filters for a set of wanted 11-bit IDs. TWAI
+// gives us at most two code/mask pairs, so most sets can't be matched
+// exactly; the planner picks the split into two groups that lets through the
+// least unwanted traffic according to the recorded bus profile (bus_profile.h),
+// and the fewest extra IDs as a tie-break. Whatever still slips through is
+// dropped by can_rx's watch check.
+
+struct CanFilterPlan {
+    CanAcceptance acceptance;
+    uint16_t acceptedIds;      // distinct 11-bit IDs the hardware lets through
+    uint32_t wantedDeciHz;     // profiled traffic we asked for
+    uint32_t unwantedDeciHz;   // profiled traffic let through anyway
+    uint32_t rejectedDeciHz;   // profiled traffic the hardware drops
+    uint32_t rejectedBitsPerSec; // ...and its bits on the wire, for the bus-load estimate
+};
+
+CanFilterPlan canFilterPlan(const uint16_t* ids, uint8_t count);
+void canFilterPrintPlan(const CanFilterPlan& plan);
@@ -0,0 +1,188 @@
+#include "can_id_stats.h"
+
+namespace {
+
+constexpr uint16_t EMPTY_ID = 0xFFFF;
+
+// One P-square quantile estimator: five markers whose heights track the
+// minimum, p/2, p, (1+p)/2 and maximum of everything seen so far.
+struct P2Quantile {
+    float q[5];    // marker heights
+    int32_t n[5];  // marker positions, 1-based
+    uint32_t count;
+
+    void add(float x, float p) {
+        if (count < 5) {
+            // Insertion sort the first five; they become the markers.
+            uint8_t i = (uint8_t)count;
+            for (; i > 0 && q[i - 1] > x; i--) q[i] = q[i - 1];
+            q[i] = x;
+            n[count] = (int32_t)count + 1;
+            count++;
+            return;
+        }
+
+        uint8_t k;
+        if (x < q[0]) {
+            q[0] = x;
+            k = 0;
+        } else if (x >= q[4]) {
+            q[4] = x;
+            k = 3;
+        } else {
+            k = 0;
+            while (k < 3 && x >= q[k + 1]) k++;
+        }
+        for (uint8_t i = k + 1; i < 5; i++) n[i]++;
+        count++;
+
+        // Desired positions for N samples: 1 + (N - 1) * {0, p/2, p, (1+p)/2, 1}.
+        const float span = (float)(count - 1);
+        const float want[3] = {1 + span * p / 2, 1 + span * p, 1 + span * (1 + p) / 2};
+        for (uint8_t i = 1; i <= 3; i++) {
+            const float d = want[i - 1] - n[i];
+            if ((d >= 1 && n[i + 1] - n[i] > 1) || (d <= -1 && n[i - 1] - n[i] < -1)) {
+                const int32_t s = d >= 0 ? 1 : -1;
+                const float qp = parabolic(i, s);
+                q[i] = (q[i - 1] < qp && qp < q[i + 1]) ? qp : linear(i, s);
+                n[i] += s;
+            }
+        }
+    }
+
+    float parabolic(uint8_t i, int32_t s) const {
+        const float up = (float)(n[i] - n[i - 1] + s) * (q[i + 1] - q[i]) / (float)(n[i + 1] - n[i]);
+        const float down = (float)(n[i + 1] - n[i] - s) * (q[i] - q[i - 1]) / (float)(n[i] - n[i - 1]);
+        return q[i] + (float)s / (float)(n[i + 1] - n[i - 1]) * (up + down);
+    }
+
+    float linear(uint8_t i, int32_t s) const {
+        return q[i] + (float)s * (q[i + s] - q[i]) / (float)(n[i + s] - n[i]);
+    }
+
+    float value() const { return count < 5 ? 0 : q[2]; }
+};
+
+struct Slot {
+    CanIdStats stats;
+    uint8_t first[8];          // per byte, from the first frame that carried it
+    uint8_t seen;              // bit i: first[i] is set
+    P2Quantile median;
+    P2Quantile p95;
+};
+
+Slot slots[CAN_ID_STATS_MAX];
+bool started = false;
+
+Slot* slotFor(uint16_t id, bool claim) {
+    if (!started) {
+        for (Slot& s : slots) s.stats.id = EMPTY_ID;
+        started = true;
+    }
+    uint8_t i = (uint8_t)(id % CAN_ID_STATS_MAX);
+    for (uint8_t n = 0; n < CAN_ID_STATS_MAX; n++) {
+        Slot& s = slots[i];
+        if (s.stats.id == id) return &s;
+        if (s.stats.id == EMPTY_ID) {
+            if (!claim) return nullptr;
+            s = {};
+            s.stats.id = id;
+            return &s;
+        }
+        i = (uint8_t)((i + 1) % CAN_ID_STATS_MAX);
+    }
+    return nullptr;
+}
+
+void addInterval(Slot& slot, uint32_t interval) {
+    CanIdStats& s = slot.stats;
+    if (s.count == 2 || interval < s.minIntervalUs) s.minIntervalUs = interval;
+    if (interval > s.maxIntervalUs) s.maxIntervalUs = interval;
+    s.intervalSumUs += interval;
+
+    // Judge the gap against the median before this interval moves it.
+    if (s.medianUs != 0 && interval * 2 > s.medianUs * 3) {
+        s.dropped += (interval + s.medianUs / 2) / s.medianUs - 1;
+    }
+    slot.median.add((float)interval, 0.5f);
+    slot.p95.add((float)interval, 0.95f);
+    if (s.count > CAN_ID_STATS_MIN_INTERVALS) {
+        s.medianUs = (uint32_t)slot.median.value();
+        s.p95Us = (uint32_t)slot.p95.value();
+    }
+}
+
+} // namespace
+
+void canIdStatsOnFrame(const CanDriverFrame& frame, uint32_t us) {
+    if (frame.extended || frame.id > 0x7FF) return;
+    Slot* slot = slotFor((uint16_t)frame.id, true);
+    if (slot == nullptr) return;
+    CanIdStats& s = slot->stats;
+    const uint8_t len = frame.length > 8 ? 8 : frame.length;
+
+    s.count++;
+    s.dlcMask |= (uint16_t)(1u << len);
+    if (s.count == 1) {
+        s.firstUs = us;
+    } else {
+        addInterval(*slot, us - s.lastUs);
+    }
+    s.lastUs = us;
+
+    for (uint8_t i = 0; i < len; i++) {
+        const uint8_t b = frame.data[i];
+        // A byte a shorter DLC left out starts from its own first value.
+        if (!(slot->seen & (1u << i))) {
+            slot->seen |= (uint8_t)(1u << i);
+            slot->first[i] = b;
+            s.byteMin[i] = b;
+            s.byteMax[i] = b;
+            continue;
+        }
+        if (b < s.byteMin[i]) s.byteMin[i] = b;
+        if (b > s.byteMax[i]) s.byteMax[i] = b;
+        s.changedBits[i] |= (uint8_t)(b ^ slot->first[i]);
+    }
+}
+
+const CanIdStats* canIdStats(uint16_t id) {
+    const Slot* slot = slotFor(id, false);
+    return slot ? &slot->stats : nullptr;
+}
+
+bool canIdStatsPeriodic(const CanIdStats& s) {
+    return s.medianUs != 0 && s.p95Us <= s.medianUs * 2;
+}
+
+bool canIdStatsSilent(uint16_t id, uint32_t nowUs) {
+    const CanIdStats* s = canIdStats(id);
+    if (s == nullptr || !canIdStatsPeriodic(*s)) return false;
+    return nowUs - s->lastUs > s->p95Us + (uint32_t)CAN_ID_STATS_SILENT_MEDIANS * s->medianUs;
+}
+
+void canIdStatsPrint(uint32_t nowUs) {
+    Serial.println("id    count  dlc    mean_us  med_us  p95_us  min_us  max_us drops  age_ms  bytes / changing bits");
+    for (const Slot& slot : slots) {
+        const CanIdStats& s = slot.stats;
+        if (s.id == EMPTY_ID || s.count == 0) continue;
+        const uint32_t mean = s.count > 1 ? (uint32_t)(s.intervalSumUs / (s.count - 1)) : 0;
+        uint8_t maxLen = 0;
+        char dlcs[10] = {0};
+        uint8_t d = 0;
+        for (uint8_t len = 0; len <= 8; len++) {
+            if (!(s.dlcMask & (1u << len))) continue;
+            dlcs[d++] = (char)('0' + len);
+            maxLen = len;
+        }
+        Serial.printf("%03X %8lu  %-4s %8lu %7lu %7lu %7lu %7lu %5lu %7lu%s ", s.id, (unsigned long)s.count,
+                      dlcs, (unsigned long)mean, (unsigned long)s.medianUs, (unsigned long)s.p95Us,
+                      (unsigned long)s.minIntervalUs, (unsigned long)s.maxIntervalUs,
+                      (unsigned long)s.dropped, (unsigned long)((nowUs - s.lastUs) / 1000),
+                      canIdStatsSilent(s.id, nowUs) ? " SILENT" : "");
+        for (uint8_t i = 0; i < maxLen; i++) Serial.printf(" %02X-%02X", s.byteMin[i], s.byteMax[i]);
+        Serial.print(" /");
+        for (uint8_t i = 0; i < maxLen; i++) Serial.printf(" %02X", s.changedBits[i]);
+        Serial.println();
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "can_driver.h"
+
+// Live per-ID statistics for the frames loop() takes off the RX ring: the
+// same figures analysis/can_log_analyzer.py's IdStats gives for a capture
+// (count, DLCs, interval mean / median / p95, byte ranges, changing bits),
+// kept in fixed memory. The interval median and p95 are streaming P-square
+// estimates (Jain & Chlamtac), five markers each, so nothing is stored per
+// frame. Intervals use the driver receive time, not loop() time.
+//
+// A periodic ID (enough intervals, p95 within twice the median) that has
+// gone quiet for SILENT_MEDIANS medians past its p95 is silent; gaps of more
+// than 1.5 medians between frames are counted as dropped frames. IDs that are
+// sent on change never look periodic, so they are never silent.
+//
+// loop() only; one slot per ID, the first CAN_ID_STATS_MAX IDs seen.
+
+constexpr uint8_t CAN_ID_STATS_MAX = 32;
+constexpr uint16_t CAN_ID_STATS_MIN_INTERVALS = 32;  // before the sketches count
+constexpr uint8_t CAN_ID_STATS_SILENT_MEDIANS = 3;
+
+struct CanIdStats {
+    uint16_t id;
+    uint32_t count;
+    uint16_t dlcMask;          // bit n: DLC n seen
+    uint32_t firstUs;
+    uint32_t lastUs;
+    uint32_t minIntervalUs;
+    uint32_t maxIntervalUs;
+    uint64_t intervalSumUs;
+    uint32_t medianUs;         // 0 until CAN_ID_STATS_MIN_INTERVALS
+    uint32_t p95Us;
+    uint32_t dropped;          // estimated frames missing from gaps
+    uint8_t byteMin[8];
+    uint8_t byteMax[8];
+    uint8_t changedBits[8];    // bits that differed from the first value of that byte
+};
+
+void canIdStatsOnFrame(const CanDriverFrame& frame, uint32_t us);
+
+// Null if the ID hasn't been seen (or didn't get a slot).
+const CanIdStats* canIdStats(uint16_t id);
+bool canIdStatsPeriodic(const CanIdStats& s);
+bool canIdStatsSilent(uint16_t id, uint32_t nowUs);
+
+void canIdStatsPrint(uint32_t nowUs);
@@ -0,0 +1,180 @@
+#include "can_rx.h"
+
+#include <atomic>
+
+#include "bus_load.h"
+#include "can_driver.h"
+#include "isotp_fc.h"
+
+namespace {
+
+static_assert((CAN_RX_RING_SIZE & (CAN_RX_RING_SIZE - 1)) == 0, "ring size must be a power of two");
+
+constexpr uint32_t TASK_STACK_BYTES = 4096;
+
+// The list feeds the filter planner; the RX task only looks at the bitmap,
+// which loop() updates a byte at a time underneath it.
+uint16_t watched[CAN_RX_MAX_WATCHED] = {0};
+uint8_t watchedCount = 0;
+volatile uint8_t watchedBits[2048 / 8] = {0};
+uint32_t watchOverflows = 0;
+bool filtersDirty = true;
+CanFilterPlan filterPlan = {};
+
+// SPSC ring: only the RX task moves head, only loop() moves tail.
+CanDriverFrame ring[CAN_RX_RING_SIZE];
+std::atomic<uint16_t> head{0};
+std::atomic<uint16_t> tail{0};
+
+// Producer-owned counters; loop() only reads them.
+volatile uint32_t received = 0;
+volatile uint32_t rejected = 0;
+volatile uint32_t queued = 0;
+volatile uint32_t ringOverflows = 0;
+volatile uint16_t ringHighWater = 0;
+volatile uint16_t maxBatch = 0;
+
+inline bool isWatched(const CanDriverFrame& msg) {
+    return !msg.extended && msg.id <= 0x7FF && (watchedBits[msg.id >> 3] & (1 << (msg.id & 7)));
+}
+
+// Loop side: what the hardware last got vs. what it let through since.
+unsigned long lastPrintMs = 0;
+uint32_t lastReceived = 0;
+uint32_t lastRejected = 0;
+
+void push(const CanDriverFrame& rx) {
+    const uint16_t h = head.load(std::memory_order_relaxed);
+    const uint16_t t = tail.load(std::memory_order_acquire);
+    const uint16_t used = (uint16_t)(h - t);
+    if (used >= CAN_RX_RING_SIZE) {
+        ringOverflows++;
+        return;
+    }
+
+    ring[h & (CAN_RX_RING_SIZE - 1)] = rx;
+    head.store((uint16_t)(h + 1), std::memory_order_release);
+    queued++;
+    if (used + 1 > ringHighWater) ringHighWater = used + 1;
+}
+
+void rxTask(void*) {
+    CanDriverFrame msg;
+    for (;;) {
+        if (!canDriverReceive(msg, UINT32_MAX)) continue;
+
+        // Drain everything the driver has before sleeping again.
+        uint16_t batch = 0;
+        do {
+            received++;
+            batch++;
+            busLoadOnRx(msg);
+            if (!isWatched(msg)) {
+                rejected++; // got past the hardware filter, dropped here
+                continue;
+            }
+            fcOnRxFrame(msg, msg.us); // FC before anything else touches the frame
+            push(msg);
+        } while (canDriverReceive(msg, 0));
+
+        if (batch > maxBatch) maxBatch = batch;
+    }
+}
+
+} // namespace
+
+void canRxWatch(uint32_t id) {
+    if (id > 0x7FF || (watchedBits[id >> 3] & (1 << (id & 7)))) return;
+    if (watchedCount >= CAN_RX_MAX_WATCHED) {
+        watchOverflows++;
+        return;
+    }
+    watched[watchedCount++] = (uint16_t)id;
+    watchedBits[id >> 3] |= (uint8_t)(1 << (id & 7));
+    filtersDirty = true;
+}
+
+void canRxUnwatch(uint32_t id) {
+    if (id > 0x7FF || !(watchedBits[id >> 3] & (1 << (id & 7)))) return;
+    watchedBits[id >> 3] &= (uint8_t)~(1 << (id & 7));
+    for (uint8_t i = 0; i < watchedCount; i++) {
+        if (watched[i] != id) continue;
+        watched[i] = watched[--watchedCount];
+        break;
+    }
+    filtersDirty = true;
+}
+
+bool canRxApplyFilters() {
+    if (!filtersDirty) return false;
+    filtersDirty = false;
+    filterPlan = canFilterPlan(watched, watchedCount);
+    canDriverSetAcceptance(filterPlan.acceptance);
+    busLoadSetUnseen(filterPlan.rejectedBitsPerSec);
+    canFilterPrintPlan(filterPlan);
+    return true;
+}
+
+const CanFilterPlan& canRxFilterPlan() {
+    return filterPlan;
+}
+
+bool canRxBegin() {
+    return xTaskCreatePinnedToCore(rxTask, "can_rx", TASK_STACK_BYTES, nullptr,
+                                   CAN_RX_TASK_PRIORITY, nullptr, CAN_RX_TASK_CORE) == pdPASS;
+}
+
+bool canRxPop(CanDriverFrame& out) {
+    const uint16_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return false;
+    out = ring[t & (CAN_RX_RING_SIZE - 1)];
+    tail.store((uint16_t)(t + 1), std::memory_order_release);
+    return true;
+}
+
+CanRxStats canRxStats() {
+    CanRxStats s = {};
+    s.received = received;
+    s.rejected = rejected;
+    s.queued = queued;
+    s.ringOverflows = ringOverflows;
+    s.ringHighWater = ringHighWater;
+    s.maxBatch = maxBatch;
+    const CanDriverStats d = canDriverStats();
+    s.driverRxMissed = d.rxMissed;
+    s.driverRxOverrun = d.rxOverrun;
+    s.watchOverflows = watchOverflows;
+    return s;
+}
+
+void canRxPrintStats() {
+    const CanRxStats s = canRxStats();
+    Serial.printf("CAN rx=%lu sw_rejected=%lu queued=%lu ring_overflow=%lu ring_high=%u/%u max_batch=%u "
+                  "drv_missed=%lu drv_overrun=%lu\n",
+                  (unsigned long)s.received, (unsigned long)s.rejected, (unsigned long)s.queued,
+                  (unsigned long)s.ringOverflows, s.ringHighWater, CAN_RX_RING_SIZE,
+                  s.maxBatch, (unsigned long)s.driverRxMissed, (unsigned long)s.driverRxOverrun);
+
+    // Frames per second since the last print. The hardware-rejected side
+    // can't be counted, so it comes from the bus profile.
+    const unsigned long now = millis();
+    const unsigned long elapsed = now - lastPrintMs;
+    if (lastPrintMs != 0 && elapsed > 0) {
+        const uint32_t in = s.received - lastReceived;
+        const uint32_t rej = s.rejected - lastRejected;
+        Serial.printf("  last %lums: accepted %lu/s (watched %lu/s, sw rejected %lu/s), "
+                      "hw rejected ~%lu/s\n",
+                      elapsed, (unsigned long)(in * 1000UL / elapsed),
+                      (unsigned long)((in - rej) * 1000UL / elapsed),
+                      (unsigned long)(rej * 1000UL / elapsed),
+                      (unsigned long)(filterPlan.rejectedDeciHz / 10));
+    }
+    if (s.watchOverflows != 0) {
+        Serial.printf("  watch list full (%u IDs): %lu watches refused\n", CAN_RX_MAX_WATCHED,
+                      (unsigned long)s.watchOverflows);
+    }
+    lastPrintMs = now;
+    lastReceived = s.received;
+    lastRejected = s.rejected;
+    canFilterPrintPlan(filterPlan);
+}
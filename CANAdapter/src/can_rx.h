@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "can_driver.h"
+#include "can_filter.h"
+
+// CAN receive path. A task pinned to core 0 blocks on can_driver, drains
+// every queued frame in one go (each stamped with driver receive time in
+// microseconds) and pushes the watched ones into a single-producer /
+// single-consumer ring that loop() drains. Diag first frames get their FC
+// from this task (isotp_fc) before they are even queued.
+//
+// The watched set also drives the controller's acceptance filter
+// (can_filter), so most unwanted broadcast traffic never reaches the task.
+
+constexpr uint16_t CAN_RX_RING_SIZE = 256;     // power of two
+constexpr uint8_t CAN_RX_MAX_WATCHED = 24;
+constexpr uint8_t CAN_RX_TASK_CORE = 0;        // loop() runs on core 1
+constexpr UBaseType_t CAN_RX_TASK_PRIORITY = 12;
+
+struct CanRxStats {
+    uint32_t received;         // frames taken from the driver (passed the hw filter)
+    uint32_t rejected;         // ...and then dropped by the watch check
+    uint32_t queued;           // watched frames pushed into the ring
+    uint32_t ringOverflows;    // ring full, frame dropped
+    uint16_t ringHighWater;
+    uint16_t maxBatch;         // most frames drained in one wakeup
+    uint32_t driverRxMissed;   // driver queue full
+    uint32_t driverRxOverrun;  // controller FIFO overrun
+    uint32_t watchOverflows;   // canRxWatch() refused, the watched set was full
+};
+
+// Only watched (standard) IDs reach the ring. The set can change at any time
+// from loop(); canRxApplyFilters() then re-plans the hardware filter if it
+// changed, and returns true if it did. Past CAN_RX_MAX_WATCHED IDs a watch
+// is refused and counted (watchOverflows), and that ID never arrives.
+void canRxWatch(uint32_t id);
+void canRxUnwatch(uint32_t id);
+bool canRxApplyFilters();
+const CanFilterPlan& canRxFilterPlan();
+
+bool canRxBegin();  // after canDriverBegin()
+
+bool canRxPop(CanDriverFrame& out);  // loop() side, never blocks; out.us is the receive time
+
+CanRxStats canRxStats();
+void canRxPrintStats();
@@ -0,0 +1,252 @@
+#include "can_tx.h"
+
+#include "bus_load.h"
+#include "can_driver.h"
+
+namespace {
+
+constexpr uint8_t QUEUE_DEPTH = 16;             // per class
+constexpr uint32_t DRIVER_BLOCK_MS = 10;
+constexpr uint32_t TASK_STACK_BYTES = 3072;
+constexpr uint32_t TOKEN = 1000;                // bucket counts milli-frames
+
+struct Shaping {
+    uint16_t ratePerSec;   // 0 = never throttled
+    uint8_t burst;
+    bool busScaled;        // rate follows busLoadTxScale()
+};
+
+// FC is never held back. Body commands come in short bursts from the window
+// group logic; PID traffic is mostly SFs with the odd multi-frame request;
+// keepalives only need a couple of frames per second. Only the traffic we
+// start on our own backs off when the bus is busy; a window command was
+// asked for by the driver.
+constexpr Shaping SHAPING[CAN_TX_CLASS_COUNT] = {
+    {0, 0, false},     // FC
+    {100, 8, false},   // BODY
+    {400, 8, true},    // PID
+    {10, 2, true},     // KEEPALIVE
+};
+
+constexpr const char* CLASS_NAMES[CAN_TX_CLASS_COUNT] = {"fc", "body", "pid", "keepalive"};
+
+struct PendingFrame {
+    uint32_t originUs;
+    CanDriverFrame msg;
+};
+
+struct ClassQueue {
+    PendingFrame frames[QUEUE_DEPTH];
+    uint8_t head;
+    uint8_t count;
+};
+
+// Queues and stats are shared by every producer and the TX task.
+portMUX_TYPE txMux = portMUX_INITIALIZER_UNLOCKED;
+ClassQueue queues[CAN_TX_CLASS_COUNT] = {};
+CanTxClassStats stats[CAN_TX_CLASS_COUNT] = {};
+TaskHandle_t txTaskHandle = nullptr;
+
+// Buckets are only touched by the TX task.
+uint32_t tokens[CAN_TX_CLASS_COUNT] = {0};
+uint32_t lastRefillUs = 0;
+
+// Frames per second a throttled class gets right now.
+uint32_t rateOf(uint8_t c) {
+    const Shaping& s = SHAPING[c];
+    if (!s.busScaled) return s.ratePerSec;
+    const uint32_t r = (uint32_t)s.ratePerSec * busLoadTxScale() / 1000;
+    return r > 0 ? r : 1;
+}
+
+void refill(uint32_t nowUs) {
+    const uint32_t elapsed = nowUs - lastRefillUs;
+    lastRefillUs = nowUs;
+    for (uint8_t c = 0; c < CAN_TX_CLASS_COUNT; c++) {
+        const Shaping& s = SHAPING[c];
+        if (s.ratePerSec == 0) continue;
+        const uint32_t cap = (uint32_t)s.burst * TOKEN;
+        const uint64_t add = (uint64_t)elapsed * rateOf(c) / 1000;
+        tokens[c] = (add >= cap - tokens[c]) ? cap : tokens[c] + (uint32_t)add;
+    }
+}
+
+inline bool hasToken(uint8_t c) {
+    return SHAPING[c].ratePerSec == 0 || tokens[c] >= TOKEN;
+}
+
+// How long until some throttled class with a waiting frame can go.
+TickType_t ticksUntilToken() {
+    uint32_t soonestUs = UINT32_MAX;
+    portENTER_CRITICAL(&txMux);
+    for (uint8_t c = 0; c < CAN_TX_CLASS_COUNT; c++) {
+        if (queues[c].count == 0 || hasToken(c)) continue;
+        const uint32_t us = (TOKEN - tokens[c]) * 1000 / rateOf(c);
+        if (us < soonestUs) soonestUs = us;
+    }
+    portEXIT_CRITICAL(&txMux);
+    const TickType_t ticks = pdMS_TO_TICKS(soonestUs / 1000);
+    return ticks > 0 ? ticks : 1;
+}
+
+void recordLatency(CanTxClassStats& s, uint32_t us) {
+    uint8_t bin = us == 0 ? 0 : (uint8_t)(31 - __builtin_clz(us));
+    if (bin >= CAN_TX_LATENCY_BINS) bin = CAN_TX_LATENCY_BINS - 1;
+    s.latency[bin]++;
+    s.latencySumUs += us;
+    if (us > s.maxLatencyUs) s.maxLatencyUs = us;
+}
+
+// Highest class with a frame and a token. *held is set if something is
+// waiting only on its bucket.
+bool takeNext(PendingFrame& out, uint8_t& cls, bool& held) {
+    held = false;
+    bool found = false;
+    portENTER_CRITICAL(&txMux);
+    for (uint8_t c = 0; c < CAN_TX_CLASS_COUNT; c++) {
+        ClassQueue& q = queues[c];
+        if (q.count == 0) continue;
+        if (!hasToken(c)) { held = true; continue; }
+        out = q.frames[q.head];
+        q.head = (uint8_t)((q.head + 1) % QUEUE_DEPTH);
+        q.count--;
+        cls = c;
+        found = true;
+        break;
+    }
+    portEXIT_CRITICAL(&txMux);
+    return found;
+}
+
+void txTask(void*) {
+    TickType_t wait = portMAX_DELAY;
+    lastRefillUs = (uint32_t)esp_timer_get_time();
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, wait);
+        wait = portMAX_DELAY;
+
+        // Feed the driver until every queue is empty or throttled.
+        for (;;) {
+            refill((uint32_t)esp_timer_get_time());
+            PendingFrame f;
+            uint8_t cls = 0;
+            bool held = false;
+            if (!takeNext(f, cls, held)) {
+                if (held) wait = ticksUntilToken(); // a new enqueue still wakes us early
+                break;
+            }
+            if (SHAPING[cls].ratePerSec != 0) tokens[cls] -= TOKEN;
+
+            // One-deep driver FIFO: this waits for at most the frame on the wire.
+            const bool ok = canDriverTransmit(f.msg, DRIVER_BLOCK_MS);
+            const uint32_t sentUs = (uint32_t)esp_timer_get_time();
+            const uint32_t latency = sentUs - f.originUs;
+            if (ok) busLoadOnTx(f.msg, sentUs);
+
+            portENTER_CRITICAL(&txMux);
+            CanTxClassStats& s = stats[cls];
+            if (ok) {
+                s.sent++;
+                recordLatency(s, latency);
+            } else {
+                s.failed++;
+            }
+            portEXIT_CRITICAL(&txMux);
+        }
+    }
+}
+
+} // namespace
+
+bool canTxBegin() {
+    for (uint8_t c = 0; c < CAN_TX_CLASS_COUNT; c++) tokens[c] = (uint32_t)SHAPING[c].burst * TOKEN;
+    if (xTaskCreatePinnedToCore(txTask, "can_tx", TASK_STACK_BYTES, nullptr,
+                                CAN_TX_TASK_PRIORITY, &txTaskHandle, CAN_TX_TASK_CORE) != pdPASS) {
+        return false;
+    }
+    xTaskNotifyGive(txTaskHandle); // anything queued before the task existed
+    return true;
+}
+
+bool canTxEnqueue(CanTxClass cls, uint32_t canID, const uint8_t* data, uint8_t dataLength,
+                  bool extended, bool rtr, uint32_t originUs) {
+    if (cls >= CAN_TX_CLASS_COUNT) return false;
+
+    PendingFrame f = {};
+    f.originUs = originUs != 0 ? originUs : (uint32_t)esp_timer_get_time();
+    f.msg.id = canID;
+    f.msg.length = (dataLength > 8) ? 8 : dataLength;
+    f.msg.extended = extended;
+    f.msg.rtr = rtr;
+    if (f.msg.length > 0) memcpy(f.msg.data, data, f.msg.length);
+
+    bool queued = false;
+    portENTER_CRITICAL_SAFE(&txMux);
+    ClassQueue& q = queues[cls];
+    CanTxClassStats& s = stats[cls];
+    if (q.count < QUEUE_DEPTH) {
+        q.frames[(q.head + q.count) % QUEUE_DEPTH] = f;
+        q.count++;
+        s.queued++;
+        if (q.count > s.depthHighWater) s.depthHighWater = q.count;
+        queued = true;
+    } else {
+        s.dropped++;
+    }
+    portEXIT_CRITICAL_SAFE(&txMux);
+
+    if (queued && txTaskHandle != nullptr) {
+        if (xPortInIsrContext()) {
+            BaseType_t woken = pdFALSE;
+            vTaskNotifyGiveFromISR(txTaskHandle, &woken);
+            if (woken) portYIELD_FROM_ISR();
+        } else {
+            xTaskNotifyGive(txTaskHandle);
+        }
+    }
+    return queued;
+}
+
+void sendCANFrame(CanTxClass cls, uint32_t canID, const uint8_t* data, uint8_t dataLength, bool extended, bool rtr) {
+    canTxEnqueue(cls, canID, data, dataLength, extended, rtr);
+}
+
+// Optimized overload using stack array
+void sendCANFrame(CanTxClass cls, uint32_t canID, std::initializer_list<uint8_t> data, bool extended, bool rtr) {
+    uint8_t dataArray[8];
+    uint8_t length = (data.size() > 8) ? 8 : data.size();
+
+    auto it = data.begin();
+    for (uint8_t i = 0; i < length; ++i, ++it) {
+        dataArray[i] = *it;
+    }
+
+    canTxEnqueue(cls, canID, dataArray, length, extended, rtr);
+}
+
+CanTxClassStats canTxStats(CanTxClass cls) {
+    CanTxClassStats copy = {};
+    if (cls >= CAN_TX_CLASS_COUNT) return copy;
+    portENTER_CRITICAL(&txMux);
+    copy = stats[cls];
+    portEXIT_CRITICAL(&txMux);
+    return copy;
+}
+
+const char* canTxClassName(CanTxClass cls) {
+    return cls < CAN_TX_CLASS_COUNT ? CLASS_NAMES[cls] : "?";
+}
+
+void canTxPrintStats() {
+    Serial.printf("bus scale %u/1000 on pid and keepalive\n", busLoadTxScale());
+    Serial.println("class      queued    sent  drop  fail depth  avg_us  max_us");
+    for (uint8_t c = 0; c < CAN_TX_CLASS_COUNT; c++) {
+        const CanTxClassStats s = canTxStats((CanTxClass)c);
+        const uint32_t avg = s.sent ? (uint32_t)(s.latencySumUs / s.sent) : 0;
+        Serial.printf("%-9s %7lu %7lu %5lu %5lu %2u/%2u %7lu %7lu\n", CLASS_NAMES[c],
+                      (unsigned long)s.queued, (unsigned long)s.sent,
+                      (unsigned long)s.dropped, (unsigned long)s.failed,
+                      s.depthHighWater, QUEUE_DEPTH, (unsigned long)avg,
+                      (unsigned long)s.maxLatencyUs);
+    }
+}
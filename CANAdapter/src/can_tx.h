@@ -3,5 +3,48 @@
 #include <Arduino.h>
 #include <initializer_list>
 
-void sendCANFrame(uint32_t canID, const uint8_t* data, uint8_t dataLength, bool extended = false, bool rtr = false);
-void sendCANFrame(uint32_t canID, std::initializer_list<uint8_t> data, bool extended = false, bool rtr = false);
+// CAN transmit path. Every frame goes into one of four class queues and a
+// task pinned next to can_rx feeds the driver from the highest class that
+// has something to send and tokens left. The driver's own TX FIFO is kept at
+// one frame so nothing low priority can pile up in front of an FC.
+//
+// Enqueue never blocks and is safe from loop(), other tasks and the RX task.
+// A full class queue drops the new frame and counts it.
+
+enum CanTxClass : uint8_t {
+    CAN_TX_FC = 0,      // ISO-TP flow control: the ECU is waiting on it
+    CAN_TX_BODY,        // body commands (windows, buzzer) from the wheel buttons
+    CAN_TX_PID,         // diag requests and their consecutive frames
+    CAN_TX_KEEPALIVE,   // periodic overrides (fan) that can always wait a bit
+    CAN_TX_CLASS_COUNT
+};
+
+constexpr uint8_t CAN_TX_TASK_CORE = 0;
+constexpr UBaseType_t CAN_TX_TASK_PRIORITY = 13;  // above can_rx so an FC goes out right away
+constexpr uint8_t CAN_TX_LATENCY_BINS = 16;        // log2 us: bin n holds [2^n, 2^(n+1)), last is open
+
+struct CanTxClassStats {
+    uint32_t queued;
+    uint32_t sent;
+    uint32_t dropped;        // class queue full on enqueue
+    uint32_t failed;         // driver refused it (bus off, TX timeout)
+    uint16_t depthHighWater;
+    uint64_t latencySumUs;   // enqueue (or caller's origin time) to driver, sent frames only
+    uint32_t maxLatencyUs;
+    uint32_t latency[CAN_TX_LATENCY_BINS];
+};
+
+// Call after canDriverBegin().
+bool canTxBegin();
+
+// originUs is when the reason for the frame happened (e.g. the FF that an FC
+// answers); 0 means now. Latency stats are measured from it.
+bool canTxEnqueue(CanTxClass cls, uint32_t canID, const uint8_t* data, uint8_t dataLength,
+                  bool extended = false, bool rtr = false, uint32_t originUs = 0);
+
+void sendCANFrame(CanTxClass cls, uint32_t canID, const uint8_t* data, uint8_t dataLength, bool extended = false, bool rtr = false);
+void sendCANFrame(CanTxClass cls, uint32_t canID, std::initializer_list<uint8_t> data, bool extended = false, bool rtr = false);
+
+CanTxClassStats canTxStats(CanTxClass cls);  // snapshot
+const char* canTxClassName(CanTxClass cls);
+void canTxPrintStats();
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "fixed_point.h"
+
+// The adapter -> DashDisplay UART frames: START | LEN | payload | XOR, with
+// START_SENSORS for PayloadI and START_BLOCKS for BlocksPayload.
+//
+// Every value goes over in the integer the ECU sent it in; the scale types
+// below say what that integer means, and both ends use them, so nothing is
+// converted to float on the way. The PID scales come out of the catalog
+// generator and main.cpp checks they still match these.
+//
+// No Arduino types; DashDisplay carries a copy of this file.
+
+namespace dash_wire {
+
+using Rpm       = FixedScale<uint16_t, 1, 1>;              // engine rpm
+using HvCurrent = FixedScale<int16_t, 1, 100>;             // A, + is discharge
+using HvVoltage = FixedScale<uint16_t, 1, 2>;              // V
+using Coolant   = FixedScale<int16_t, 1, 1>;               // C
+using HvTemp    = FixedScale<uint16_t, 853, 218450, -50>;  // C, 255.9/65535 per step
+using Soc       = FixedScale<uint8_t, 20, 51>;             // %
+using FanMode   = FixedScale<uint8_t, 1, 1>;               // 0..6
+using MgTemp    = FixedScale<uint8_t, 9, 5, -40>;          // F
+using MgRpm     = FixedScale<int16_t, 1, 1>;               // rpm
+using HvBlock   = FixedScale<uint16_t, 7999, 6553500>;     // V, 79.99/65535 per step
+
+constexpr uint8_t START_SENSORS = 0xAA;
+constexpr uint8_t START_BLOCKS = 0xAB;
+
+constexpr uint8_t HV_BLOCK_COUNT = 14;  // 0x2181 V01..V14
+
+// Per-value freshness, two bits each in PayloadI::freshness at 2 * Field.
+// The adapter judges it per signal from quality and age against the gap
+// expected between updates, so a dead poll shows up on its own widget.
+enum Field : uint8_t {
+    FIELD_RPM = 0,
+    FIELD_HV_CURRENT,
+    FIELD_HV_VOLTAGE,
+    FIELD_ECT,
+    FIELD_HV_INTAKE,
+    FIELD_TB1,
+    FIELD_TB2,
+    FIELD_TB3,
+    FIELD_SOC,
+    FIELD_MG1_TEMP,
+    FIELD_MG1_RPM,
+    FIELD_MG2_TEMP,
+    FIELD_MG2_RPM,
+    FIELD_EBAR,
+    FIELD_FAN,
+    FIELD_COUNT
+};
+
+enum Freshness : uint8_t {
+    FRESH = 0,
+    LATE,       // a poll failed or it's overdue; still worth showing
+    STALE,      // several updates missed
+    NO_DATA     // never received, or the ECU doesn't support it
+};
+
+inline Freshness freshness(uint32_t bits, Field f) { return (Freshness)((bits >> (2 * f)) & 3); }
+
+#pragma pack(push, 1)
+struct PayloadI {
+    uint8_t seq;          // increments each packet
+    uint16_t rpm;         // Rpm
+    int16_t hv_current;   // HvCurrent
+    uint16_t hv_voltage;  // HvVoltage
+    int16_t ect;          // Coolant
+    uint16_t hv_intake;   // HvTemp
+    uint16_t tb1;         // HvTemp
+    uint16_t tb2;         // HvTemp
+    uint16_t tb3;         // HvTemp
+    uint8_t soc;          // Soc
+    uint8_t mg1_temp;     // MgTemp
+    int16_t mg1_rpm;      // MgRpm
+    uint8_t mg2_temp;     // MgTemp
+    int16_t mg2_rpm;      // MgRpm
+    int8_t ebar;          // energy bar, -100..100
+    uint8_t est;          // energy flow state
+    uint8_t bfs;          // battery fan speed, FanMode
+    uint8_t bfor;         // battery fan override on
+    uint8_t dim;          // car dim signal
+    uint8_t off;          // display off flag
+    uint32_t freshness;   // 2 bits per Field
+};
+
+// HV battery block voltages, sent when a new 0x2181 reply lands. Blocks sit
+// within a few hundred mV of each other, so each goes as an 8-bit offset
+// from the lowest: block = base + (offset << shift). shift is the smallest
+// that fits the spread, so it is 0 (one HvBlock step, ~1.2 mV) until the
+// spread passes ~311 mV, and the payload is 19 bytes where the raw words
+// alone would be 28.
+struct BlocksPayload {
+    uint8_t seq;                      // increments each packet
+    uint8_t freshness;                // worst Freshness over the blocks
+    uint16_t base;                    // HvBlock, the lowest block
+    uint8_t shift;
+    uint8_t offset[HV_BLOCK_COUNT];   // (block - base) >> shift
+};
+#pragma pack(pop)
+
+inline void encodeBlocks(const uint16_t* raw, BlocksPayload& out) {
+    uint16_t lo = raw[0], hi = raw[0];
+    for (uint8_t i = 1; i < HV_BLOCK_COUNT; i++) {
+        if (raw[i] < lo) lo = raw[i];
+        if (raw[i] > hi) hi = raw[i];
+    }
+    uint8_t shift = 0;
+    while (((uint32_t)(hi - lo) >> shift) > 0xFF) shift++;
+    out.base = lo;
+    out.shift = shift;
+    for (uint8_t i = 0; i < HV_BLOCK_COUNT; i++) out.offset[i] = (uint8_t)((raw[i] - lo) >> shift);
+}
+
+inline uint16_t blockRaw(const BlocksPayload& p, uint8_t i) {
+    return (uint16_t)(p.base + ((uint32_t)p.offset[i] << p.shift));
+}
+
+static_assert(FIELD_COUNT <= 16, "freshness is 2 bits per field in 32");
+static_assert(sizeof(PayloadI) == 34, "wire layout changed; update both ends");
+static_assert(sizeof(BlocksPayload) == 19, "wire layout changed; update both ends");
+
+} // namespace dash_wire
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+#include <type_traits>
+
+// Bit extraction for one DBC signal, with everything about its layout fixed
+// at compile time. can_decoders.h (generated from the DBCs) instantiates one
+// per signal; the loops below run over constant byte ranges and fold into a
+// couple of loads and shifts.
+//
+// START is the DBC start bit: the LSB for Intel (@1), the MSB for Motorola
+// (@0), in the usual "bit 7 of byte 0 is 7, bit 0 of byte 1 is 8" numbering.
+
+template <uint8_t START, uint8_t LEN, bool MOTOROLA, bool SIGNED>
+struct DbcField {
+    static_assert(LEN >= 1 && LEN <= 32, "signals are 1..32 bits");
+
+    // Motorola bits counted from the MSB of byte 0 going right.
+    static constexpr uint8_t MSB_LINEAR = (START / 8) * 8 + 7 - START % 8;
+    static constexpr uint8_t LSB_LINEAR = MSB_LINEAR + LEN - 1;
+    static constexpr uint8_t FIRST_BYTE = START / 8;
+    static constexpr uint8_t LAST_BYTE = MOTOROLA ? LSB_LINEAR / 8 : (START + LEN - 1) / 8;
+    static constexpr uint8_t SHIFT = MOTOROLA ? 7 - LSB_LINEAR % 8 : START % 8;
+    static constexpr uint32_t MASK = LEN == 32 ? 0xFFFFFFFFu : (1u << LEN) - 1;
+    static_assert(LAST_BYTE < 8, "signal runs past byte 7");
+
+    using Raw = typename std::conditional<SIGNED, int32_t, uint32_t>::type;
+
+    // The signal's bits, not sign-extended.
+    static inline uint32_t bits(const uint8_t* d) {
+        uint64_t v = 0;
+        if (MOTOROLA) {
+            for (uint8_t i = FIRST_BYTE; i <= LAST_BYTE; i++) v = (v << 8) | d[i];
+        } else {
+            for (uint8_t i = LAST_BYTE + 1; i-- > FIRST_BYTE;) v = (v << 8) | d[i];
+        }
+        return (uint32_t)(v >> SHIFT) & MASK;
+    }
+
+    static inline Raw raw(const uint8_t* d) {
+        const uint32_t u = bits(d);
+        if (SIGNED && LEN < 32) return (Raw)((int32_t)(u << (32 - LEN)) >> (32 - LEN));
+        return (Raw)u;
+    }
+};
+
+// Per-signal metadata, for checking the generated decoders against captures.
+struct DbcSignalInfo {
+    uint16_t messageId;
+    const char* message;
+    const char* name;
+    uint8_t start;
+    uint8_t length;
+    bool motorola;
+    bool isSigned;
+    float scale;
+    float offset;
+    float min;     // min == max: the DBC gives no range
+    float max;
+    uint32_t (*bits)(const uint8_t* d);
+    float (*value)(const uint8_t* d);
+};
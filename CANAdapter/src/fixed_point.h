@@ -0,0 +1,94 @@
+#pragma once
+
+#include <limits>
+#include <stdint.h>
+
+// Scaled-integer signals. A FixedScale type names the integer a signal is
+// carried in and what it means:
+//
+//   value = raw * NUM / DEN + OFS_NUM / OFS_DEN
+//
+// e.g. HV current is FixedScale<int16_t, 1, 100> (centiamps) and MG1 temp is
+// FixedScale<uint8_t, 9, 5, -40> (the ECU byte, in F). Values stay as raw
+// from decode to the display, which converts straight to whatever integer
+// unit it draws in with to<UNITS>(): to<100>() gives centi-units, rounded to
+// nearest. The factors are all compile-time, and when the worst case fits in
+// 32 bits no 64-bit maths is emitted.
+//
+// No Arduino types; DashDisplay carries a copy of this file.
+
+struct FixedScaleInfo {
+    int32_t num;
+    int32_t den;
+    int32_t ofsNum;
+    int32_t ofsDen;
+};
+
+constexpr int64_t fixedDivRound(int64_t n, int64_t d) {  // d > 0
+    return n >= 0 ? (n + d / 2) / d : -((-n + d / 2) / d);
+}
+
+constexpr int32_t fixedDivRound32(int32_t n, int32_t d) {
+    return n >= 0 ? (n + d / 2) / d : -((-n + d / 2) / d);
+}
+
+constexpr int64_t fixedAbs(int64_t v) { return v < 0 ? -v : v; }
+
+template <typename RepT, int32_t NUM, int32_t DEN, int32_t OFS_NUM = 0, int32_t OFS_DEN = 1>
+struct FixedScale {
+    static_assert(DEN > 0 && OFS_DEN > 0, "denominators must be positive");
+    static_assert(NUM != 0, "zero scale");
+
+    using Rep = RepT;
+
+    static constexpr int64_t RAW_MAX_ABS =
+        fixedAbs(std::numeric_limits<Rep>::min()) > fixedAbs(std::numeric_limits<Rep>::max())
+            ? fixedAbs(std::numeric_limits<Rep>::min())
+            : fixedAbs(std::numeric_limits<Rep>::max());
+
+    // Raw -> value in 1/UNITS steps, rounded to nearest.
+    template <int32_t UNITS = 1>
+    static constexpr int32_t to(Rep raw) {
+        return fitsInt32(UNITS)
+                   ? fixedDivRound32((int32_t)raw * NUM * OFS_DEN * UNITS + OFS_NUM * DEN * UNITS, DEN * OFS_DEN)
+                   : (int32_t)fixedDivRound((int64_t)raw * NUM * OFS_DEN * UNITS + (int64_t)OFS_NUM * DEN * UNITS,
+                                            (int64_t)DEN * OFS_DEN);
+    }
+
+    // Value in 1/UNITS steps -> nearest raw. For thresholds, at compile time.
+    template <int32_t UNITS = 1>
+    static constexpr int32_t fromValue(int32_t value) {
+        return (int32_t)fixedDivRound(((int64_t)value * DEN * OFS_DEN - (int64_t)OFS_NUM * DEN * UNITS) *
+                                          (NUM < 0 ? -1 : 1),
+                                      fixedAbs((int64_t)NUM * OFS_DEN * UNITS));
+    }
+
+    // Whole raw steps in a value change of delta/UNITS, rounded down, so a raw
+    // change > deltaSteps(d) is exactly a value change > d. For deadbands.
+    template <int32_t UNITS = 1>
+    static constexpr int32_t deltaSteps(int32_t delta) {
+        return (int32_t)(((int64_t)delta * DEN) / fixedAbs((int64_t)NUM * UNITS));
+    }
+
+    // Debug output only.
+    static float toFloat(Rep raw) { return (float)raw * NUM / DEN + (float)OFS_NUM / OFS_DEN; }
+
+    static constexpr FixedScaleInfo info() { return FixedScaleInfo{NUM, DEN, OFS_NUM, OFS_DEN}; }
+
+private:
+    static constexpr bool fitsInt32(int32_t units) {
+        return RAW_MAX_ABS * fixedAbs(NUM) * OFS_DEN * units + fixedAbs(OFS_NUM) * DEN * units <= INT32_MAX &&
+               (int64_t)DEN * OFS_DEN <= INT32_MAX;
+    }
+};
+
+// Same conversions for a scale only known at run time (catalog rows, the
+// signal store's debug dump).
+inline float fixedToFloat(const FixedScaleInfo& s, int32_t raw) {
+    return (float)raw * s.num / s.den + (float)s.ofsNum / s.ofsDen;
+}
+
+inline int32_t fixedTo(const FixedScaleInfo& s, int32_t raw, int32_t units) {
+    return (int32_t)fixedDivRound((int64_t)raw * s.num * s.ofsDen * units + (int64_t)s.ofsNum * s.den * units,
+                                  (int64_t)s.den * s.ofsDen);
+}
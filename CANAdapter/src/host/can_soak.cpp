@@ -0,0 +1,90 @@
+// Host soak run for the CAN driver layer over SocketCAN.
+//
+//   ip link add dev vcan0 type vcan && ip link set up vcan0
+//   canplayer -I candumps/<drive>.log vcan0=can0 &
+//   .pio/build/host_soak/program vcan0 60 [tx_hz]
+//
+// Receives for the given number of seconds and prints frames/s, distinct IDs
+// and the driver counters once a second. With tx_hz it also sends a Mode 01
+// PID 00 request to 0x7DF at that rate from a second thread, the same split
+// the car has between the can_rx and can_tx tasks.
+
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+
+#include "../can_driver.h"
+
+namespace {
+
+std::atomic<bool> stop{false};
+std::atomic<uint32_t> frames{0};
+std::atomic<uint32_t> maxGapUs{0};
+uint8_t seen[2048 / 8] = {0};
+std::atomic<uint16_t> distinct{0};
+
+void rxLoop() {
+    CanDriverFrame f;
+    uint32_t lastUs = 0;
+    while (!stop.load()) {
+        if (!canDriverReceive(f, 100)) continue;
+        frames.fetch_add(1, std::memory_order_relaxed);
+        if (lastUs != 0 && f.us - lastUs > maxGapUs.load()) maxGapUs.store(f.us - lastUs);
+        lastUs = f.us;
+        if (!f.extended && !(seen[f.id >> 3] & (1 << (f.id & 7)))) {
+            seen[f.id >> 3] |= (uint8_t)(1 << (f.id & 7));
+            distinct.fetch_add(1);
+        }
+    }
+}
+
+void txLoop(unsigned hz) {
+    const auto period = std::chrono::microseconds(1000000 / hz);
+    CanDriverFrame f = {};
+    f.id = 0x7DF;
+    f.length = 8;
+    f.data[0] = 0x02;
+    f.data[1] = 0x01;
+    auto next = std::chrono::steady_clock::now();
+    while (!stop.load()) {
+        canDriverTransmit(f, 10);
+        next += period;
+        std::this_thread::sleep_until(next);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    CanDriverConfig config = {};
+    config.interface = argc > 1 ? argv[1] : "vcan0";
+    config.rxQueueLen = 1024;
+    const int seconds = argc > 2 ? atoi(argv[2]) : 10;
+    const unsigned txHz = argc > 3 ? (unsigned)atoi(argv[3]) : 0;
+
+    if (!canDriverBegin(config)) {
+        fprintf(stderr, "can't open %s\n", config.interface);
+        return 1;
+    }
+
+    std::thread rx(rxLoop);
+    std::thread tx;
+    if (txHz > 0) tx = std::thread(txLoop, txHz);
+
+    uint32_t lastFrames = 0;
+    for (int s = 1; s <= seconds; s++) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        const uint32_t now = frames.load();
+        printf("t=%3ds %6lu fps ids=%u max_gap=%luus  ", s, (unsigned long)(now - lastFrames),
+               distinct.load(), (unsigned long)maxGapUs.exchange(0));
+        canDriverPrintStats();
+        lastFrames = now;
+    }
+
+    stop.store(true);
+    rx.join();
+    if (tx.joinable()) tx.join();
+    return 0;
+}
@@ -0,0 +1,188 @@
+// Checks the generated DBC decoders (can_decoders.h) against SavvyCAN CSV
+// captures and times them.
+//
+//   pio run -e host_dbc_check && .pio/build/host_dbc_check/program candumps/*.csv
+//
+// For every captured frame of a generated message, each signal is pulled out
+// again one bit at a time straight from the DBC start/length/byte order and
+// compared with DbcField::bits(); the physical value is compared with
+// raw * scale + offset. Values outside the DBC [min|max] are counted, not
+// failed, since several overlay ranges are placeholders. Exits non-zero on
+// any mismatch.
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "../can_decoders.h"
+
+namespace {
+
+constexpr size_t SIGNAL_COUNT = sizeof(dbc::SIGNALS) / sizeof(dbc::SIGNALS[0]);
+constexpr int BENCH_ROUNDS = 200;
+
+struct Frame {
+    uint16_t id;
+    uint8_t length;
+    uint8_t data[8];
+};
+
+struct SignalResult {
+    uint32_t frames;
+    uint32_t short_frames;  // frame too short to hold the signal
+    uint32_t bit_mismatch;
+    uint32_t value_mismatch;
+    uint32_t out_of_range;
+    float min_seen;
+    float max_seen;
+    double generated_ns;
+    double reference_ns;
+};
+
+// Straight from the DBC definition: Intel counts up from the start (LSB);
+// Motorola starts at the MSB and walks right, jumping to bit 7 of the next
+// byte after bit 0.
+uint32_t referenceBits(const DbcSignalInfo& s, const uint8_t* d) {
+    uint32_t v = 0;
+    int pos = s.start;
+    for (int i = 0; i < s.length; i++) {
+        const uint32_t bit = (d[pos / 8] >> (pos % 8)) & 1;
+        if (s.motorola) {
+            v = (v << 1) | bit;
+            pos = pos % 8 == 0 ? pos + 15 : pos - 1;
+        } else {
+            v |= bit << i;
+            pos++;
+        }
+    }
+    return v;
+}
+
+int lastByte(const DbcSignalInfo& s) {
+    if (!s.motorola) return (s.start + s.length - 1) / 8;
+    int pos = s.start;
+    for (int i = 1; i < s.length; i++) pos = pos % 8 == 0 ? pos + 15 : pos - 1;
+    return pos / 8;
+}
+
+float referenceValue(const DbcSignalInfo& s, uint32_t bits) {
+    double raw = bits;
+    if (s.isSigned && s.length < 32 && (bits >> (s.length - 1)) & 1) raw -= (double)(1ull << s.length);
+    return (float)(raw * s.scale + s.offset);
+}
+
+bool wanted(uint16_t id) {
+    for (size_t i = 0; i < SIGNAL_COUNT; i++) {
+        if (dbc::SIGNALS[i].messageId == id) return true;
+    }
+    return false;
+}
+
+// SavvyCAN: Time Stamp,ID,Extended,Dir,Bus,LEN,D1,..,D8
+size_t loadCsv(const char* path, std::vector<Frame>& out) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "can't open %s\n", path);
+        return 0;
+    }
+    char line[256];
+    size_t n = 0;
+    while (fgets(line, sizeof(line), f)) {
+        char* fields[16];
+        int count = 0;
+        for (char* p = strtok(line, ",\r\n"); p && count < 16; p = strtok(nullptr, ",\r\n")) fields[count++] = p;
+        if (count < 6 || strcmp(fields[2], "false") != 0) continue;
+        char* end;
+        const unsigned long id = strtoul(fields[1], &end, 16);
+        if (*end != '\0' || id >= 0x800 || !wanted((uint16_t)id)) continue;
+        Frame fr = {};
+        fr.id = (uint16_t)id;
+        fr.length = (uint8_t)atoi(fields[5]);
+        if (fr.length > 8) fr.length = 8;
+        for (int i = 0; i < fr.length && 6 + i < count; i++) fr.data[i] = (uint8_t)strtoul(fields[6 + i], nullptr, 16);
+        out.push_back(fr);
+        n++;
+    }
+    fclose(f);
+    return n;
+}
+
+template <typename Fn>
+double timeNs(const std::vector<const Frame*>& frames, Fn fn) {
+    volatile float sink = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        float acc = 0;
+        for (const Frame* f : frames) acc += fn(f->data);
+        sink = sink + acc;
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double)frames.size() * BENCH_ROUNDS);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s capture.csv [...]\n", argv[0]);
+        return 2;
+    }
+    std::vector<Frame> frames;
+    for (int i = 1; i < argc; i++) {
+        const size_t n = loadCsv(argv[i], frames);
+        printf("%s: %zu frames of generated messages\n", argv[i], n);
+    }
+
+    SignalResult results[SIGNAL_COUNT] = {};
+    uint32_t failures = 0;
+
+    for (size_t si = 0; si < SIGNAL_COUNT; si++) {
+        const DbcSignalInfo& s = dbc::SIGNALS[si];
+        SignalResult& r = results[si];
+        const int needBytes = lastByte(s) + 1;
+        std::vector<const Frame*> mine;
+        for (const Frame& f : frames) {
+            if (f.id != s.messageId) continue;
+            if (f.length < needBytes) {
+                r.short_frames++;
+                continue;
+            }
+            mine.push_back(&f);
+            const uint32_t ref = referenceBits(s, f.data);
+            const uint32_t got = s.bits(f.data);
+            const float value = s.value(f.data);
+            const float refValue = referenceValue(s, ref);
+            if (got != ref) r.bit_mismatch++;
+            if (fabsf(value - refValue) > 1e-4f * (1.0f + fabsf(refValue))) r.value_mismatch++;
+            if (s.min < s.max && (value < s.min || value > s.max)) r.out_of_range++;
+            if (r.frames == 0 || value < r.min_seen) r.min_seen = value;
+            if (r.frames == 0 || value > r.max_seen) r.max_seen = value;
+            r.frames++;
+        }
+        if (!mine.empty()) {
+            r.generated_ns = timeNs(mine, [&](const uint8_t* d) { return s.value(d); });
+            r.reference_ns = timeNs(mine, [&](const uint8_t* d) { return referenceValue(s, referenceBits(s, d)); });
+        }
+        failures += r.bit_mismatch + r.value_mismatch;
+    }
+
+    printf("\n%-5s %-30s %7s %5s %5s %6s %11s %11s %7s %7s\n", "id", "signal", "frames", "bad", "short",
+           "range", "min", "max", "gen ns", "ref ns");
+    for (size_t si = 0; si < SIGNAL_COUNT; si++) {
+        const DbcSignalInfo& s = dbc::SIGNALS[si];
+        const SignalResult& r = results[si];
+        if (r.frames == 0 && r.short_frames == 0) {
+            printf("0x%03X %-30s %7s\n", s.messageId, s.name, "-");
+            continue;
+        }
+        printf("0x%03X %-30s %7u %5u %5u %6u %11.3f %11.3f %7.2f %7.2f\n", s.messageId, s.name, r.frames,
+               r.bit_mismatch + r.value_mismatch, r.short_frames, r.out_of_range, r.min_seen, r.max_seen,
+               r.generated_ns, r.reference_ns);
+    }
+    printf("\n%s: %u mismatches\n", failures ? "FAIL" : "OK", failures);
+    return failures ? 1 : 0;
+}
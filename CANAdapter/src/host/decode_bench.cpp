@@ -0,0 +1,236 @@
+// Times the reply decode both ways and checks they store the same values.
+//
+//   pio run -e host_decode_bench && .pio/build/host_decode_bench/program [replies]
+//
+// hand:      the per-sensor switch main.cpp had before the catalog, minus the
+//            POLL_DIAG prints, writing the old g_sensors float slots.
+// generated: main.cpp's decode now: length check from the catalog request,
+//            then the sensor's outputs unrolled at compile time, each through
+//            PidFixed<pid>::raw() into an integer slot (compared after
+//            converting with the catalog scale).
+//
+// Both run over the same random replies for the eight sensors the switch
+// knew, in turn. Three differences are intended: HV current now uses
+// Torque's -327.68 offset (was -327.7), fan modes above 6 are stored as
+// read and clamped when packed for the display (not compared), and the catalog's minimum length covers the
+// whole record, so a short reply the switch took may now be refused.
+
+#include <chrono>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <utility>
+#include <vector>
+
+#include "../pid_catalog.h"
+
+namespace {
+
+enum Sensor { HV_CURRENT, HV_VOLTAGE, ECT, HV_TEMPS, SOC, HV_FAN_MODE, MG1, MG2, SENSOR_COUNT };
+const char* const SENSOR_NAMES[SENSOR_COUNT] = {"hv_current", "hv_voltage", "coolant", "hv_temps",
+                                                "soc",        "fan_mode",   "mg1",     "mg2"};
+
+// The old g_sensors slots.
+enum Slot {
+    IDX_HV_CURRENT = 1, IDX_HV_VOLTAGE = 2, IDX_ECT = 3, IDX_HV_INTAKE_C = 4, IDX_HV_TB1_C = 5,
+    IDX_HV_TB2_C = 6, IDX_HV_TB3_C = 7, IDX_SOC = 8, IDX_BFS = 11, IDX_MG1_TEMP_F = 18, IDX_MG1_RPM = 19,
+    IDX_MG2_TEMP_F = 20, IDX_MG2_RPM = 21, SLOT_COUNT = 24
+};
+
+constexpr int REPLY_LEN = 16;
+constexpr int BENCH_ROUNDS = 50;
+constexpr float CURRENT_OFFSET_CHANGE = 0.02f;
+
+float handSlots[SLOT_COUNT];
+int32_t genSlots[SLOT_COUNT];
+
+__attribute__((noinline)) bool decodeHand(uint8_t sensor, const uint8_t* p, uint16_t len) {
+    switch (sensor) {
+        case HV_CURRENT: {
+            if (len < 4) return false;
+            handSlots[IDX_HV_CURRENT] = ((p[2] * 256 + p[3]) / 100.0f) - 327.7f;
+            return true;
+        }
+        case HV_VOLTAGE: {
+            if (len < 9) return false;
+            uint16_t raw = (uint16_t(p[7]) << 8) | p[8];
+            handSlots[IDX_HV_VOLTAGE] = raw / 2.0f;
+            return true;
+        }
+        case ECT: {
+            if (len < 3) return false;
+            handSlots[IDX_ECT] = p[2] - 40.0f;
+            return true;
+        }
+        case HV_TEMPS: {
+            auto word_to_C = [](uint16_t w) -> float { return (w * 255.9f / 65535.0f) - 50.0f; };
+            if (len < 10) return false;
+            handSlots[IDX_HV_INTAKE_C] = word_to_C((uint16_t(p[2]) << 8) | p[3]);
+            handSlots[IDX_HV_TB1_C] = word_to_C((uint16_t(p[4]) << 8) | p[5]);
+            handSlots[IDX_HV_TB2_C] = word_to_C((uint16_t(p[6]) << 8) | p[7]);
+            handSlots[IDX_HV_TB3_C] = word_to_C((uint16_t(p[8]) << 8) | p[9]);
+            return true;
+        }
+        case SOC: {
+            if (len < 3) return false;
+            handSlots[IDX_SOC] = (p[2] * 20.0f) / 51.0f;
+            return true;
+        }
+        case HV_FAN_MODE: {
+            if (len < 4) return false;
+            const uint8_t mode = p[3];
+            handSlots[IDX_BFS] = mode <= 6 ? mode : 0;
+            return true;
+        }
+        case MG1: {
+            if (len < 7) return false;
+            handSlots[IDX_MG1_TEMP_F] = p[2] * 9.0f / 5.0f - 40.0f;
+            handSlots[IDX_MG1_RPM] = (float)(((uint16_t)p[5] << 8) | p[6]) - 32768.0f;
+            return true;
+        }
+        case MG2: {
+            if (len < 7) return false;
+            handSlots[IDX_MG2_TEMP_F] = p[2] * 9.0f / 5.0f - 40.0f;
+            handSlots[IDX_MG2_RPM] = (float)(((uint16_t)p[5] << 8) | p[6]) - 32768.0f;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+// main.cpp's sensorOutputs rows for the same sensors, grouped by sensor.
+struct Output {
+    uint8_t sensor;
+    uint16_t pid;
+    uint8_t slot;
+};
+constexpr Output OUTPUTS[] = {
+    {HV_CURRENT, PID_7E2_2198_BTY_CURR, IDX_HV_CURRENT},     {HV_VOLTAGE, PID_7E2_2174_VLB, IDX_HV_VOLTAGE},
+    {ECT, PID_7E2_0105_ECT, IDX_ECT},                        {HV_TEMPS, PID_7E2_2187_TB_INTAKE_C, IDX_HV_INTAKE_C},
+    {HV_TEMPS, PID_7E2_2187_TB_1_C, IDX_HV_TB1_C},           {HV_TEMPS, PID_7E2_2187_TB_2_C, IDX_HV_TB2_C},
+    {HV_TEMPS, PID_7E2_2187_TB_3_C, IDX_HV_TB3_C},           {SOC, PID_7E2_015B_SOC, IDX_SOC},
+    {HV_FAN_MODE, PID_7E2_219B_FAN_MODE, IDX_BFS},           {MG1, PID_7E2_2161_MG1T, IDX_MG1_TEMP_F},
+    {MG1, PID_7E2_2161_MG1_RPM, IDX_MG1_RPM},                {MG2, PID_7E2_2162_MG2T, IDX_MG2_TEMP_F},
+    {MG2, PID_7E2_2162_MG2_RPM, IDX_MG2_RPM},
+};
+constexpr uint8_t OUTPUT_COUNT = sizeof(OUTPUTS) / sizeof(OUTPUTS[0]);
+
+struct OutputIndex {
+    uint8_t first[SENSOR_COUNT + 1];
+    uint8_t minLen[SENSOR_COUNT];
+};
+constexpr OutputIndex indexOutputs() {
+    OutputIndex x = {};
+    uint8_t i = 0;
+    for (uint8_t s = 0; s < SENSOR_COUNT; s++) {
+        x.first[s] = i;
+        x.minLen[s] = pidRequests[pidCatalog[OUTPUTS[i].pid].request].minLen;
+        while (i < OUTPUT_COUNT && OUTPUTS[i].sensor == s) i++;
+    }
+    x.first[SENSOR_COUNT] = i;
+    return x;
+}
+constexpr OutputIndex outputIndex = indexOutputs();
+constexpr const uint8_t* outputFirst = outputIndex.first;
+
+template <uint8_t I, uint8_t END>
+inline void storeOutputs(const uint8_t* p) {
+    if constexpr (I < END) {
+        genSlots[OUTPUTS[I].slot] = PidFixed<OUTPUTS[I].pid>::raw(p);
+        storeOutputs<I + 1, END>(p);
+    }
+}
+
+template <uint8_t SENSOR>
+bool decodeSensor(const uint8_t* p, uint16_t len) {
+    if (len < outputIndex.minLen[SENSOR]) return false;
+    storeOutputs<outputFirst[SENSOR], outputFirst[SENSOR + 1]>(p);
+    return true;
+}
+
+using SensorDecoder = bool (*)(const uint8_t*, uint16_t);
+template <size_t... S>
+constexpr SensorDecoder sensorDecoders[] = {decodeSensor<S>...};
+template <size_t... S>
+constexpr const SensorDecoder* decoderTable(std::index_sequence<S...>) { return sensorDecoders<S...>; }
+constexpr const SensorDecoder* SENSOR_DECODERS = decoderTable(std::make_index_sequence<SENSOR_COUNT>());
+
+__attribute__((noinline)) bool decodeGenerated(uint8_t sensor, const uint8_t* p, uint16_t len) {
+    return SENSOR_DECODERS[sensor](p, len);
+}
+
+struct Reply {
+    uint8_t sensor;
+    uint8_t payload[REPLY_LEN];
+};
+
+template <typename Fn>
+double timeNs(const std::vector<Reply>& replies, Fn fn) {
+    volatile uint32_t sink = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        uint32_t ok = 0;
+        for (const Reply& reply : replies) ok += fn(reply.sensor, reply.payload, REPLY_LEN);
+        sink = sink + ok;
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double)replies.size() * BENCH_ROUNDS);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? strtoul(argv[1], nullptr, 0) : 1000000;
+    std::vector<Reply> replies(count);
+    srand(1);
+    for (size_t n = 0; n < count; n++) {
+        replies[n].sensor = (uint8_t)(n % SENSOR_COUNT);
+        for (int b = 0; b < REPLY_LEN; b++) replies[n].payload[b] = (uint8_t)rand();
+    }
+
+    uint32_t failures = 0;
+    for (const Reply& r : replies) {
+        const bool a = decodeHand(r.sensor, r.payload, REPLY_LEN);
+        const bool b = decodeGenerated(r.sensor, r.payload, REPLY_LEN);
+        if (a != b) {
+            if (failures < 10) printf("  %s: hand %d generated %d\n", SENSOR_NAMES[r.sensor], a, b);
+            failures++;
+            continue;
+        }
+        for (uint8_t i = outputFirst[r.sensor]; i < outputFirst[r.sensor + 1]; i++) {
+            const uint8_t slot = OUTPUTS[i].slot;
+            if (slot == IDX_BFS && r.payload[3] > 6) continue;
+            const float h = handSlots[slot];
+            const float g = fixedToFloat(pidCatalog[OUTPUTS[i].pid].scale, genSlots[slot]);
+            float tolerance = fabsf(h) * 4.0f * 1.1920929e-7f + 1e-4f;
+            if (slot == IDX_HV_CURRENT) tolerance += CURRENT_OFFSET_CHANGE;
+            if (fabsf(h - g) > tolerance) {
+                if (failures < 10) {
+                    printf("  %s: hand %.4f generated %.4f\n", pidCatalog[OUTPUTS[i].pid].shortName, (double)h,
+                           (double)g);
+                }
+                failures++;
+            }
+        }
+    }
+
+    // Never take a reply shorter than the switch did.
+    for (uint8_t s = 0; s < SENSOR_COUNT; s++) {
+        for (uint16_t len = 0; len <= REPLY_LEN; len++) {
+            if (decodeGenerated(s, replies[0].payload, len) && !decodeHand(s, replies[0].payload, len)) {
+                printf("  %s: length %u taken, the switch refused it\n", SENSOR_NAMES[s], len);
+                failures++;
+            }
+        }
+    }
+
+    const double handNs = timeNs(replies, decodeHand);
+    const double genNs = timeNs(replies, decodeGenerated);
+    printf("%zu replies over %d sensors, %lu mismatches\n", count, (int)SENSOR_COUNT, (unsigned long)failures);
+    printf("hand      %6.2f ns/reply\n", handNs);
+    printf("generated %6.2f ns/reply\n", genNs);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,215 @@
+// Times the display path both ways and checks they draw the same numbers.
+//
+//   pio run -e host_fixed_bench && .pio/build/host_fixed_bench/program [frames]
+//
+// float: catalog decode() -> 13 floats -> the old 59-byte PayloadF -> unpack
+//        -> the lrintf() conversions DashDisplay used to do.
+// fixed: catalog decodeRaw() -> dash_wire::PayloadI (30 bytes) -> unpack ->
+//        FixedScale::to<>() integer conversions, as DashDisplay does now.
+//
+// Both run over the same random reply payloads. Every value the display
+// shows is compared; float rounding can land one count away on a .5
+// boundary, or a few float ulps away on the huge products random bytes give
+// for watts. Anything further is a failure.
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "../dash_wire.h"
+#include "../pid_catalog.h"
+
+namespace {
+
+// The polled rows of main.cpp's sensorOutputs, in PayloadI order.
+enum Out { CURR, VOLT, ECT, INTAKE, TB1, TB2, TB3, SOC, FAN, MG1T, MG1R, MG2T, MG2R, OUT_COUNT };
+const uint16_t PIDS[OUT_COUNT] = {
+    PID_7E2_2198_BTY_CURR, PID_7E2_2174_VLB,    PID_7E2_0105_ECT,      PID_7E2_2187_TB_INTAKE_C,
+    PID_7E2_2187_TB_1_C,   PID_7E2_2187_TB_2_C, PID_7E2_2187_TB_3_C,   PID_7E2_015B_SOC,
+    PID_7E2_219B_FAN_MODE, PID_7E2_2161_MG1T,   PID_7E2_2161_MG1_RPM,  PID_7E2_2162_MG2T,
+    PID_7E2_2162_MG2_RPM,
+};
+
+constexpr int REPLY_LEN = 16;
+constexpr int BENCH_ROUNDS = 50;
+
+#pragma pack(push, 1)
+// The float frame this replaced.
+struct PayloadF {
+    uint8_t seq;
+    float rpm, hv_current_A, hv_voltage_V, ect_C, hv_intake_C, tb1_C, tb2_C, tb3_C, soc_pct;
+    float mg1_temp_F, mg1_rpm, mg2_temp_F, mg2_rpm;
+    int8_t ebar;
+    uint8_t est, bfs, bfor, dim, off;
+};
+#pragma pack(pop)
+
+// What the display draws from one frame.
+struct Shown {
+    int rpm, watts, kw_centi, mg1_rpm, mg2_rpm, mg1_temp, mg2_temp, soc_centi, btF, intakeF, bfs, ectF;
+    int volt_centi, amp_centi;
+};
+constexpr int SHOWN_FIELDS = sizeof(Shown) / sizeof(int);
+const char* const SHOWN_NAMES[SHOWN_FIELDS] = {"rpm",      "watts",   "kw_centi", "mg1_rpm",  "mg2_rpm",
+                                               "mg1_temp", "mg2_temp", "soc_centi", "bt_F",    "intake_F",
+                                               "bfs",      "ect_F",   "volt_centi", "amp_centi"};
+
+using CoolantF = FixedScale<int16_t, 9, 5, 32>;
+using HvTempF = FixedScale<uint16_t, 853 * 9, 218450 * 5, -58>;
+
+inline float c_to_f(float c) { return (c * 9.0f / 5.0f) + 32.0f; }
+
+Shown floatPath(const uint8_t* const* replies, uint16_t rpm, uint8_t* wire) {
+    float v[OUT_COUNT];
+    for (int i = 0; i < OUT_COUNT; i++) v[i] = pidCatalog[PIDS[i]].decode(replies[i]);
+    PayloadF tx = {};
+    tx.rpm = rpm;
+    tx.hv_current_A = v[CURR];
+    tx.hv_voltage_V = v[VOLT];
+    tx.ect_C = v[ECT];
+    tx.hv_intake_C = v[INTAKE];
+    tx.tb1_C = v[TB1];
+    tx.tb2_C = v[TB2];
+    tx.tb3_C = v[TB3];
+    tx.soc_pct = v[SOC];
+    tx.mg1_temp_F = v[MG1T];
+    tx.mg1_rpm = v[MG1R];
+    tx.mg2_temp_F = v[MG2T];
+    tx.mg2_rpm = v[MG2R];
+    tx.bfs = (uint8_t)lroundf(v[FAN]);
+    memcpy(wire, &tx, sizeof(tx));
+
+    PayloadF p;
+    memcpy(&p, wire, sizeof(p));
+    Shown s;
+    s.rpm = (int)lrintf(p.rpm);
+    s.watts = (int)lrintf(p.hv_voltage_V * p.hv_current_A);
+    s.kw_centi = (int)lrintf(s.watts / 10.0f);
+    s.mg1_rpm = (int)lrintf(p.mg1_rpm);
+    s.mg2_rpm = (int)lrintf(p.mg2_rpm);
+    s.mg1_temp = (int)lrintf(p.mg1_temp_F);
+    s.mg2_temp = (int)lrintf(p.mg2_temp_F);
+    s.soc_centi = (int)lrintf(p.soc_pct * 100.0f);
+    s.btF = (int)lrintf(c_to_f((p.tb1_C + p.tb2_C + p.tb3_C) / 3.0f));
+    s.intakeF = (int)lrintf(c_to_f(p.hv_intake_C));
+    s.bfs = (int)lrintf(p.bfs);
+    s.ectF = (int)lrint(c_to_f(p.ect_C));
+    s.volt_centi = (int)lrintf(p.hv_voltage_V * 100.0f);
+    s.amp_centi = (int)lrintf(p.hv_current_A * 100.0f);
+    return s;
+}
+
+Shown fixedPath(const uint8_t* const* replies, uint16_t rpm, uint8_t* wire) {
+    int32_t r[OUT_COUNT];
+    for (int i = 0; i < OUT_COUNT; i++) r[i] = pidCatalog[PIDS[i]].decodeRaw(replies[i]);
+    dash_wire::PayloadI tx = {};
+    tx.rpm = rpm;
+    tx.hv_current = (int16_t)r[CURR];
+    tx.hv_voltage = (uint16_t)r[VOLT];
+    tx.ect = (int16_t)r[ECT];
+    tx.hv_intake = (uint16_t)r[INTAKE];
+    tx.tb1 = (uint16_t)r[TB1];
+    tx.tb2 = (uint16_t)r[TB2];
+    tx.tb3 = (uint16_t)r[TB3];
+    tx.soc = (uint8_t)r[SOC];
+    tx.mg1_temp = (uint8_t)r[MG1T];
+    tx.mg1_rpm = (int16_t)r[MG1R];
+    tx.mg2_temp = (uint8_t)r[MG2T];
+    tx.mg2_rpm = (int16_t)r[MG2R];
+    tx.bfs = (uint8_t)r[FAN];
+    memcpy(wire, &tx, sizeof(tx));
+
+    dash_wire::PayloadI p;
+    memcpy(&p, wire, sizeof(p));
+    Shown s;
+    const int32_t va_raw = (int32_t)p.hv_voltage * p.hv_current;
+    s.rpm = dash_wire::Rpm::to(p.rpm);
+    s.watts = (int)fixedDivRound(va_raw, 200);
+    s.kw_centi = (int)fixedDivRound(va_raw, 2000);
+    s.mg1_rpm = dash_wire::MgRpm::to(p.mg1_rpm);
+    s.mg2_rpm = dash_wire::MgRpm::to(p.mg2_rpm);
+    s.mg1_temp = dash_wire::MgTemp::to(p.mg1_temp);
+    s.mg2_temp = dash_wire::MgTemp::to(p.mg2_temp);
+    s.soc_centi = dash_wire::Soc::to<100>(p.soc);
+    s.btF = HvTempF::to((uint16_t)fixedDivRound32((int32_t)p.tb1 + p.tb2 + p.tb3, 3));
+    s.intakeF = HvTempF::to(p.hv_intake);
+    s.bfs = dash_wire::FanMode::to(p.bfs);
+    s.ectF = CoolantF::to(p.ect);
+    s.volt_centi = dash_wire::HvVoltage::to<100>(p.hv_voltage);
+    s.amp_centi = dash_wire::HvCurrent::to<100>(p.hv_current);
+    return s;
+}
+
+struct Frame {
+    uint8_t reply[OUT_COUNT][REPLY_LEN];
+    const uint8_t* replies[OUT_COUNT];
+    uint16_t rpm;
+};
+
+template <typename Fn>
+double timeNs(const std::vector<Frame>& frames, Fn fn) {
+    uint8_t wire[64];
+    volatile int sink = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        int acc = 0;
+        for (const Frame& f : frames) {
+            const Shown s = fn(f.replies, f.rpm, wire);
+            acc += s.watts + s.btF + s.soc_centi + s.mg1_rpm;
+        }
+        sink = sink + acc;
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double)frames.size() * BENCH_ROUNDS);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? strtoul(argv[1], nullptr, 0) : 100000;
+    std::vector<Frame> frames(count);
+    srand(1);
+    for (Frame& f : frames) {
+        for (int i = 0; i < OUT_COUNT; i++) {
+            for (int b = 0; b < REPLY_LEN; b++) f.reply[i][b] = (uint8_t)rand();
+            f.replies[i] = f.reply[i];
+        }
+        f.rpm = (uint16_t)(rand() % 6000);
+    }
+
+    uint32_t offByOne[SHOWN_FIELDS] = {};
+    uint32_t failures = 0;
+    uint8_t wire[64];
+    for (const Frame& f : frames) {
+        const Shown a = floatPath(f.replies, f.rpm, wire);
+        const Shown b = fixedPath(f.replies, f.rpm, wire);
+        int av[SHOWN_FIELDS], bv[SHOWN_FIELDS];
+        memcpy(av, &a, sizeof(av));
+        memcpy(bv, &b, sizeof(bv));
+        for (int i = 0; i < SHOWN_FIELDS; i++) {
+            const int d = abs(av[i] - bv[i]);
+            const float ulps = fabsf((float)av[i]) * 4.0f * 1.1920929e-7f;
+            if (d == 1) offByOne[i]++;
+            if (d > 1 && d > ulps) {
+                if (failures < 10) printf("  %s: float %d fixed %d\n", SHOWN_NAMES[i], av[i], bv[i]);
+                failures++;
+            }
+        }
+    }
+
+    const double floatNs = timeNs(frames, floatPath);
+    const double fixedNs = timeNs(frames, fixedPath);
+    printf("%zu frames, payload %zu -> %zu bytes\n", count, sizeof(PayloadF), sizeof(dash_wire::PayloadI));
+    printf("decode+pack+unpack+convert: float %.1f ns/frame, fixed %.1f ns/frame (%.2fx)\n", floatNs, fixedNs,
+           floatNs / fixedNs);
+    printf("off by one (float rounding):");
+    for (int i = 0; i < SHOWN_FIELDS; i++) {
+        if (offByOne[i]) printf(" %s=%u", SHOWN_NAMES[i], offByOne[i]);
+    }
+    printf("\n%s: %u values differ by more than one\n", failures ? "FAIL" : "OK", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,256 @@
+// Replays a SavvyCAN capture through the broadcast kinematics path
+// (kinematics.cpp) and checks and times it.
+//
+//   pio run -e host_kin_replay && .pio/build/host_kin_replay/program "candumps/full drive 1.csv"
+//
+// Every 0x024/0x0AA/0x0B4 frame goes through the kinOn*() hooks at its
+// capture time, with 100 ms and 20 ms consumers serviced after each frame
+// (as often as loop() could) and one serviced every 2 s to show the overrun
+// path. Each decimated output is compared with a double-precision cascade
+// over the same samples and coefficients; more than one raw step apart is a
+// failure. Then the hooks and the 100 ms consumer are timed over the whole
+// capture, and the cost is given per second of capture at its own frame
+// rate. Exits non-zero on any mismatch.
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "../can_decoders.h"
+#include "../kinematics.h"
+
+namespace {
+
+constexpr int BENCH_ROUNDS = 20;
+
+struct Frame {
+    uint32_t ms;
+    uint16_t id;
+    uint8_t data[8];
+};
+
+bool wanted(uint16_t id) {
+    return id == dbc::kinematics::ID || id == dbc::wheel_speeds::ID || id == dbc::speed::ID;
+}
+
+// SavvyCAN: Time Stamp (us),ID,Extended,Dir,Bus,LEN,D1,..,D8
+size_t loadCsv(const char* path, std::vector<Frame>& out, size_t& allFrames, uint32_t& spanMs) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "can't open %s\n", path);
+        return 0;
+    }
+    char line[256];
+    size_t n = 0;
+    unsigned long long firstUs = 0, lastUs = 0;
+    bool haveFirst = false;
+    while (fgets(line, sizeof(line), f)) {
+        char* fields[16];
+        int count = 0;
+        for (char* p = strtok(line, ",\r\n"); p && count < 16; p = strtok(nullptr, ",\r\n")) fields[count++] = p;
+        if (count < 6 || strcmp(fields[2], "false") != 0) continue;
+        char* end;
+        const unsigned long long us = strtoull(fields[0], &end, 10);
+        if (*end != '\0') continue;
+        if (!haveFirst) {
+            firstUs = us;
+            haveFirst = true;
+        }
+        lastUs = us;
+        allFrames++;
+        const unsigned long id = strtoul(fields[1], &end, 16);
+        if (*end != '\0' || id >= 0x800 || !wanted((uint16_t)id)) continue;
+        Frame fr = {};
+        fr.ms = (uint32_t)((us - firstUs) / 1000);
+        fr.id = (uint16_t)id;
+        const int length = atoi(fields[5]);
+        for (int i = 0; i < length && i < 8 && 6 + i < count; i++) fr.data[i] = (uint8_t)strtoul(fields[6 + i], nullptr, 16);
+        out.push_back(fr);
+        n++;
+    }
+    fclose(f);
+    spanMs = haveFirst ? (uint32_t)((lastUs - firstUs) / 1000) : 0;
+    return n;
+}
+
+void feed(const Frame& f, uint32_t ms) {
+    switch (f.id) {
+        case dbc::kinematics::ID: kinOnKinematics(f.data, ms); break;
+        case dbc::wheel_speeds::ID: kinOnWheelSpeeds(f.data, ms); break;
+        case dbc::speed::ID: kinOnSpeed(f.data, ms); break;
+        default: break;
+    }
+}
+
+// The same two one-pole stages in doubles, fed the same samples, primed by
+// the first one. Long accel is worked out here from speed on its own.
+struct Reference {
+    double alpha[KIN_CHANNEL_COUNT];
+    double s1[KIN_CHANNEL_COUNT];
+    double s2[KIN_CHANNEL_COUNT];
+    bool primed[KIN_CHANNEL_COUNT];
+    bool haveSpeed;
+    uint16_t lastSpeed;
+    uint32_t lastSpeedMs;
+
+    void init(const KinDecimator& d) {
+        *this = {};
+        for (int ch = 0; ch < KIN_CHANNEL_COUNT; ch++) alpha[ch] = d.alphaQ16[ch] / 65536.0;
+    }
+
+    void add(int ch, double x) {
+        if (!primed[ch]) {
+            s1[ch] = s2[ch] = x;
+            primed[ch] = true;
+            return;
+        }
+        s1[ch] += (x - s1[ch]) * alpha[ch];
+        s2[ch] += (s1[ch] - s2[ch]) * alpha[ch];
+    }
+
+    void feed(const Frame& f) {
+        const uint8_t* d = f.data;
+        switch (f.id) {
+            case dbc::kinematics::ID:
+                add(KIN_YAW_RATE, (double)dbc::kinematics::yaw_rate_raw(d) - 512);
+                add(KIN_ACCEL_Y, (double)dbc::kinematics::accel_y_raw(d) - 512);
+                break;
+            case dbc::wheel_speeds::ID:
+                add(KIN_WHEEL_FR, dbc::wheel_speeds::wheel_speed_fr_raw(d));
+                add(KIN_WHEEL_FL, dbc::wheel_speeds::wheel_speed_fl_raw(d));
+                add(KIN_WHEEL_RR, dbc::wheel_speeds::wheel_speed_rr_raw(d));
+                add(KIN_WHEEL_RL, dbc::wheel_speeds::wheel_speed_rl_raw(d));
+                break;
+            case dbc::speed::ID: {
+                const uint16_t v = dbc::speed::speed_raw(d);
+                add(KIN_SPEED, v);
+                if (!haveSpeed) {
+                    haveSpeed = true;
+                    lastSpeed = v;
+                    lastSpeedMs = f.ms;
+                } else if (f.ms - lastSpeedMs >= KIN_LONG_ACCEL_WINDOW_MS) {
+                    // 0.0062 mph = 2.7716 mm/s per step, to mm/s^2
+                    add(KIN_LONG_ACCEL, trunc((v - lastSpeed) * 2.7716 * 1000.0 / (f.ms - lastSpeedMs)));
+                    lastSpeed = v;
+                    lastSpeedMs = f.ms;
+                }
+                break;
+            }
+            default: break;
+        }
+    }
+};
+
+struct Consumer {
+    const char* name;
+    uint16_t periodMs;
+    uint32_t serviceEveryMs;  // 0 = after every frame
+    KinDecimator dec;
+    Reference ref;
+    uint32_t lastServiceMs;
+    uint32_t outputs;
+    uint32_t mismatches;
+    double worst;
+};
+
+void check(Consumer& c, const KinOutput& out) {
+    c.outputs++;
+    for (int ch = 0; ch < KIN_CHANNEL_COUNT; ch++) {
+        if (!(out.valid & (1u << ch)) || !c.ref.primed[ch]) continue;
+        const double err = fabs(out.raw[ch] - c.ref.s2[ch]);
+        if (err > c.worst) c.worst = err;
+        if (err > 1.0) {
+            if (c.mismatches < 5) {
+                printf("  %s: t=%u channel %d fixed %d, reference %.2f\n", c.name, out.ms, ch, out.raw[ch],
+                       c.ref.s2[ch]);
+            }
+            c.mismatches++;
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    // One capture per run: the ring and the peaks live for the whole process.
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s capture.csv\n", argv[0]);
+        return 2;
+    }
+    uint32_t failures = 0;
+    std::vector<Frame> frames;
+    size_t allFrames = 0;
+    uint32_t spanMs = 0;
+    const size_t n = loadCsv(argv[1], frames, allFrames, spanMs);
+    printf("%s: %zu kinematics frames of %zu, %.1f s\n", argv[1], n, allFrames, spanMs / 1000.0);
+    if (frames.empty() || spanMs == 0) return 2;
+
+    // Accuracy; the lagging consumer is only there to count overruns.
+    Consumer consumers[] = {
+        {"100ms", 100, 0, {}, {}, 0, 0, 0, 0},
+        {"20ms", 20, 0, {}, {}, 0, 0, 0, 0},
+        {"100ms/2s", 100, 2000, {}, {}, 0, 0, 0, 0},
+    };
+    for (Consumer& c : consumers) {
+        kinDecimatorInit(c.dec, c.periodMs, frames[0].ms);
+        c.ref.init(c.dec);
+        c.lastServiceMs = frames[0].ms;
+    }
+    const KinStats before = kinStats();
+    for (const Frame& f : frames) {
+        feed(f, f.ms);
+        for (Consumer& c : consumers) {
+            if (c.serviceEveryMs) {
+                if (f.ms - c.lastServiceMs < c.serviceEveryMs) continue;
+                c.lastServiceMs = f.ms;
+                KinOutput out;
+                kinDecimatorService(c.dec, f.ms, out);
+                continue;
+            }
+            c.ref.feed(f);
+            KinOutput out;
+            if (kinDecimatorService(c.dec, f.ms, out)) check(c, out);
+        }
+    }
+    const KinStats after = kinStats();
+
+    printf("  %-9s %8s %8s %9s %8s\n", "consumer", "outputs", "bad", "worst", "overrun");
+    for (const Consumer& c : consumers) {
+        if (c.serviceEveryMs) {
+            printf("  %-9s %8s %8s %9s %8u\n", c.name, "-", "-", "-", c.dec.overruns);
+            continue;
+        }
+        printf("  %-9s %8u %8u %9.3f %8u\n", c.name, c.outputs, c.mismatches, c.worst, c.dec.overruns);
+        failures += c.mismatches + c.dec.overruns;
+    }
+    printf("  %u ring entries; peaks: yaw %.2f deg/s, accel_y %.3f m/s2, long accel %.3f m/s2\n",
+           after.samples - before.samples, (double)kin::YawRate::toFloat(after.peaks.yawRate),
+           (double)kin::AccelY::toFloat(after.peaks.accelY), (double)kin::LongAccel::toFloat(after.peaks.longAccel));
+
+    // Cost: hooks plus one consumer, as loop() would run them.
+    KinDecimator dec;
+    kinDecimatorInit(dec, 100, spanMs + 1);
+    KinOutput out;
+    volatile int32_t sink = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        const uint32_t base = (r + 1) * (spanMs + 1);  // after the accuracy pass
+        for (const Frame& f : frames) {
+            feed(f, base + f.ms);
+            if (kinDecimatorService(dec, base + f.ms, out)) sink = sink + out.raw[KIN_SPEED];
+        }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    (void)sink;
+    const double nsPerFrame =
+        std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double)frames.size() * BENCH_ROUNDS);
+    const double framesPerS = frames.size() * 1000.0 / spanMs;
+    const double usPerS = nsPerFrame * framesPerS / 1000.0;
+    printf("  %.1f ns/frame, %.0f frames/s -> %.1f us per second of capture (%.4f%% of a core)\n", nsPerFrame,
+           framesPerS, usPerS, usPerS / 1e4);
+    printf("\n%s: %u mismatches\n", failures ? "FAIL" : "OK", failures);
+    return failures ? 1 : 0;
+}
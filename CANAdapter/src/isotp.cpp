@@ -0,0 +1,257 @@
+#include "isotp.h"
+
+#include "can_tx.h"
+
+namespace {
+
+constexpr unsigned long N_BS_TIMEOUT_MS = 1000; // waiting for the ECU's FC
+constexpr unsigned long N_CR_TIMEOUT_MS = 1000; // waiting for the next CF
+constexpr uint8_t MAX_FC_WAITS = 10;            // FC.WAIT frames before giving up
+
+constexpr uint8_t PCI_SF = 0x00;
+constexpr uint8_t PCI_FF = 0x10;
+constexpr uint8_t PCI_CF = 0x20;
+constexpr uint8_t PCI_FC = 0x30;
+
+constexpr uint8_t FC_CTS = 0x00;
+constexpr uint8_t FC_WAIT = 0x01;
+constexpr uint8_t FC_OVERFLOW = 0x02;
+
+void sendPadded(CanTxClass cls, uint32_t id, const uint8_t* data, uint8_t len) {
+    uint8_t frame[8] = {0};
+    memcpy(frame, data, len);
+    sendCANFrame(cls, id, frame, 8);
+}
+
+void sendFlowControl(const IsoTpLink& link, uint8_t status) {
+    const uint8_t fc[3] = {(uint8_t)(PCI_FC | status), link.fcBlockSize, link.fcStMin};
+    sendPadded(CAN_TX_FC, link.txId, fc, 3);
+}
+
+// STmin 0x00..0x7F is ms, 0xF1..0xF9 is 100..900 us (rounded up to 1 ms here),
+// anything else is reserved and treated as the 127 ms maximum.
+uint8_t stMinToMs(uint8_t stMin) {
+    if (stMin <= 0x7F) return stMin;
+    if (stMin >= 0xF1 && stMin <= 0xF9) return 1;
+    return 0x7F;
+}
+
+void abortRx(IsoTpLink& link) {
+    link.rxActive = false;
+    link.rxLen = 0;
+    link.rxExpected = 0;
+}
+
+void abortTx(IsoTpLink& link) {
+    link.txActive = false;
+    link.txWaitFc = false;
+}
+
+void sendNextConsecutiveFrame(IsoTpLink& link, unsigned long now) {
+    uint8_t cf[8] = {(uint8_t)(PCI_CF | link.txNextSeq)};
+    uint16_t chunk = link.txLen - link.txOffset;
+    if (chunk > 7) chunk = 7;
+    memcpy(&cf[1], &link.txBuf[link.txOffset], chunk);
+    sendCANFrame(CAN_TX_PID, link.txId, cf, 8);
+
+    link.txOffset += chunk;
+    link.txNextSeq = (link.txNextSeq + 1) & 0x0F;
+    link.txLastMs = now;
+
+    if (link.txOffset >= link.txLen) {
+        abortTx(link); // done
+        return;
+    }
+    if (link.txBlockSize != 0 && --link.txBlockRemaining == 0) {
+        link.txWaitFc = true;
+    }
+}
+
+IsoTpRxResult onFlowControl(IsoTpLink& link, const uint8_t* b, uint8_t len, unsigned long now) {
+    if (!link.txActive || !link.txWaitFc || len < 3) {
+        link.unexpectedFrames++;
+        return ISOTP_RX_NONE;
+    }
+
+    switch (b[0] & 0x0F) {
+        case FC_CTS:
+            link.txWaitFc = false;
+            link.txWaitCount = 0;
+            link.txBlockSize = b[1];
+            link.txBlockRemaining = b[1];
+            link.txStMinMs = stMinToMs(b[2]);
+            // Let the first CF of the block go out straight away.
+            link.txLastMs = now - link.txStMinMs;
+            return ISOTP_RX_NONE;
+        case FC_WAIT:
+            if (++link.txWaitCount > MAX_FC_WAITS) {
+                link.timeouts++;
+                abortTx(link);
+                return ISOTP_RX_ERROR;
+            }
+            link.txLastMs = now; // restart N_Bs
+            return ISOTP_RX_NONE;
+        case FC_OVERFLOW:
+        default:
+            link.overflows++;
+            abortTx(link);
+            return ISOTP_RX_ERROR;
+    }
+}
+
+} // namespace
+
+void isoTpInit(IsoTpLink& link, uint32_t txId, uint32_t rxId, uint8_t blockSize, uint8_t stMin,
+               bool fcExternal) {
+    memset(&link, 0, sizeof(link));
+    link.txId = txId;
+    link.rxId = rxId;
+    link.fcBlockSize = blockSize;
+    link.fcStMin = stMin;
+    link.fcExternal = fcExternal;
+}
+
+void isoTpReset(IsoTpLink& link) {
+    abortRx(link);
+    abortTx(link);
+}
+
+bool isoTpSend(IsoTpLink& link, const uint8_t* data, uint16_t len, unsigned long now) {
+    if (len == 0 || len > ISOTP_TX_BUFFER_SIZE || link.txActive) return false;
+
+    if (len <= 7) {
+        uint8_t sf[8] = {(uint8_t)(PCI_SF | len)};
+        memcpy(&sf[1], data, len);
+        sendCANFrame(CAN_TX_PID, link.txId, sf, 8);
+        return true;
+    }
+
+    memcpy(link.txBuf, data, len);
+    link.txLen = len;
+
+    uint8_t ff[8] = {(uint8_t)(PCI_FF | (len >> 8)), (uint8_t)(len & 0xFF)};
+    memcpy(&ff[2], data, 6);
+    sendCANFrame(CAN_TX_PID, link.txId, ff, 8);
+
+    link.txOffset = 6;
+    link.txNextSeq = 1;
+    link.txActive = true;
+    link.txWaitFc = true;
+    link.txWaitCount = 0;
+    link.txLastMs = now;
+    return true;
+}
+
+IsoTpRxResult isoTpOnFrame(IsoTpLink& link, const CanDriverFrame& frame, unsigned long now) {
+    if (frame.id != link.rxId || frame.length < 1) return ISOTP_RX_NONE;
+    const uint8_t* b = frame.data;
+    const uint8_t len = frame.length;
+
+    switch (b[0] & 0xF0) {
+        case PCI_SF: {
+            const uint8_t n = b[0] & 0x0F;
+            if (n == 0 || n > 7 || n + 1 > len) {
+                link.unexpectedFrames++;
+                return ISOTP_RX_NONE;
+            }
+            // A new SF/FF always replaces a half-finished reception.
+            abortRx(link);
+            memcpy(link.rxBuf, &b[1], n);
+            link.rxLen = n;
+            link.rxExpected = n;
+            link.rxMessages++;
+            return ISOTP_RX_COMPLETE;
+        }
+
+        case PCI_FF: {
+            if (len < 8) {
+                link.unexpectedFrames++;
+                return ISOTP_RX_NONE;
+            }
+            const uint16_t total = ((uint16_t)(b[0] & 0x0F) << 8) | b[1];
+            // A message that would have fitted in an SF (or an FF of 0) is
+            // malformed; no FC, and whatever was in progress carries on.
+            if (total < ISOTP_FF_MIN_LENGTH) {
+                link.unexpectedFrames++;
+                return ISOTP_RX_NONE;
+            }
+            abortRx(link);
+            if (total > ISOTP_RX_BUFFER_SIZE) {
+                link.overflows++;
+                if (!link.fcExternal) sendFlowControl(link, FC_OVERFLOW);
+                return ISOTP_RX_ERROR;
+            }
+            // FC first: the ECU's N_Bs clock is running.
+            if (!link.fcExternal) sendFlowControl(link, FC_CTS);
+            memcpy(link.rxBuf, &b[2], 6);
+            link.rxLen = 6;
+            link.rxExpected = total;
+            link.rxNextSeq = 1;
+            link.rxBlockCount = 0;
+            link.rxLastMs = now;
+            link.rxActive = true;
+            return ISOTP_RX_IN_PROGRESS;
+        }
+
+        case PCI_CF: {
+            if (!link.rxActive) {
+                link.unexpectedFrames++;
+                return ISOTP_RX_NONE;
+            }
+            if ((b[0] & 0x0F) != link.rxNextSeq) {
+                link.seqErrors++;
+                abortRx(link);
+                return ISOTP_RX_ERROR;
+            }
+            uint16_t chunk = link.rxExpected - link.rxLen;
+            if (chunk > 7) chunk = 7;
+            if (chunk > len - 1) chunk = len - 1;
+            memcpy(&link.rxBuf[link.rxLen], &b[1], chunk);
+            link.rxLen += chunk;
+            link.rxNextSeq = (link.rxNextSeq + 1) & 0x0F;
+            link.rxLastMs = now;
+
+            if (link.rxLen >= link.rxExpected) {
+                link.rxActive = false;
+                link.rxMessages++;
+                return ISOTP_RX_COMPLETE;
+            }
+            if (link.fcBlockSize != 0 && ++link.rxBlockCount >= link.fcBlockSize) {
+                link.rxBlockCount = 0;
+                sendFlowControl(link, FC_CTS);
+            }
+            return ISOTP_RX_IN_PROGRESS;
+        }
+
+        case PCI_FC:
+            return onFlowControl(link, b, len, now);
+
+        default:
+            link.unexpectedFrames++;
+            return ISOTP_RX_NONE;
+    }
+}
+
+IsoTpRxResult isoTpPoll(IsoTpLink& link, unsigned long now) {
+    IsoTpRxResult result = ISOTP_RX_NONE;
+
+    if (link.rxActive && now - link.rxLastMs >= N_CR_TIMEOUT_MS) {
+        link.timeouts++;
+        abortRx(link);
+        result = ISOTP_RX_ERROR;
+    }
+
+    if (link.txActive) {
+        if (link.txWaitFc) {
+            if (now - link.txLastMs >= N_BS_TIMEOUT_MS) {
+                link.timeouts++;
+                abortTx(link);
+                result = ISOTP_RX_ERROR;
+            }
+        } else if (now - link.txLastMs >= link.txStMinMs) {
+            sendNextConsecutiveFrame(link, now);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "can_driver.h"
+
+// ISO 15765-2 (ISO-TP) transport for one request/response ID pair, e.g.
+// 0x7E2 -> 0x7EA. Handles SF/FF/CF/FC, reassembles into a preallocated
+// buffer, and enforces the sequence numbers and N_Bs/N_Cr timeouts.
+// Everything is polled from loop(); nothing here allocates.
+
+constexpr uint16_t ISOTP_RX_BUFFER_SIZE = 128; // 0x2181 block voltages are ~36 bytes
+constexpr uint16_t ISOTP_TX_BUFFER_SIZE = 64;
+constexpr uint16_t ISOTP_FF_MIN_LENGTH = 8;    // anything shorter fits in an SF
+
+enum IsoTpRxResult : uint8_t {
+    ISOTP_RX_NONE = 0,     // frame not for us / ignored
+    ISOTP_RX_IN_PROGRESS,  // FF or CF accepted, more to come
+    ISOTP_RX_COMPLETE,     // rxBuf/rxLen hold a full message
+    ISOTP_RX_ERROR         // sequence error, overflow or timeout, exchange aborted
+};
+
+struct IsoTpLink {
+    uint32_t txId;              // our requests + FC go here
+    uint32_t rxId;              // ECU replies arrive here
+    uint8_t fcBlockSize;        // BS we advertise (0 = send everything)
+    uint8_t fcStMin;            // STmin we advertise
+    bool fcExternal;            // FC for first frames is sent by the RX path (isotp_fc)
+
+    // receive side
+    bool rxActive;
+    uint8_t rxBuf[ISOTP_RX_BUFFER_SIZE];
+    uint16_t rxLen;             // bytes reassembled so far
+    uint16_t rxExpected;        // total length from SF/FF
+    uint8_t rxNextSeq;
+    uint8_t rxBlockCount;       // CFs since the last FC we sent
+    unsigned long rxLastMs;     // for N_Cr
+
+    // transmit side
+    bool txActive;
+    bool txWaitFc;
+    uint8_t txBuf[ISOTP_TX_BUFFER_SIZE];
+    uint16_t txLen;
+    uint16_t txOffset;
+    uint8_t txNextSeq;
+    uint8_t txBlockSize;        // BS from the ECU's FC
+    uint8_t txBlockRemaining;
+    uint8_t txStMinMs;          // STmin from the ECU's FC, rounded up to ms
+    uint8_t txWaitCount;
+    unsigned long txLastMs;     // for N_Bs and STmin
+
+    // stats
+    uint32_t rxMessages;
+    uint32_t seqErrors;
+    uint32_t timeouts;
+    uint32_t overflows;
+    uint32_t unexpectedFrames;
+};
+
+void isoTpInit(IsoTpLink& link, uint32_t txId, uint32_t rxId, uint8_t blockSize = 0, uint8_t stMin = 0,
+               bool fcExternal = false);
+void isoTpReset(IsoTpLink& link);
+bool isoTpSend(IsoTpLink& link, const uint8_t* data, uint16_t len, unsigned long now);
+IsoTpRxResult isoTpOnFrame(IsoTpLink& link, const CanDriverFrame& frame, unsigned long now);
+IsoTpRxResult isoTpPoll(IsoTpLink& link, unsigned long now);
@@ -0,0 +1,134 @@
+#include "isotp_fc.h"
+
+#include "can_tx.h"
+#include "isotp.h"
+#include "trace.h"
+
+namespace {
+
+constexpr uint8_t PCI_FF = 0x10;
+constexpr uint8_t FC_CTS = 0x30;
+constexpr uint8_t FC_OVERFLOW = 0x32;
+
+struct InFlight {
+    bool armed;
+    uint32_t rxId;
+    uint32_t txId;
+    uint8_t positiveService;
+    uint8_t blockSize;
+    uint8_t stMin;
+};
+
+// Written by loop() (arm/disarm) and read by the CAN RX task.
+portMUX_TYPE fcMux = portMUX_INITIALIZER_UNLOCKED;
+InFlight inFlight[FC_MAX_INFLIGHT] = {};
+FcStats stats = {};
+
+// Only called with fcMux held.
+InFlight* findSlot(uint32_t rxId) {
+    for (InFlight& f : inFlight) {
+        if (f.rxId == rxId && f.rxId != 0) return &f;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+void fcArm(uint32_t rxId, uint32_t txId, uint8_t service, uint8_t blockSize, uint8_t stMin) {
+    portENTER_CRITICAL(&fcMux);
+    InFlight* f = findSlot(rxId);
+    if (f == nullptr) {
+        for (InFlight& free : inFlight) {
+            if (free.rxId == 0) { f = &free; break; }
+        }
+    }
+    if (f != nullptr) {
+        f->rxId = rxId;
+        f->txId = txId;
+        f->positiveService = service | 0x40;
+        f->blockSize = blockSize;
+        f->stMin = stMin;
+        f->armed = true;
+    }
+    portEXIT_CRITICAL(&fcMux);
+}
+
+void fcDisarm(uint32_t rxId) {
+    portENTER_CRITICAL(&fcMux);
+    InFlight* f = findSlot(rxId);
+    if (f != nullptr) f->armed = false;
+    portEXIT_CRITICAL(&fcMux);
+}
+
+bool fcOnRxFrame(const CanDriverFrame& frame, uint32_t rxUs) {
+    const uint8_t* b = frame.data;
+    if (frame.length < 8 || (b[0] & 0xF0) != PCI_FF) return false;
+    // Malformed FF: no FC; the link counts it when it sees the frame.
+    const uint16_t total = ((uint16_t)(b[0] & 0x0F) << 8) | b[1];
+    if (total < ISOTP_FF_MIN_LENGTH) return false;
+
+    uint8_t fc[8] = {0};
+    uint32_t txId = 0;
+    portENTER_CRITICAL(&fcMux);
+    InFlight* f = findSlot(frame.id);
+    if (f == nullptr) { // not a diag response ID at all
+        portEXIT_CRITICAL(&fcMux);
+        return false;
+    }
+    // FF: [1L][LL][svc+40]... Only answer the reply to what we asked.
+    const bool ours = f->armed && b[2] == f->positiveService;
+    if (ours) {
+        const bool overflow = total > ISOTP_RX_BUFFER_SIZE;
+        txId = f->txId;
+        fc[0] = overflow ? FC_OVERFLOW : FC_CTS;
+        fc[1] = f->blockSize;
+        fc[2] = f->stMin;
+        f->armed = false; // one FF per request; mid-block FCs stay with the link
+    } else {
+        stats.unarmedFirstFrames++;
+    }
+    portEXIT_CRITICAL(&fcMux);
+    if (!ours) return false;
+
+    // Enqueue never blocks the RX task. A dropped FC just lets the request
+    // time out like any other lost frame.
+    const bool sent = canTxEnqueue(CAN_TX_FC, txId, fc, 8, false, false, rxUs);
+    if (sent) traceEvent(TRACE_FC, TRACE_NO_SENSOR, (uint16_t)(frame.id | (fc[0] == FC_OVERFLOW ? 0x8000 : 0)));
+
+    portENTER_CRITICAL(&fcMux);
+    if (!sent) {
+        stats.txFailed++;
+    } else if (fc[0] == FC_OVERFLOW) {
+        stats.overflowSent++;
+    } else {
+        stats.sent++;
+    }
+    portEXIT_CRITICAL(&fcMux);
+    return sent;
+}
+
+FcStats fcStats() {
+    portENTER_CRITICAL(&fcMux);
+    const FcStats copy = stats;
+    portEXIT_CRITICAL(&fcMux);
+    return copy;
+}
+
+void fcPrintStats() {
+    const FcStats s = fcStats();
+    const CanTxClassStats tx = canTxStats(CAN_TX_FC);
+    Serial.printf("FC sent=%lu overflow=%lu tx_failed=%lu unarmed_ff=%lu max=%luus\n",
+                  (unsigned long)s.sent, (unsigned long)s.overflowSent,
+                  (unsigned long)s.txFailed, (unsigned long)s.unarmedFirstFrames,
+                  (unsigned long)tx.maxLatencyUs);
+    // FF received -> FC handed to the driver
+    for (uint8_t i = 0; i < CAN_TX_LATENCY_BINS; i++) {
+        if (tx.latency[i] == 0) continue;
+        if (i + 1 < CAN_TX_LATENCY_BINS) {
+            Serial.printf("  %5lu-%5luus %lu\n", i ? 1UL << i : 0UL, (1UL << (i + 1)) - 1,
+                          (unsigned long)tx.latency[i]);
+        } else {
+            Serial.printf("  >=%5luus     %lu\n", 1UL << i, (unsigned long)tx.latency[i]);
+        }
+    }
+}
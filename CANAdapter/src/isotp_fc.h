@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "can_driver.h"
+
+// Flow control straight from the CAN receive path. Lanes arm an entry when a
+// request goes out; when a first frame for an armed entry arrives, the
+// can_rx task answers with FC right there instead of waiting for loop() to
+// drain the frame. The FC goes into can_tx's top class, so the FF-to-wire
+// latency shows up in that class's stats. The ISO-TP links are initialised with fcExternal set so
+// they don't send a second FC for the same first frame.
+
+constexpr uint8_t FC_MAX_INFLIGHT = 8;
+
+struct FcStats {
+    uint32_t sent;           // CTS frames queued from the RX path
+    uint32_t overflowSent;   // FF longer than the reassembly buffer
+    uint32_t txFailed;       // FC class queue full when the FF came in
+    uint32_t unarmedFirstFrames;
+};
+
+// Loop side. service is the request's service byte; the FF must echo it + 0x40.
+void fcArm(uint32_t rxId, uint32_t txId, uint8_t service, uint8_t blockSize, uint8_t stMin);
+void fcDisarm(uint32_t rxId);
+
+// RX side. rxUs is when the frame was received. Returns true if FC was queued.
+bool fcOnRxFrame(const CanDriverFrame& frame, uint32_t rxUs);
+
+FcStats fcStats();   // snapshot
+void fcPrintStats();
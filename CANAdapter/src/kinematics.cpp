@@ -0,0 +1,178 @@
+#include "kinematics.h"
+
+#include "bus_profile.h"
+#include "can_decoders.h"
+
+namespace {
+
+constexpr uint32_t RING_MASK = KIN_RING_SIZE - 1;
+static_assert((KIN_RING_SIZE & RING_MASK) == 0, "KIN_RING_SIZE must be a power of two");
+
+constexpr uint8_t Q = 8;                  // fractional bits of the filter state
+constexpr int32_t RAW_BITS = 24;          // ring entries carry a 24-bit signed raw
+
+// One entry per channel sample. Written and read only from loop().
+struct Slot {
+    uint32_t ms;
+    uint32_t word;                        // channel << 24 | raw & 0xFFFFFF
+};
+
+Slot ring[KIN_RING_SIZE] = {};
+uint32_t head = 0;                        // entries ever written
+
+uint32_t frames = 0;
+uint32_t samples = 0;
+KinPeaks peaks = {};
+
+uint16_t lastSpeed = 0;                   // long accel: speed at the start of the window
+uint32_t lastSpeedMs = 0;
+bool haveSpeed = false;
+
+// Nominal gap between samples of each channel, from the recorded bus rates.
+constexpr uint16_t busPeriodMs(uint16_t id) {
+    for (const BusProfileEntry& e : busProfile) {
+        if (e.id == id && e.deciHz > 0) return (uint16_t)((10000u + e.deciHz / 2) / e.deciHz);
+    }
+    return 100;
+}
+
+constexpr uint16_t INPUT_PERIOD_MS[KIN_CHANNEL_COUNT] = {
+    busPeriodMs(dbc::kinematics::ID),   busPeriodMs(dbc::kinematics::ID),
+    busPeriodMs(dbc::wheel_speeds::ID), busPeriodMs(dbc::wheel_speeds::ID),
+    busPeriodMs(dbc::wheel_speeds::ID), busPeriodMs(dbc::wheel_speeds::ID),
+    busPeriodMs(dbc::speed::ID),        KIN_LONG_ACCEL_WINDOW_MS,
+};
+
+inline void push(KinChannel ch, int32_t raw, uint32_t nowMs) {
+    Slot& s = ring[head++ & RING_MASK];
+    s.ms = nowMs;
+    s.word = (uint32_t)ch << RAW_BITS | ((uint32_t)raw & 0xFFFFFFu);
+    samples++;
+}
+
+template <typename T>
+inline void keepPeak(T& peak, T v) {
+    if ((v < 0 ? -v : v) > (peak < 0 ? -peak : peak)) peak = v;
+}
+
+// One Speed step, 0.0062 mph = 2.7716 mm/s, x10000.
+constexpr int32_t SPEED_STEP_MM_S_X10K = 27716;
+
+void updateLongAccel(uint16_t speed, uint32_t nowMs) {
+    if (!haveSpeed) {
+        lastSpeed = speed;
+        lastSpeedMs = nowMs;
+        haveSpeed = true;
+        return;
+    }
+    const uint32_t dt = nowMs - lastSpeedMs;
+    if (dt < KIN_LONG_ACCEL_WINDOW_MS) return;
+    // mm/s^2 = dv * 2.7716 mm/s / (dt / 1000 s)
+    const int32_t accel = (int32_t)(((int64_t)((int32_t)speed - lastSpeed) * SPEED_STEP_MM_S_X10K) / ((int64_t)dt * 10));
+    push(KIN_LONG_ACCEL, accel, nowMs);
+    keepPeak(peaks.longAccel, accel);
+    lastSpeed = speed;
+    lastSpeedMs = nowMs;
+}
+
+inline int32_t signExtend24(uint32_t w) {
+    return (int32_t)(w << (32 - RAW_BITS)) >> (32 - RAW_BITS);
+}
+
+// y += (x - y) * alpha, both stages, in Q8.
+inline void filter(KinDecimator& d, uint8_t ch, int32_t raw) {
+    const int32_t x = raw * (1 << Q);
+    if (!(d.valid & (1u << ch))) {
+        d.stage1[ch] = x;
+        d.stage2[ch] = x;
+        d.valid |= (uint16_t)(1u << ch);
+        return;
+    }
+    const int32_t a = d.alphaQ16[ch];
+    d.stage1[ch] += (int32_t)(((int64_t)(x - d.stage1[ch]) * a) >> 16);
+    d.stage2[ch] += (int32_t)(((int64_t)(d.stage1[ch] - d.stage2[ch]) * a) >> 16);
+}
+
+} // namespace
+
+void kinOnKinematics(const uint8_t* d, uint32_t nowMs) {
+    const int16_t yaw = (int16_t)((int32_t)dbc::kinematics::yaw_rate_raw(d) - 512);
+    const int16_t accelY = (int16_t)((int32_t)dbc::kinematics::accel_y_raw(d) - 512);
+    frames++;
+    push(KIN_YAW_RATE, yaw, nowMs);
+    push(KIN_ACCEL_Y, accelY, nowMs);
+    keepPeak(peaks.yawRate, yaw);
+    keepPeak(peaks.accelY, accelY);
+}
+
+void kinOnWheelSpeeds(const uint8_t* d, uint32_t nowMs) {
+    namespace ws = dbc::wheel_speeds;
+    frames++;
+    push(KIN_WHEEL_FR, (int32_t)ws::wheel_speed_fr_raw(d), nowMs);
+    push(KIN_WHEEL_FL, (int32_t)ws::wheel_speed_fl_raw(d), nowMs);
+    push(KIN_WHEEL_RR, (int32_t)ws::wheel_speed_rr_raw(d), nowMs);
+    push(KIN_WHEEL_RL, (int32_t)ws::wheel_speed_rl_raw(d), nowMs);
+}
+
+void kinOnSpeed(const uint8_t* d, uint32_t nowMs) {
+    const uint16_t speed = (uint16_t)dbc::speed::speed_raw(d);
+    frames++;
+    push(KIN_SPEED, speed, nowMs);
+    updateLongAccel(speed, nowMs);
+}
+
+void kinDecimatorInit(KinDecimator& d, uint16_t periodMs, uint32_t nowMs) {
+    d = {};
+    d.cursor = head;
+    d.periodMs = periodMs;
+    d.nextMs = nowMs + periodMs;
+    // alpha = dt / (tau + dt) with tau = period / 3, per stage.
+    const uint32_t tau = periodMs / 3;
+    for (uint8_t ch = 0; ch < KIN_CHANNEL_COUNT; ch++) {
+        const uint32_t dt = INPUT_PERIOD_MS[ch];
+        d.alphaQ16[ch] = (uint16_t)((65535u * dt) / (tau + dt));
+    }
+}
+
+bool kinDecimatorService(KinDecimator& d, uint32_t nowMs, KinOutput& out) {
+    if (head - d.cursor > KIN_RING_SIZE) {
+        d.overruns += head - d.cursor - KIN_RING_SIZE;
+        d.cursor = head - KIN_RING_SIZE;
+    }
+    while (d.cursor != head) {
+        const uint32_t word = ring[d.cursor++ & RING_MASK].word;
+        filter(d, (uint8_t)(word >> RAW_BITS), signExtend24(word));
+    }
+
+    if ((int32_t)(nowMs - d.nextMs) < 0) return false;
+    d.nextMs += d.periodMs;
+    if ((int32_t)(nowMs - d.nextMs) >= 0) d.nextMs = nowMs + d.periodMs;  // we were away; don't burst
+    out.ms = nowMs;
+    out.valid = d.valid;
+    for (uint8_t ch = 0; ch < KIN_CHANNEL_COUNT; ch++) {
+        const int32_t y = d.stage2[ch];
+        out.raw[ch] = y >= 0 ? (y + (1 << (Q - 1))) >> Q : -((-y + (1 << (Q - 1))) >> Q);
+    }
+    return true;
+}
+
+KinStats kinStats() {
+    KinStats s;
+    s.frames = frames;
+    s.samples = samples;
+    s.peaks = peaks;
+    return s;
+}
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+void kinPrintStats() {
+    const KinStats s = kinStats();
+    Serial.printf("Kinematics: %lu frames, %lu samples, ring %u\n", (unsigned long)s.frames,
+                  (unsigned long)s.samples, KIN_RING_SIZE);
+    Serial.printf("  peak yaw %.1f deg/s  peak accel_y %.2f m/s2  peak long accel %.2f m/s2\n",
+                  (double)kin::YawRate::toFloat(s.peaks.yawRate), (double)kin::AccelY::toFloat(s.peaks.accelY),
+                  (double)kin::LongAccel::toFloat(s.peaks.longAccel));
+}
+#endif
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "fixed_point.h"
+
+// Passive vehicle dynamics from the broadcast frames: 0x024 KINEMATICS (yaw
+// rate, lateral accel), 0x0AA wheel speeds and 0x0B4 vehicle speed, all at
+// 41..82 Hz. 0x025 is left out: on this car it holds A2 37 98 00 through a
+// whole drive (850 deg by the DBC), so whatever it carries isn't the angle.
+//
+// The frame decoders only extract each signal's raw integer and append it to
+// a ring, so the per-frame cost on the receive path is a few loads and
+// stores. The hooks and the consumers all run from loop(), so the ring is a
+// plain array and index. Consumers each keep their own read cursor (any
+// number of them; the ring never waits for a reader) and a KinDecimator that
+// low-pass filters every sample in fixed point and hands back one value per
+// channel at the consumer's own period. A consumer that falls a whole ring
+// behind skips ahead and counts the overrun.
+//
+// Peaks (largest magnitude since boot) are kept by the writer from the full
+// rate samples, so a short spike the decimated streams smooth away still
+// shows up. Longitudinal acceleration is derived from vehicle speed.
+//
+// No Arduino types outside kinPrintStats(); the host replay tool builds this.
+
+namespace kin {
+
+// DBC scales as FixedScale types; the ring carries these raw integers. Yaw
+// and lateral accel have their 512-step offset removed (the DBC's -125 deg/s
+// and -18.375 m/s^2 are 512.3 and 512.0 steps).
+using YawRate    = FixedScale<int16_t, 244, 1000>;             // deg/s
+using AccelY     = FixedScale<int16_t, 3589, 100000>;          // m/s^2
+using WheelSpeed = FixedScale<uint16_t, 1, 100, -6767, 100>;   // km/h, 0x1A6F at rest
+using Speed      = FixedScale<uint16_t, 31, 5000>;             // mph
+using LongAccel  = FixedScale<int32_t, 1, 1000>;               // m/s^2, from Speed over LONG_ACCEL_WINDOW_MS
+
+} // namespace kin
+
+enum KinChannel : uint8_t {
+    KIN_YAW_RATE = 0,
+    KIN_ACCEL_Y,
+    KIN_WHEEL_FR,
+    KIN_WHEEL_FL,
+    KIN_WHEEL_RR,
+    KIN_WHEEL_RL,
+    KIN_SPEED,
+    KIN_LONG_ACCEL,
+    KIN_CHANNEL_COUNT
+};
+
+constexpr uint16_t KIN_RING_SIZE = 512;               // power of two; ~0.8 s of samples
+constexpr uint16_t KIN_LONG_ACCEL_WINDOW_MS = 200;
+
+// Frame decoders, called from the CAN dispatch with the frame payload.
+void kinOnKinematics(const uint8_t* d, uint32_t nowMs);
+void kinOnWheelSpeeds(const uint8_t* d, uint32_t nowMs);
+void kinOnSpeed(const uint8_t* d, uint32_t nowMs);
+
+struct KinOutput {
+    uint32_t ms;                          // when the period closed
+    uint16_t valid;                       // bit per channel that has had a sample
+    int32_t raw[KIN_CHANNEL_COUNT];       // filtered, in each channel's scale
+};
+
+// Two cascaded one-pole low-passes per channel (12 dB/octave), with the time
+// constant a third of the output period, in Q8 over the raw integer. Each
+// channel's coefficient comes from its nominal input rate.
+struct KinDecimator {
+    uint32_t cursor;                      // next ring entry to read
+    uint16_t periodMs;
+    uint32_t nextMs;
+    uint16_t valid;
+    uint16_t alphaQ16[KIN_CHANNEL_COUNT];
+    int32_t stage1[KIN_CHANNEL_COUNT];
+    int32_t stage2[KIN_CHANNEL_COUNT];
+    uint32_t overruns;                    // ring entries lost by falling behind
+};
+
+// Starts reading from the newest sample.
+void kinDecimatorInit(KinDecimator& d, uint16_t periodMs, uint32_t nowMs);
+// Filters everything new in the ring; true once per period, with out filled in.
+bool kinDecimatorService(KinDecimator& d, uint32_t nowMs, KinOutput& out);
+
+struct KinPeaks {
+    int16_t yawRate;       // signed value of the largest |sample| seen
+    int16_t accelY;
+    int32_t longAccel;
+};
+
+struct KinStats {
+    uint32_t frames;       // frames decoded
+    uint32_t samples;      // ring entries written
+    KinPeaks peaks;
+};
+
+KinStats kinStats();
+void kinPrintStats();
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <stdint.h>
+
+// Where loop() spends its time. Each pass is cut into named stages; closing a
+// stage reads the CPU cycle counter once and adds the cycles since the last
+// mark to that stage's log2 histogram, total, max and overrun count. The
+// whole loop is one more stage, measured from the start of one pass to the
+// start of the next, so it is the loop period including whatever the core
+// does between passes. One pass costs one counter read per stage.
+//
+// Histogram bucket 0 is everything under 2^(FIRST_LOG2 + 1) cycles, bucket b
+// is [2^(FIRST_LOG2 + b), 2^(FIRST_LOG2 + b + 1)), and the last bucket is
+// open ended: 2 us to 0.5 s at 240 MHz. Percentiles are read off the bucket
+// edges, so they are upper bounds to within a factor of two.
+//
+// The cycle counter is per core; profile a loop pinned to one (loop() is).
+// It wraps every 2^32 cycles, 17.9 s at 240 MHz, which is far longer than
+// any stage. Not thread safe: one Profile per loop.
+//
+// No Arduino types; DashDisplay carries a copy of this file.
+
+#if !defined(__XTENSA__)
+#include <chrono>
+#endif
+
+namespace loop_profile {
+
+constexpr uint8_t MAX_STAGES = 10;
+constexpr uint8_t BUCKETS = 20;
+constexpr uint8_t FIRST_LOG2 = 8;
+
+struct Stage {
+    const char* name;
+    uint32_t count;
+    uint32_t budgetCycles;      // 0 = no budget
+    uint32_t overruns;          // passes over budgetCycles
+    uint32_t maxCycles;
+    uint32_t windowMaxCycles;   // since the last takeWindowMax()
+    uint64_t totalCycles;
+    uint32_t hist[BUCKETS];
+};
+
+struct Profile {
+    uint32_t cpuMhz;
+    uint8_t stageCount;
+    Stage stages[MAX_STAGES];
+    Stage loop;                 // pass start to pass start
+    uint32_t passStart;
+    uint32_t mark;
+    bool running;
+};
+
+inline uint32_t cycles() {
+#if defined(__XTENSA__)
+    uint32_t c;
+    __asm__ __volatile__("rsr %0, ccount" : "=a"(c));
+    return c;
+#else
+    // Off target (host checks): nanoseconds, so cpuMhz is 1000.
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+inline uint8_t bucketOf(uint32_t c) {
+    if (c < (1u << (FIRST_LOG2 + 1))) return 0;
+    const uint8_t b = (uint8_t)(31 - __builtin_clz(c) - FIRST_LOG2);
+    return b < BUCKETS ? b : BUCKETS - 1;
+}
+
+// Lowest cycle count that lands in bucket b.
+inline uint32_t bucketFloor(uint8_t b) {
+    return b == 0 ? 0 : 1u << (FIRST_LOG2 + b);
+}
+
+inline void record(Stage& s, uint32_t c) {
+    s.count++;
+    s.totalCycles += c;
+    s.hist[bucketOf(c)]++;
+    if (c > s.maxCycles) s.maxCycles = c;
+    if (c > s.windowMaxCycles) s.windowMaxCycles = c;
+    if (s.budgetCycles != 0 && c > s.budgetCycles) s.overruns++;
+}
+
+// names[i] names stage i; count at most MAX_STAGES. A loop period over
+// loopBudgetUs counts as an overrun.
+inline void init(Profile& p, uint32_t cpuMhz, const char* const* names, uint8_t count, uint32_t loopBudgetUs) {
+    p = Profile();
+    p.cpuMhz = cpuMhz;
+    p.stageCount = count < MAX_STAGES ? count : MAX_STAGES;
+    for (uint8_t i = 0; i < p.stageCount; i++) p.stages[i].name = names[i];
+    p.loop.name = "loop";
+    p.loop.budgetCycles = loopBudgetUs * cpuMhz;
+}
+
+// Top of loop(): closes the previous period and starts the first stage.
+inline void beginPass(Profile& p) {
+    const uint32_t now = cycles();
+    if (p.running) record(p.loop, now - p.passStart);
+    p.passStart = now;
+    p.mark = now;
+    p.running = true;
+}
+
+// Closes stage i at this point; the next stage starts here. A stage closed
+// twice in one pass is recorded twice.
+inline void endStage(Profile& p, uint8_t stage) {
+    const uint32_t now = cycles();
+    if (stage < p.stageCount) record(p.stages[stage], now - p.mark);
+    p.mark = now;
+}
+
+inline uint32_t toUs(const Profile& p, uint32_t c) {
+    return p.cpuMhz ? c / p.cpuMhz : c;
+}
+
+// Upper edge of the bucket the permille'th pass falls in, in cycles, but
+// never above the max.
+inline uint32_t percentileCycles(const Stage& s, uint16_t permille) {
+    if (s.count == 0) return 0;
+    const uint64_t want = ((uint64_t)s.count * permille + 999) / 1000;
+    uint64_t seen = 0;
+    for (uint8_t b = 0; b < BUCKETS; b++) {
+        seen += s.hist[b];
+        if (seen < want) continue;
+        const uint32_t edge = b + 1 < BUCKETS ? bucketFloor(b + 1) - 1 : s.maxCycles;
+        return edge < s.maxCycles ? edge : s.maxCycles;
+    }
+    return s.maxCycles;
+}
+
+inline uint32_t takeWindowMax(Stage& s) {
+    const uint32_t m = s.windowMaxCycles;
+    s.windowMaxCycles = 0;
+    return m;
+}
+
+// Table and histogram on anything with printf (Serial).
+template <typename Out>
+void print(const Profile& p, Out& out) {
+    out.printf("stage          count  mean_us  p50_us  p99_us  max_us   over budget_us\n");
+    const uint8_t rows = (uint8_t)(p.stageCount + 1);
+    uint8_t lo = BUCKETS, hi = 0;
+    for (uint8_t i = 0; i < rows; i++) {
+        const Stage& s = i < p.stageCount ? p.stages[i] : p.loop;
+        const uint32_t mean = s.count ? (uint32_t)(s.totalCycles / s.count) : 0;
+        out.printf("%-10s %9lu %8lu %7lu %7lu %7lu %6lu %9lu\n", s.name, (unsigned long)s.count,
+                   (unsigned long)toUs(p, mean), (unsigned long)toUs(p, percentileCycles(s, 500)),
+                   (unsigned long)toUs(p, percentileCycles(s, 990)), (unsigned long)toUs(p, s.maxCycles),
+                   (unsigned long)s.overruns, (unsigned long)toUs(p, s.budgetCycles));
+        for (uint8_t b = 0; b < BUCKETS; b++) {
+            if (s.hist[b] == 0) continue;
+            if (b < lo) lo = b;
+            if (b > hi) hi = b;
+        }
+    }
+    if (lo > hi) return;
+
+    out.printf("\n   from_us");
+    for (uint8_t i = 0; i < rows; i++) out.printf(" %9.9s", i < p.stageCount ? p.stages[i].name : p.loop.name);
+    out.printf("\n");
+    for (uint8_t b = lo; b <= hi; b++) {
+        out.printf("%10lu", (unsigned long)toUs(p, bucketFloor(b)));
+        for (uint8_t i = 0; i < rows; i++) {
+            const Stage& s = i < p.stageCount ? p.stages[i] : p.loop;
+            out.printf(" %9lu", (unsigned long)s.hist[b]);
+        }
+        out.printf("\n");
+    }
+}
+
+} // namespace loop_profile
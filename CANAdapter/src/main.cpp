@@ -1,11 +1,29 @@
 #include <Arduino.h>
-#include <driver/twai.h>
-#include <esp32_can.h> /* https://github.com/collin80/esp32_can */
 #include <WiFi.h>
 #include <esp_now.h>
-
+#include <type_traits>
+#include <utility>
+
+#include "bus_load.h"
+#include "can_decoders.h"
+#include "can_dispatch.h"
+#include "can_id_stats.h"
+#include "can_driver.h"
+#include "can_rx.h"
 #include "can_tx.h"
+#include "dash_wire.h"
+#include "isotp.h"
+#include "isotp_fc.h"
+#include "kinematics.h"
+#include "loop_profile.h"
+#include "obd_mode01.h"
+#include "pid_catalog.h"
+#include "pid_discovery.h"
+#include "poll_scheduler.h"
+#include "signal_store.h"
 #include "steering_controls.h"
+#include "subscriptions.h"
+#include "trace.h"
 
 // ploo woo goo woo
 
@@ -32,108 +50,10 @@ static const uint32_t UART_BAUD = 230400; // can raise later if link is clean
 
 /////////////////////////////////////////////////////////utility functions////////////////////////////////////////////////////
 
-// Inline for performance-critical function
-inline uint16_t Process_Endian(uint8_t byte_msb, uint8_t byte_lsb) {
-  return (byte_msb << 8) | byte_lsb;
-}
-
-static volatile uint32_t canTxFailCount = 0;
-static volatile esp_err_t canTxLastError = ESP_OK;
-
-void sendCANFrame(uint32_t canID, const uint8_t* data, uint8_t dataLength, bool extended, bool rtr) {
-    twai_message_t txFrame = {};
-    txFrame.identifier = canID;
-    txFrame.data_length_code = (dataLength > 8) ? 8 : dataLength;
-    txFrame.extd = extended ? 1 : 0;
-    txFrame.rtr = rtr ? 1 : 0;
-
-    uint8_t copyLength = (dataLength > 8) ? 8 : dataLength;
-    if (copyLength > 0) {
-        memcpy(txFrame.data, data, copyLength);
-    }
-
-    esp_err_t result = twai_transmit(&txFrame, pdMS_TO_TICKS(4));
-    if (result != ESP_OK) {
-        canTxFailCount++;
-        canTxLastError = result;
-    }
-}
-
-// helper: Flow Control (CTS)
-inline void sendFlowControl(uint32_t req_id, uint8_t blockSize=0x00, uint8_t stMin=0x00) {
-  uint8_t fc[8] = {0x30, blockSize, stMin, 0,0,0,0,0}; // PCI=FC/CTS
-  sendCANFrame(req_id, fc, 8); // FC goes to the ECU's receive/request ID, e.g. 0x7E2.
-}
-
-// Optimized overload using stack array
-void sendCANFrame(uint32_t canID, std::initializer_list<uint8_t> data, bool extended, bool rtr) {
-    uint8_t dataArray[8];
-    uint8_t length = (data.size() > 8) ? 8 : data.size();
-
-    auto it = data.begin();
-    for (uint8_t i = 0; i < length; ++i, ++it) {
-        dataArray[i] = *it;
-    }
-
-    sendCANFrame(canID, dataArray, length, extended, rtr);
-}
-
-// Clean sensor request function - no more duplication!
-void sendSensorRequest(uint8_t sensorNum) {
-    switch (sensorNum) {
-        case 0: {
-            uint8_t req[] = {0x02, 0x21, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00}; // Battery Current
-            sendCANFrame(0x7E2, req, 8);
-            break;
-        }
-        case 1: {
-            uint8_t req[] = {0x02, 0x21, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00}; // Battery Voltage
-            sendCANFrame(0x7E2, req, 8);
-            // No FC here—decoder will send FC to 0x7EA only when FF 61 74 is seen
-            break;
-        }
-        case 2: {
-            uint8_t req[] = {0x02, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00}; // Coolant Temp
-            sendCANFrame(0x7E2, req, 8);
-            break;
-        }
-        case 3: {  // HV battery temps + intake temp (21 87)
-            uint8_t req[] = {0x02, 0x21, 0x87, 0,0,0,0,0};
-            sendCANFrame(0x7E2, req, 8);
-            // no FC here; we’ll send FC from the decoder when FF 61 87 arrives
-            break;
-        }
-        case 4: {
-            uint8_t req[] = {0x02, 0x01, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00}; // HV battery SoC
-            sendCANFrame(0x7E2, req, 8);
-            break;
-        }
-        case 5: {
-            // HV battery fan mode
-            uint8_t req[] = {0x02, 0x21, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00};
-            sendCANFrame(0x7E2, req, 8);
-            break;
-        }
-        case 6: {
-            // Torque CSV: MG1 temperature/revolution, ModeAndPID 2161, Header 7E2
-            uint8_t req[] = {0x02, 0x21, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00};
-            sendCANFrame(0x7E2, req, 8);
-            break;
-        }
-        case 7: {
-            // Torque CSV: MG2 temperature/revolution, ModeAndPID 2162, Header 7E2
-            uint8_t req[] = {0x02, 0x21, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00};
-            sendCANFrame(0x7E2, req, 8);
-            break;
-        }
-    }
-}
-
 /////////////////////////////////////////////////////////////global variables//////////////////////////////////////////////////////////
 uint8_t fanOverrideEnable = 0;
 
 // Sensor polling stuff
-volatile float g_sensors[24] = {0}; // All sensor values
 enum : uint8_t {
   SENSOR_HV_CURRENT = 0,
   SENSOR_HV_VOLTAGE = 1,
@@ -143,60 +63,151 @@ enum : uint8_t {
   SENSOR_HV_FAN_MODE = 5,
   SENSOR_MG1 = 6,
   SENSOR_MG2 = 7,
-  SENSOR_COUNT = 8,
+  SENSOR_HV_BLOCKS = 8,
+  SENSOR_WHEEL_SPEEDS = 9,  // 0x7B0 from here on: its own lane, alongside 0x7E2
+  SENSOR_YAW = 10,
+  SENSOR_CHASSIS_G = 11,
+  SENSOR_REGEN_COOP = 12,
+  SENSOR_COUNT = 13,
   SENSOR_NONE = 0xFF
 };
-bool waiting = false;               // Are we waiting for a response?
-uint8_t currentPollSensor = SENSOR_NONE;
-unsigned long requestTimeout = 0;   // When we sent the last request
+// Consumers subscribe to polled sensors by these numbers.
+static_assert((uint8_t)SENSOR_COUNT == (uint8_t)SUB_SIG_POLLED_COUNT && (uint8_t)SENSOR_MG2 == (uint8_t)SUB_SIG_MG2 &&
+              (uint8_t)SENSOR_HV_BLOCKS == (uint8_t)SUB_SIG_HV_BLOCKS &&
+              (uint8_t)SENSOR_REGEN_COOP == (uint8_t)SUB_SIG_REGEN_COOP,
+              "SENSOR_* must match the SUB_SIG_* wire IDs");
+
+// Diagnostic ECUs we can poll. Each one gets its own request slot, so a slow
+// 0x7E2 round trip never holds up a request to a different ECU.
+enum : uint8_t {
+  ECU_ENGINE = 0,  // 0x7E0 -> 0x7E8
+  ECU_HYBRID = 1,  // 0x7E2 -> 0x7EA
+  ECU_SKID = 2,    // 0x7B0 -> 0x7B8 (brake / skid control)
+  ECU_BODY = 3,    // 0x7C0 -> 0x7C8 (combination meter)
+  ECU_HVAC = 4,    // 0x7C4 -> 0x7CC
+  ECU_COUNT = 5,
+  ECU_NONE = 0xFF
+};
 
-const uint8_t fastSensors[] = {
-  SENSOR_HV_CURRENT,
-  SENSOR_HV_VOLTAGE
+struct DiagEcu {
+  uint32_t requestId;
+  uint32_t responseId;
 };
 
-const uint8_t slowSensors[] = {
-  SENSOR_ECT,
-  SENSOR_HV_TEMPS,
-  SENSOR_SOC,
-  SENSOR_HV_FAN_MODE,
-  SENSOR_MG1,
-  SENSOR_MG2
+const DiagEcu diagEcus[ECU_COUNT] = {
+  {0x7E0, 0x7E8},
+  {0x7E2, 0x7EA},
+  {0x7B0, 0x7B8},
+  {0x7C0, 0x7C8},
+  {0x7C4, 0x7CC}
 };
 
-const uint8_t FAST_POLLS_BETWEEN_SLOW_POLLS = 8;
-
-// Slow sensors are only polled when due and after enough fast polls have run.
-const unsigned long sensorIntervalMs[SENSOR_COUNT] = {
-  0,    // HV current: fast loop
-  0,    // HV voltage: fast loop
-  1000, // Coolant temp
-  1000, // HV temps (multi-frame)
-  1000, // SOC
-  1000, // Fan mode
-  1000, // MG1 temp/RPM
-  1000  // MG2 temp/RPM
+// What each polled sensor asks for, as a request in the generated PID catalog.
+// Replies are matched on the ECU's response ID plus the positive-response echo
+// (service | 0x40, pid), not on poll order.
+const uint8_t sensorRequests[SENSOR_COUNT] = {
+  PIDREQ_7E2_2198, // HV current
+  PIDREQ_7E2_2174, // HV voltage
+  PIDREQ_7E2_0105, // Coolant temp
+  PIDREQ_7E2_2187, // HV temps + intake temp
+  PIDREQ_7E2_015B, // SOC
+  PIDREQ_7E2_219B, // Fan mode
+  PIDREQ_7E2_2161, // MG1 temp/RPM
+  PIDREQ_7E2_2162, // MG2 temp/RPM
+  PIDREQ_7E2_2181, // HV block voltages (multi-frame)
+  PIDREQ_7B0_2103, // Wheel speeds
+  PIDREQ_7B0_2106, // Yaw rate
+  PIDREQ_7B0_2147, // Lateral/longitudinal G, steering angle
+  PIDREQ_7B0_2158  // Regen cooperation
+};
+uint8_t sensorEcu[SENSOR_COUNT] = {0}; // filled in setup() from the request headers
+
+// One outstanding transaction per ECU, each with its own ISO-TP link. Due
+// Mode 01 sensors on the same ECU share one request (see buildLaneBatch).
+struct EcuLane {
+  bool waiting;                // request sent, reply not finished yet
+  uint8_t sensor;              // sensor in flight (SENSOR_NONE when idle), batch[0]
+  uint8_t batch[OBD_MAX_PIDS_PER_REQUEST];
+  uint8_t batchCount;          // sensors in this request, 1 unless Mode 01 batched
+  bool discovering;            // in-flight request is a capability probe
+  uint8_t probeService;
+  uint8_t probePid;
+  bool capsApplied;            // discovery finished for this ECU
+  bool probeTurn;              // next free slot goes to a discovery probe
+  unsigned long requestMs;     // when the request went out
+  IsoTpLink isotp;
+};
+EcuLane ecuLanes[ECU_COUNT] = {};
+uint32_t diagStrayFrames = 0;   // replies that matched no in-flight request
+
+// Target poll period and how late a poll may be before it counts as a
+// deadline miss. The scheduler always serves the earliest deadline first, so
+// the fast lane keeps its rate even while slow sensors are outstanding.
+// Timeouts are learned per sensor from measured round trips.
+//
+// Slow sensors adapt between minMs and maxMs depending on whether their values
+// move (see sensorOutputs deadbands). The fast pair has idle-fill set instead:
+// when nothing is due they go early, down to minMs, so whatever the slow
+// sensors stop using ends up on the kW bar.
+//
+// The block voltages are a 35-byte reply (a first frame, our flow control and
+// four consecutive frames) on the same ECU as the fast pair. laneShare caps them
+// to that fraction of the lane's time at the measured round trip, and they
+// only go in gaps until they are overdue (see poll_scheduler.h).
+//
+// The chassis sensors are on the skid control ECU (0x7B0), so they run on
+// their own lane in parallel with 0x7E2 and cost the hybrid lane nothing.
+// Vehicle dynamics want a steady rate rather than adapting, so they are
+// fixed (minMs == maxMs) and share their lane round robin by deadline.
+struct PollTiming {
+  uint16_t periodMs;  // starting period
+  uint16_t jitterMs;
+  uint16_t minMs;
+  uint16_t maxMs;
+  bool idleFill;
+  uint16_t laneShare; // per mille of the lane, 0 = uncapped
 };
 
-const unsigned long sensorTimeoutMs[SENSOR_COUNT] = {
-  120, // HV current (multi-frame, value is in FF but we consume CF)
-  300, // HV voltage (multi-frame)
-  80,  // Coolant temp
-  300, // HV temps (multi-frame)
-  80,  // SOC
-  120, // Fan mode
-  120, // MG1 temp/RPM
-  120  // MG2 temp/RPM
+const PollTiming sensorTiming[SENSOR_COUNT] = {
+  {  30,  15,  15,   30, true ,   0}, // HV current: feeds the kW bar
+  {  30,  15,  15,   30, true ,   0}, // HV voltage: feeds the kW bar
+  {1000, 500,1000, 5000, false,   0}, // Coolant temp
+  {1000, 500, 500, 4000, false,   0}, // HV temps (multi-frame)
+  {1000, 500, 500, 4000, false,   0}, // SOC
+  {1000, 500, 500, 4000, false,   0}, // Fan mode
+  {1000, 500, 500, 4000, false,   0}, // MG1 temp/RPM
+  {1000, 500, 500, 4000, false,   0}, // MG2 temp/RPM
+  {2000,1000,1000,10000, false, 100}, // HV blocks: 10% of the 0x7E2 lane at most
+  {  50,  25,  50,   50, false,   0}, // Wheel speeds
+  {  50,  25,  50,   50, false,   0}, // Yaw rate
+  {  50,  25,  50,   50, false,   0}, // G sensors + steering angle
+  { 500, 250, 250, 2000, false,   0}  // Regen cooperation
 };
-unsigned long sensorNextDueMs[SENSOR_COUNT] = {0};
-uint8_t nextFastSensorIndex = 0;
-uint8_t nextSlowSensorIndex = 0;
-uint8_t fastPollsSinceSlow = 0;
 
-const bool POLL_DIAG = false;
-const unsigned long POLL_DIAG_GAP_MS = 100;
-unsigned long pollDiagLastEventMs = 0;
-unsigned long pollDiagLastRxMs = 0;
+// How often loop() traces the lanes still waiting on a reply.
+const unsigned long TRACE_WAITING_MS = 100;
+
+// loop() stages, in pass order, for the cycle profile ('p' on the console).
+// SERVICE is everything between steering and the scheduler: console, driver
+// and bus load service, subscriptions, trace sampling and the per-100 ms
+// freshness checks.
+enum : uint8_t {
+  STAGE_STEERING = 0,
+  STAGE_SERVICE,
+  STAGE_SCHEDULER,
+  STAGE_CAN_DRAIN,   // plus the kinematics consumer
+  STAGE_TIMEOUTS,
+  STAGE_FAN,
+  STAGE_UART,
+  STAGE_ESPNOW,
+  STAGE_COUNT
+};
+const char* const STAGE_NAMES[STAGE_COUNT] = {
+  "steering", "service", "scheduler", "can_drain", "timeouts", "fan", "uart", "espnow"
+};
+// A pass this long holds replies for about a quarter of the fast lane's 15 ms.
+const uint32_t LOOP_BUDGET_US = 4000;
+loop_profile::Profile loopProfile;
 
 const char* sensorName(uint8_t sensor) {
     switch (sensor) {
@@ -208,151 +219,590 @@ const char* sensorName(uint8_t sensor) {
         case SENSOR_HV_FAN_MODE: return "fan_mode";
         case SENSOR_MG1: return "mg1";
         case SENSOR_MG2: return "mg2";
+        case SENSOR_HV_BLOCKS: return "hv_blocks";
+        case SENSOR_WHEEL_SPEEDS: return "wheels";
+        case SENSOR_YAW: return "yaw";
+        case SENSOR_CHASSIS_G: return "chassis_g";
+        case SENSOR_REGEN_COOP: return "regen";
         default: return "unknown";
     }
 }
 
-void pollDiagMark(const char* tag, unsigned long now) {
-    if (!POLL_DIAG) return;
-    if (pollDiagLastEventMs != 0 && now - pollDiagLastEventMs >= POLL_DIAG_GAP_MS) {
-        Serial.printf("[POLL %lu] GAP tag=%s dt=%lu waiting=%u sensor=%s req_elapsed=%lu since_last_rx=%lu\n",
-                      now, tag, now - pollDiagLastEventMs, waiting ? 1 : 0,
-                      sensorName(currentPollSensor),
-                      waiting ? now - requestTimeout : 0,
-                      pollDiagLastRxMs ? now - pollDiagLastRxMs : 0);
+uint8_t lanesInFlight() {
+    uint8_t n = 0;
+    for (uint8_t e = 0; e < ECU_COUNT; e++) {
+        if (ecuLanes[e].waiting) n++;
     }
-    pollDiagLastEventMs = now;
+    return n;
 }
 
-void pollDiagFrame(const char* tag, unsigned long now, const CAN_FRAME& frame) {
-    if (!POLL_DIAG) return;
-    pollDiagMark(tag, now);
-    pollDiagLastRxMs = now;
-    Serial.printf("[POLL %lu] %s sensor=%s id=0x%03X len=%u data=",
-                  now, tag, sensorName(currentPollSensor), frame.id, frame.length);
-    for (uint8_t i = 0; i < frame.length; i++) {
-        Serial.printf("%02X", frame.data.byte[i]);
-        if (i + 1 < frame.length) Serial.print(' ');
-    }
-    Serial.println();
+// Reply frames go in the trace as their PCI type nibble and 11-bit ID.
+inline uint16_t traceFrameArg(const CanDriverFrame& frame) {
+    return (uint16_t)((frame.data[0] & 0xF0) << 8 | (frame.id & 0x7FF));
 }
 
-// g_sensors indexes
-enum {
-  IDX_RPM = 0,
-  IDX_HV_CURRENT = 1,
-  IDX_HV_VOLTAGE = 2,
-  IDX_ECT = 3,
-  IDX_HV_INTAKE_C = 4,
-  IDX_HV_TB1_C = 5,
-  IDX_HV_TB2_C = 6,
-  IDX_HV_TB3_C = 7,
-  IDX_BFS = 11,
-  IDX_DASH_BRIGHT = 12,
-  IDX_CAR_DIM = 13,
-  IDX_DISPLAY_OFF = 14,
-  IDX_MODE_EV = 15,
-  IDX_MODE_ECO = 16,
-  IDX_MODE_PWR = 17,
-  IDX_MG1_TEMP_F = 18,
-  IDX_MG1_RPM = 19,
-  IDX_MG2_TEMP_F = 20,
-  IDX_MG2_RPM = 21
+inline uint16_t traceMs(unsigned long ms) {
+    return ms > 0xFFFF ? 0xFFFF : (uint16_t)ms;
+}
+
+// Which catalog values each sensor's reply fills in. Adding a value from an
+// already-polled PID is one row here; keep rows grouped by sensor.
+// A change bigger than the deadband counts as "moving" for the rate control.
+// Values are stored as the catalog's raw integer, so the PID's scale has to
+// be the one the signal goes to the display in (checked below).
+struct SensorOutput {
+  uint8_t sensor;
+  uint16_t pid;      // pidCatalog entry
+  SignalId signal;
+  int32_t deadband;  // in raw steps
 };
 
-float pollSensorValueForDiag(uint8_t sensor) {
-    switch (sensor) {
-        case SENSOR_HV_CURRENT: return g_sensors[IDX_HV_CURRENT];
-        case SENSOR_HV_VOLTAGE: return g_sensors[IDX_HV_VOLTAGE];
-        case SENSOR_ECT: return g_sensors[IDX_ECT];
-        case SENSOR_HV_TEMPS: return g_sensors[IDX_HV_TB1_C];
-        case SENSOR_SOC: return g_sensors[8];
-        case SENSOR_HV_FAN_MODE: return g_sensors[IDX_BFS];
-        case SENSOR_MG1: return g_sensors[IDX_MG1_RPM];
-        case SENSOR_MG2: return g_sensors[IDX_MG2_RPM];
-        default: return 0.0f;
+// A block moving 10 mV (~8 steps) is a real change under load.
+constexpr int32_t HV_BLOCK_DEADBAND = dash_wire::HvBlock::deltaSteps<1000>(10);
+constexpr int32_t WHEEL_DEADBAND = pid_fixed::pid_7b0_2103_fr_ws::scale::deltaSteps(1);
+
+constexpr SensorOutput sensorOutputs[] = {
+  {SENSOR_HV_CURRENT,  PID_7E2_2198_BTY_CURR,    SIG_HV_CURRENT,  dash_wire::HvCurrent::deltaSteps(0)},
+  {SENSOR_HV_VOLTAGE,  PID_7E2_2174_VLB,         SIG_HV_VOLTAGE,  dash_wire::HvVoltage::deltaSteps(0)},
+  {SENSOR_ECT,         PID_7E2_0105_ECT,         SIG_ECT,         dash_wire::Coolant::deltaSteps(1)},
+  {SENSOR_HV_TEMPS,    PID_7E2_2187_TB_INTAKE_C, SIG_HV_INTAKE_C, dash_wire::HvTemp::deltaSteps<10>(5)},
+  {SENSOR_HV_TEMPS,    PID_7E2_2187_TB_1_C,      SIG_HV_TB1_C,    dash_wire::HvTemp::deltaSteps<10>(5)},
+  {SENSOR_HV_TEMPS,    PID_7E2_2187_TB_2_C,      SIG_HV_TB2_C,    dash_wire::HvTemp::deltaSteps<10>(5)},
+  {SENSOR_HV_TEMPS,    PID_7E2_2187_TB_3_C,      SIG_HV_TB3_C,    dash_wire::HvTemp::deltaSteps<10>(5)},
+  {SENSOR_SOC,         PID_7E2_015B_SOC,         SIG_SOC,         dash_wire::Soc::deltaSteps<10>(5)},
+  {SENSOR_HV_FAN_MODE, PID_7E2_219B_FAN_MODE,    SIG_HV_FAN_MODE, dash_wire::FanMode::deltaSteps<10>(5)},
+  {SENSOR_MG1,         PID_7E2_2161_MG1T,        SIG_MG1_TEMP_F,  dash_wire::MgTemp::deltaSteps(1)},
+  {SENSOR_MG1,         PID_7E2_2161_MG1_RPM,     SIG_MG1_RPM,     dash_wire::MgRpm::deltaSteps(100)},
+  {SENSOR_MG2,         PID_7E2_2162_MG2T,        SIG_MG2_TEMP_F,  dash_wire::MgTemp::deltaSteps(1)},
+  {SENSOR_MG2,         PID_7E2_2162_MG2_RPM,     SIG_MG2_RPM,     dash_wire::MgRpm::deltaSteps(100)},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V01,        SIG_HV_BLOCK_01, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V02,        SIG_HV_BLOCK_02, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V03,        SIG_HV_BLOCK_03, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V04,        SIG_HV_BLOCK_04, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V05,        SIG_HV_BLOCK_05, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V06,        SIG_HV_BLOCK_06, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V07,        SIG_HV_BLOCK_07, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V08,        SIG_HV_BLOCK_08, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V09,        SIG_HV_BLOCK_09, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V10,        SIG_HV_BLOCK_10, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V11,        SIG_HV_BLOCK_11, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V12,        SIG_HV_BLOCK_12, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V13,        SIG_HV_BLOCK_13, HV_BLOCK_DEADBAND},
+  {SENSOR_HV_BLOCKS,   PID_7E2_2181_V14,        SIG_HV_BLOCK_14, HV_BLOCK_DEADBAND},
+  {SENSOR_WHEEL_SPEEDS, PID_7B0_2103_FR_WS,      SIG_WHEEL_FR,    WHEEL_DEADBAND},
+  {SENSOR_WHEEL_SPEEDS, PID_7B0_2103_FL_WS,      SIG_WHEEL_FL,    WHEEL_DEADBAND},
+  {SENSOR_WHEEL_SPEEDS, PID_7B0_2103_RR_WS,      SIG_WHEEL_RR,    WHEEL_DEADBAND},
+  {SENSOR_WHEEL_SPEEDS, PID_7B0_2103_RL_WS,      SIG_WHEEL_RL,    WHEEL_DEADBAND},
+  {SENSOR_YAW,         PID_7B0_2106_YR1,         SIG_YAW_RATE,    0},
+  {SENSOR_CHASSIS_G,   PID_7B0_2147_LATERAL_G,   SIG_LATERAL_G,   0},
+  {SENSOR_CHASSIS_G,   PID_7B0_2147_FWD_RWD_G,   SIG_LONG_G,      0},
+  {SENSOR_CHASSIS_G,   PID_7B0_2147_STEERANGLE,  SIG_STEER_ANGLE, 0},
+  {SENSOR_REGEN_COOP,  PID_7B0_2158_REGENCOOP,   SIG_REGEN_COOP,  0}
+};
+const uint8_t SENSOR_OUTPUT_COUNT = sizeof(sensorOutputs) / sizeof(sensorOutputs[0]);
+
+static_assert(std::is_same<pid_fixed::pid_7e2_2198_bty_curr::scale, dash_wire::HvCurrent>::value, "HV current scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2174_vlb::scale, dash_wire::HvVoltage>::value, "HV voltage scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_0105_ect::scale, dash_wire::Coolant>::value, "coolant scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2187_tb_intake_c::scale, dash_wire::HvTemp>::value, "HV intake scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2187_tb_1_c::scale, dash_wire::HvTemp>::value, "HV TB1 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2187_tb_2_c::scale, dash_wire::HvTemp>::value, "HV TB2 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2187_tb_3_c::scale, dash_wire::HvTemp>::value, "HV TB3 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_015b_soc::scale, dash_wire::Soc>::value, "SoC scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_219b_fan_mode::scale, dash_wire::FanMode>::value, "fan mode scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2161_mg1t::scale, dash_wire::MgTemp>::value, "MG1 temp scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2161_mg1_rpm::scale, dash_wire::MgRpm>::value, "MG1 rpm scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2162_mg2t::scale, dash_wire::MgTemp>::value, "MG2 temp scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2162_mg2_rpm::scale, dash_wire::MgRpm>::value, "MG2 rpm scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v01::scale, dash_wire::HvBlock>::value, "HV block 1 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v02::scale, dash_wire::HvBlock>::value, "HV block 2 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v03::scale, dash_wire::HvBlock>::value, "HV block 3 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v04::scale, dash_wire::HvBlock>::value, "HV block 4 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v05::scale, dash_wire::HvBlock>::value, "HV block 5 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v06::scale, dash_wire::HvBlock>::value, "HV block 6 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v07::scale, dash_wire::HvBlock>::value, "HV block 7 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v08::scale, dash_wire::HvBlock>::value, "HV block 8 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v09::scale, dash_wire::HvBlock>::value, "HV block 9 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v10::scale, dash_wire::HvBlock>::value, "HV block 10 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v11::scale, dash_wire::HvBlock>::value, "HV block 11 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v12::scale, dash_wire::HvBlock>::value, "HV block 12 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v13::scale, dash_wire::HvBlock>::value, "HV block 13 scale");
+static_assert(std::is_same<pid_fixed::pid_7e2_2181_v14::scale, dash_wire::HvBlock>::value, "HV block 14 scale");
+
+constexpr bool allOutputsFixed(uint8_t i = 0) {
+  return i >= SENSOR_OUTPUT_COUNT || (pidCatalog[sensorOutputs[i].pid].decodeRaw != nullptr && allOutputsFixed(i + 1));
+}
+static_assert(allOutputsFixed(), "every sensorOutputs PID needs a linear (decodeRaw) equation");
+
+// sensorOutputs is grouped by sensor; where each group starts.
+struct SensorOutputIndex {
+  uint8_t first[SENSOR_COUNT + 1];
+};
+constexpr SensorOutputIndex indexSensorOutputs() {
+  SensorOutputIndex x = {};
+  for (uint8_t sensor = 0, i = 0; sensor <= SENSOR_COUNT; sensor++) {
+    while (i < SENSOR_OUTPUT_COUNT && sensorOutputs[i].sensor < sensor) i++;
+    x.first[sensor] = i;
+  }
+  return x;
+}
+constexpr SensorOutputIndex sensorOutputIndex = indexSensorOutputs();
+constexpr const uint8_t* sensorOutputFirst = sensorOutputIndex.first;
+
+constexpr bool outputsGrouped(uint8_t i = 1) {
+  return i >= SENSOR_OUTPUT_COUNT || (sensorOutputs[i - 1].sensor <= sensorOutputs[i].sensor && outputsGrouped(i + 1));
+}
+static_assert(outputsGrouped(), "sensorOutputs must be grouped by sensor, in SENSOR_* order");
+
+// Flag what a sensor's reply fills in; a timeout only downgrades values that
+// were good, so "never written" stays distinguishable.
+void markSensorOutputs(uint8_t sensor, SignalQuality quality) {
+    for (uint8_t i = sensorOutputFirst[sensor]; i < sensorOutputFirst[sensor + 1]; i++) {
+        const SignalId id = sensorOutputs[i].signal;
+        if (quality == SIGNAL_HELD && signalRead(id).quality != SIGNAL_GOOD) continue;
+        signalSetQuality(id, quality);
     }
 }
 
-inline void completeCurrentSensor(unsigned long now) {
-    if (currentPollSensor != SENSOR_NONE && currentPollSensor < SENSOR_COUNT) {
-        pollDiagMark("DONE", now);
-        if (POLL_DIAG) {
-            Serial.printf("[POLL %lu] DONE sensor=%s elapsed=%lu value=%.2f\n",
-                          now, sensorName(currentPollSensor), now - requestTimeout,
-                          (double)pollSensorValueForDiag(currentPollSensor));
-        }
-        if (sensorIntervalMs[currentPollSensor] > 0) {
-            sensorNextDueMs[currentPollSensor] = now + sensorIntervalMs[currentPollSensor];
-            if (POLL_DIAG) {
-                Serial.printf("[POLL %lu] NEXT_SLOW sensor=%s due_in=%lu\n",
-                              now, sensorName(currentPollSensor), sensorIntervalMs[currentPollSensor]);
-            }
-        }
+bool isBatchable(uint8_t sensor) {
+    const PidRequest& r = pidRequests[sensorRequests[sensor]];
+    return r.service == OBD_MODE01 && obdMode01DataLength(r.pid) != 0;
+}
+
+// Start the lane's batch with the scheduler's pick. If that is a Mode 01 PID,
+// every other released Mode 01 sensor on the same ECU rides along.
+void buildLaneBatch(uint8_t ecu, uint8_t first, unsigned long now) {
+    EcuLane& lane = ecuLanes[ecu];
+    lane.sensor = first;
+    lane.batch[0] = first;
+    lane.batchCount = 1;
+    if (!isBatchable(first)) return;
+
+    for (uint8_t sensor = 0; sensor < SENSOR_COUNT; sensor++) {
+        if (lane.batchCount >= OBD_MAX_PIDS_PER_REQUEST) break;
+        if (sensor == first || sensorEcu[sensor] != ecu || !isBatchable(sensor)) continue;
+        if (!pollSchedReleased(sensor, now)) continue;
+        lane.batch[lane.batchCount++] = sensor;
     }
-    currentPollSensor = SENSOR_NONE;
-    waiting = false;
 }
 
-inline void timeoutCurrentSensor(unsigned long now) {
-    if (currentPollSensor != SENSOR_NONE && currentPollSensor < SENSOR_COUNT) {
-        pollDiagMark("TIMEOUT", now);
-        if (POLL_DIAG) {
-            Serial.printf("[POLL %lu] TIMEOUT sensor=%s elapsed=%lu limit=%lu since_last_rx=%lu\n",
-                          now, sensorName(currentPollSensor), now - requestTimeout,
-                          sensorTimeoutMs[currentPollSensor],
-                          pollDiagLastRxMs ? now - pollDiagLastRxMs : 0);
+void sendLaneRequest(EcuLane& lane, unsigned long now) {
+    uint8_t req[1 + OBD_MAX_PIDS_PER_REQUEST];
+    req[0] = pidRequests[sensorRequests[lane.sensor]].service;
+    for (uint8_t i = 0; i < lane.batchCount; i++) {
+        req[1 + i] = pidRequests[sensorRequests[lane.batch[i]]].pid;
+    }
+    // Arm before sending: the FC for a multi-frame reply goes out from the
+    // RX callback as soon as the FF lands.
+    fcArm(lane.isotp.rxId, lane.isotp.txId, req[0], lane.isotp.fcBlockSize, lane.isotp.fcStMin);
+    isoTpSend(lane.isotp, req, 1 + lane.batchCount, now);
+}
+
+// A batched request is answered in one reply, so it waits as long as the
+// slowest of its sensors' learned timeouts, not just batch[0]'s.
+uint16_t laneTimeoutMs(const EcuLane& lane) {
+    uint16_t limit = 0;
+    for (uint8_t i = 0; i < lane.batchCount; i++) {
+        const uint16_t t = pollSchedTimeoutMs(lane.batch[i]);
+        if (t > limit) limit = t;
+    }
+    return limit;
+}
+
+inline void releaseLane(EcuLane& lane) {
+    lane.sensor = SENSOR_NONE;
+    lane.batchCount = 0;
+    lane.discovering = false;
+    lane.waiting = false;
+    fcDisarm(lane.isotp.rxId);
+    isoTpReset(lane.isotp);
+}
+
+// Close out the lane's request. Bit i of doneMask is set when batch[i] got
+// its value; the rest count as timeouts.
+void finishLane(uint8_t ecu, uint8_t doneMask, unsigned long now) {
+    EcuLane& lane = ecuLanes[ecu];
+    for (uint8_t i = 0; i < lane.batchCount; i++) {
+        const uint8_t sensor = lane.batch[i];
+        if (doneMask & (1u << i)) {
+            pollSchedCompleted(sensor, now);
+            traceEvent(TRACE_DONE, sensor, traceMs(now - lane.requestMs));
+        } else {
+            traceEvent(TRACE_TIMEOUT, sensor, traceMs(now - lane.requestMs));
+            // The sensor is released again one period after its last dispatch,
+            // so a timeout costs one sample, not a whole slow cycle.
+            pollSchedTimedOut(sensor, now);
+            markSensorOutputs(sensor, SIGNAL_HELD);
         }
-        // On timeout, slow sensors wait for their next slow slot. Fast sensors
-        // stay eligible so current/voltage recover immediately.
-        if (sensorIntervalMs[currentPollSensor] > 0) {
-            sensorNextDueMs[currentPollSensor] = now + sensorIntervalMs[currentPollSensor];
-            if (POLL_DIAG) {
-                Serial.printf("[POLL %lu] NEXT_SLOW_AFTER_TIMEOUT sensor=%s due_in=%lu\n",
-                              now, sensorName(currentPollSensor), sensorIntervalMs[currentPollSensor]);
-            }
+    }
+    releaseLane(lane);
+}
+
+inline void completeLane(uint8_t ecu, unsigned long now) {
+    finishLane(ecu, 0xFF, now);
+}
+
+inline void timeoutLane(uint8_t ecu, unsigned long now) {
+    if (ecuLanes[ecu].discovering) discoveryOnTimeout(ecu);
+    finishLane(ecu, 0, now);
+}
+
+void sendDiscoveryProbe(uint8_t ecu, uint8_t service, uint8_t pid, unsigned long now) {
+    EcuLane& lane = ecuLanes[ecu];
+    lane.discovering = true;
+    lane.probeService = service;
+    lane.probePid = pid;
+    lane.waiting = true;
+    lane.requestMs = now;
+    const uint8_t req[] = {service, pid};
+    fcArm(lane.isotp.rxId, lane.isotp.txId, service, lane.isotp.fcBlockSize, lane.isotp.fcStMin);
+    isoTpSend(lane.isotp, req, sizeof(req), now);
+}
+
+// Discovery is final for this ECU: drop the sensors it doesn't answer.
+void applyCapabilities(uint8_t ecu, unsigned long now) {
+    for (uint8_t sensor = 0; sensor < SENSOR_COUNT; sensor++) {
+        if (sensorEcu[sensor] != ecu) continue;
+        const PidRequest& r = pidRequests[sensorRequests[sensor]];
+        const bool ok = discoverySupports(ecu, r.service, r.pid);
+        pollSchedSetSupported(sensor, ok, now);
+        if (!ok) {
+            Serial.printf("[DISC] %s not supported, not polling\n", sensorName(sensor));
+            markSensorOutputs(sensor, SIGNAL_UNSUPPORTED);
         }
     }
-    currentPollSensor = SENSOR_NONE;
-    waiting = false;
+    ecuLanes[ecu].capsApplied = true;
 }
 
-int8_t pickNextDueSensor(unsigned long now) {
-    const uint8_t slowCount = sizeof(slowSensors) / sizeof(slowSensors[0]);
-    if (fastPollsSinceSlow >= FAST_POLLS_BETWEEN_SLOW_POLLS) {
-        pollDiagMark("SLOW_SLOT", now);
-        if (POLL_DIAG) {
-            Serial.printf("[POLL %lu] SLOW_SLOT fast_polls=%u\n", now, fastPollsSinceSlow);
+// Poll each sensor at the fastest rate any live consumer asked for; sensors
+// with no subscriber drop out of the schedule.
+void applySubscriptionDemand(unsigned long now) {
+    for (uint8_t sensor = 0; sensor < SENSOR_COUNT; sensor++) {
+        pollSchedSetDemand(sensor, subsPeriodMs(sensor), now);
+    }
+}
+
+// Diag response IDs only need to get through the CAN filter while discovery
+// is running or one of the ECU's sensors has a subscriber. Discovery keeps
+// them all until every ECU is done, so the filter is swapped once, not per ECU.
+void updateDiagWatch() {
+    bool discovering = false;
+    for (uint8_t e = 0; e < ECU_COUNT; e++) discovering |= !ecuLanes[e].capsApplied;
+
+    for (uint8_t e = 0; e < ECU_COUNT; e++) {
+        bool needed = discovering;
+        for (uint8_t sensor = 0; sensor < SENSOR_COUNT && !needed; sensor++) {
+            needed = sensorEcu[sensor] == e && subsPeriodMs(sensor) > 0;
         }
-        for (uint8_t i = 0; i < slowCount; i++) {
-            uint8_t idx = (nextSlowSensorIndex + i) % slowCount;
-            uint8_t sensor = slowSensors[idx];
-            if (now >= sensorNextDueMs[sensor]) {
-                nextSlowSensorIndex = (idx + 1) % slowCount;
-                fastPollsSinceSlow = 0;
-                if (POLL_DIAG) {
-                    Serial.printf("[POLL %lu] PICK_SLOW sensor=%s overdue=%lu\n",
-                                  now, sensorName(sensor), now - sensorNextDueMs[sensor]);
-                }
-                return sensor;
-            }
+        if (needed) canRxWatch(diagEcus[e].responseId);
+        else canRxUnwatch(diagEcus[e].responseId);
+    }
+    canRxApplyFilters();
+}
+
+// The adapter's own needs: fan override watches the HV battery temps, and
+// the store keeps vehicle dynamics from the skid control ECU.
+void subscribeLocalConsumers(unsigned long now) {
+    SubscribeMsg local = {};
+    local.consumer = SUB_CONSUMER_LOCAL;
+    local.count = 5;
+    local.entries[0] = {SUB_SIG_HV_TEMPS, 1000};
+    local.entries[1] = {SUB_SIG_WHEEL_SPEEDS, 50};
+    local.entries[2] = {SUB_SIG_YAW, 50};
+    local.entries[3] = {SUB_SIG_CHASSIS_G, 50};
+    local.entries[4] = {SUB_SIG_REGEN_COOP, 500};
+    subsUpdate(local, now, true);
+}
+
+void onEspNowRecv(const uint8_t* mac, const uint8_t* data, int len) {
+    if (memcmp(mac, PEER_MAC, 6) != 0) return;
+    subsOnEspNow(data, len);
+}
+
+void printPollSchedStats() {
+    Serial.printf("bus scale %u/1000\n", pollSchedBusScale());
+    Serial.println("sensor      disp    done    tmo  miss starve behind defer p50 p95 tmo_ms period    hz demand");
+    for (uint8_t sensor = 0; sensor < SENSOR_COUNT; sensor++) {
+        const PollSchedStats& st = pollSchedStats(sensor);
+        Serial.printf("%-10s %6lu %6lu %6lu %5lu %6lu %6lu %5lu %3u %3u %6u %6u %5.2f %6u\n",
+                      sensorName(sensor),
+                      (unsigned long)st.dispatched, (unsigned long)st.completed,
+                      (unsigned long)st.timeouts, (unsigned long)st.deadlineMisses,
+                      (unsigned long)st.starvations, (unsigned long)st.behindPicks,
+                      (unsigned long)st.shareDeferrals,
+                      st.rttP50Ms, st.rttP95Ms, st.timeoutMs,
+                      st.periodMs, st.effectiveCentiHz / 100.0, st.demandMs);
+    }
+    Serial.printf("stray diag frames: %lu\n", (unsigned long)diagStrayFrames);
+}
+
+// Single-key commands on the debug serial port.
+void pollDebugConsole() {
+    while (Serial.available()) {
+        switch (Serial.read()) {
+            case 's': printPollSchedStats(); break;
+            case 'c': subsPrint(millis()); break;
+            case 'd': discoveryPrint(); break;
+            case 'f': fcPrintStats(); break;
+            case 'r': canRxPrintStats(); break;
+            case 't': canTxPrintStats(); break;
+            case 'b': canDriverPrintStats(); break;
+            case 'm': canDispatchBenchmark(); break;
+            case 'v': signalStorePrint(millis()); break;
+            case 'k': kinPrintStats(); break;
+            case 'u': busLoadPrint(); break;
+            case 'i': canIdStatsPrint(micros()); break;
+            case 'x':
+                traceSetStreaming(!traceStreaming());
+                tracePrintStats();
+                break;
+            case 'p': loop_profile::print(loopProfile, Serial); break;
+            default: break;
         }
-        fastPollsSinceSlow = 0;
-        if (POLL_DIAG) {
-            Serial.printf("[POLL %lu] SLOW_NONE_DUE\n", now);
+    }
+}
+
+uint8_t ecuForRequestId(uint32_t id) {
+    for (uint8_t e = 0; e < ECU_COUNT; e++) {
+        if (diagEcus[e].requestId == id) return e;
+    }
+    return ECU_NONE;
+}
+
+// A batched Mode 01 reply may lead with any of the requested PIDs.
+bool laneRequestedPid(const EcuLane& lane, uint8_t pid) {
+    for (uint8_t i = 0; i < lane.batchCount; i++) {
+        if (pidRequests[sensorRequests[lane.batch[i]]].pid == pid) return true;
+    }
+    return false;
+}
+
+// Does this frame belong to the lane's in-flight request? SF/FF must echo the
+// service + PID (or be a 7F negative response to the service). CFs carry no
+// echo, so the ISO-TP link decides whether it is expecting one.
+bool frameMatchesLane(const EcuLane& lane, const CanDriverFrame& frame) {
+    if (!lane.waiting) return false;
+    if (!lane.discovering && lane.sensor >= SENSOR_COUNT) return false;
+    const uint8_t service = lane.discovering ? lane.probeService
+                                             : pidRequests[sensorRequests[lane.sensor]].service;
+    const uint8_t* b = frame.data;
+    const uint8_t positive = service | 0x40;
+
+    switch (b[0] & 0xF0) {
+        case 0x00: // SF: [len][svc+40][pid]... or [len][7F][svc][nrc]
+            if (frame.length < 3) return false;
+            if (b[1] == 0x7F) return frame.length >= 4 && b[2] == service;
+            if (lane.discovering) return b[1] == positive && b[2] == lane.probePid;
+            return b[1] == positive && laneRequestedPid(lane, b[2]);
+        case 0x10: // FF: [1L][LL][svc+40][pid]...
+            if (frame.length < 4 || b[2] != positive) return false;
+            return lane.discovering ? b[3] == lane.probePid : laneRequestedPid(lane, b[3]);
+        case 0x20: // CF
+        case 0x30: // FC for a multi-frame request of ours
+            return true;
+        default:
+            return false;
+    }
+}
+
+static_assert(SIG_HV_BLOCK_14 == SIG_HV_BLOCK_01 + dash_wire::HV_BLOCK_COUNT - 1, "block signals are contiguous");
+
+// Lowest and highest block from the reply just stored, and the spread
+// between them: a weak block shows up as the spread growing under load.
+void updateBlockSpread(uint16_t periodMs, unsigned long now) {
+    int32_t lo = INT32_MAX, hi = 0;
+    for (uint8_t b = 0; b < dash_wire::HV_BLOCK_COUNT; b++) {
+        const int32_t v = signalInt((SignalId)(SIG_HV_BLOCK_01 + b));
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+    signalSetInt(SIG_HV_BLOCK_MIN, lo, now);
+    signalSetInt(SIG_HV_BLOCK_MAX, hi, now);
+    signalSetInt(SIG_HV_BLOCK_SPREAD, hi - lo, now);
+    signalSetExpectedMs(SIG_HV_BLOCK_MIN, periodMs);
+    signalSetExpectedMs(SIG_HV_BLOCK_MAX, periodMs);
+    signalSetExpectedMs(SIG_HV_BLOCK_SPREAD, periodMs);
+}
+
+// Store sensorOutputs[I..END) from one reply. Unrolled at compile time so
+// each PID's raw() inlines instead of going through pidCatalog[].decodeRaw.
+// Returns whether any of them moved by more than its deadband.
+template <uint8_t I, uint8_t END>
+inline bool storeSensorOutputs(const uint8_t* p, unsigned long now) {
+    if constexpr (I >= END) {
+        return false;
+    } else {
+        constexpr SensorOutput out = sensorOutputs[I];
+        const int32_t raw = PidFixed<out.pid>::raw(p);
+        const int32_t delta = raw - signalInt(out.signal);
+        signalSetInt(out.signal, raw, now);
+        traceEvent(TRACE_VALUE, out.signal, (uint16_t)raw);
+        const bool moving = delta > out.deadband || -delta > out.deadband;
+        return storeSensorOutputs<I + 1, END>(p, now) || moving;
+    }
+}
+
+template <uint8_t SENSOR>
+bool storeSensor(const uint8_t* p, unsigned long now) {
+    return storeSensorOutputs<sensorOutputFirst[SENSOR], sensorOutputFirst[SENSOR + 1]>(p, now);
+}
+
+using SensorStoreFn = bool (*)(const uint8_t* p, unsigned long now);
+template <size_t... S>
+constexpr SensorStoreFn sensorStores[] = {storeSensor<S>...};
+template <size_t... S>
+constexpr const SensorStoreFn* sensorStoreTable(std::index_sequence<S...>) { return sensorStores<S...>; }
+constexpr const SensorStoreFn* SENSOR_STORE = sensorStoreTable(std::make_index_sequence<SENSOR_COUNT>());
+
+// Decode a complete reply payload for a sensor. p[0] is the positive-response
+// service (0x41 / 0x61), p[1] the PID, and Torque's A, B, C... start at p[2].
+// Returns false if the payload is too short for the sensor's request.
+bool decodeSensorPayload(uint8_t sensor, const uint8_t* p, uint16_t len, unsigned long now) {
+    if (len < pidRequests[sensorRequests[sensor]].minLen) return false;
+
+    const bool moving = SENSOR_STORE[sensor](p, now);
+    pollSchedSignalChanged(sensor, moving);
+    // Freshness is judged against the period the scheduler just settled on.
+    const uint16_t periodMs = pollSchedStats(sensor).periodMs;
+    for (uint8_t i = sensorOutputFirst[sensor]; i < sensorOutputFirst[sensor + 1]; i++) {
+        signalSetExpectedMs(sensorOutputs[i].signal, periodMs);
+    }
+    if (sensor == SENSOR_HV_BLOCKS) updateBlockSpread(periodMs, now);
+    return true;
+}
+
+// Tell the scheduler which sensors the display would be showing as late or
+// stale, so their next polls go ahead of sensors that are merely due.
+void updateSensorsBehind(unsigned long now) {
+    for (uint8_t sensor = 0; sensor < SENSOR_COUNT; sensor++) {
+        bool behind = false;
+        for (uint8_t i = sensorOutputFirst[sensor]; i < sensorOutputFirst[sensor + 1]; i++) {
+            const SignalFreshness f = signalFreshness(signalRead(sensorOutputs[i].signal), now);
+            if (f == SIGNAL_LATE || f == SIGNAL_STALE) behind = true;
         }
+        pollSchedSetBehind(sensor, behind);
+    }
+}
+
+// The store's view of the broadcast kinematics: speed and longitudinal
+// accel at 100 ms through the ring's decimator, peaks as the writer saw them.
+void updateKinematicsSignals(unsigned long now) {
+    static KinDecimator dec;
+    static bool started = false;
+    if (!started) {
+        kinDecimatorInit(dec, 100, now);
+        started = true;
     }
+    KinOutput out;
+    if (!kinDecimatorService(dec, now, out)) return;
+    // The filters hold their last value through a gap; let the store age it instead.
+    if (!canIdStatsSilent(dbc::speed::ID, micros())) {
+        if (out.valid & (1u << KIN_SPEED)) signalSetInt(SIG_BUS_SPEED, out.raw[KIN_SPEED], now);
+        if (out.valid & (1u << KIN_LONG_ACCEL)) signalSetInt(SIG_BUS_LONG_ACCEL, out.raw[KIN_LONG_ACCEL], now);
+    }
+
+    static KinPeaks lastPeaks = {};
+    const KinPeaks p = kinStats().peaks;
+    if (p.yawRate != lastPeaks.yawRate) signalSetInt(SIG_PEAK_YAW, p.yawRate, now);
+    if (p.accelY != lastPeaks.accelY) signalSetInt(SIG_PEAK_ACCEL_Y, p.accelY, now);
+    if (p.longAccel != lastPeaks.longAccel) signalSetInt(SIG_PEAK_LONG_ACCEL, p.longAccel, now);
+    lastPeaks = p;
+}
+
+// Loop timing as telemetry, once a second: the worst period in that second
+// and the since-boot p99 and overrun count.
+void updateLoopProfileSignals(unsigned long now) {
+    static unsigned long lastMs = 0;
+    if (now - lastMs < 1000) return;
+    lastMs = now;
+    using namespace loop_profile;
+    signalSetInt(SIG_LOOP_MAX_US, (int32_t)toUs(loopProfile, takeWindowMax(loopProfile.loop)), now);
+    signalSetInt(SIG_LOOP_P99_US, (int32_t)toUs(loopProfile, percentileCycles(loopProfile.loop, 990)), now);
+    signalSetInt(SIG_LOOP_OVERRUNS, (int32_t)loopProfile.loop.overruns, now);
+}
+
+// Bus utilisation as telemetry, once per bus_load bucket, and the scale it
+// settled on handed to the scheduler.
+void updateBusLoad(unsigned long now) {
+    if (!busLoadService(micros())) return;
+    const BusLoadStats s = busLoadStats();
+    pollSchedSetBusScale(s.txScale);
+    signalSetInt(SIG_BUS_LOAD, s.loadPerMille, now);
+    signalSetInt(SIG_BUS_PEAK, s.peakPerMille, now);
+    signalSetInt(SIG_BUS_OURS, s.ourPerMille, now);
+    signalSetInt(SIG_BUS_TX_SCALE, s.txScale, now);
+}
 
-    const uint8_t fastCount = sizeof(fastSensors) / sizeof(fastSensors[0]);
-    uint8_t sensor = fastSensors[nextFastSensorIndex];
-    nextFastSensorIndex = (nextFastSensorIndex + 1) % fastCount;
-    if (fastPollsSinceSlow < 255) fastPollsSinceSlow++;
-    pollDiagMark("PICK_FAST", now);
-    if (POLL_DIAG) {
-        Serial.printf("[POLL %lu] PICK_FAST sensor=%s fast_polls=%u\n",
-                      now, sensorName(sensor), fastPollsSinceSlow);
+struct BatchDemux {
+  const EcuLane* lane;
+  uint8_t doneMask;
+  unsigned long now;
+};
+
+// Re-frame one PID's slice of a batched reply as a single-PID payload so the
+// catalog decoders see A at p[2] as usual.
+void demuxMode01Pid(uint8_t pid, const uint8_t* data, uint8_t dataLen, void* ctx) {
+    BatchDemux& d = *static_cast<BatchDemux*>(ctx);
+    uint8_t single[2 + 5] = {(uint8_t)(OBD_MODE01 | 0x40), pid};
+    memcpy(&single[2], data, dataLen);
+
+    for (uint8_t i = 0; i < d.lane->batchCount; i++) {
+        const uint8_t sensor = d.lane->batch[i];
+        if (pidRequests[sensorRequests[sensor]].pid != pid) continue;
+        if (decodeSensorPayload(sensor, single, 2 + dataLen, d.now)) d.doneMask |= 1u << i;
+    }
+}
+
+// Polled sensor responses from any diagnostic ECU.
+void handleDiagResponse(uint8_t ecu, const CanDriverFrame& frame, unsigned long now) {
+    EcuLane& lane = ecuLanes[ecu];
+    if (!frameMatchesLane(lane, frame)) {
+        diagStrayFrames++;
+        traceEvent(TRACE_STRAY_RX, lane.sensor, traceFrameArg(frame));
+        return;
+    }
+
+    // FC for a first frame already went out from the RX callback
+    // (isotp_fc); the link only reassembles here.
+    const IsoTpRxResult rx = isoTpOnFrame(lane.isotp, frame, now);
+    traceEvent(TRACE_RX, lane.sensor, traceFrameArg(frame));
+
+    if (rx == ISOTP_RX_ERROR) {
+        timeoutLane(ecu, now);
+        return;
+    }
+    if (rx != ISOTP_RX_COMPLETE) return;
+
+    const uint8_t* p = lane.isotp.rxBuf;
+    const uint16_t len = lane.isotp.rxLen;
+
+    // 7F <svc> <nrc>: 0x78 means "response pending", keep waiting for the real one.
+    if (len >= 3 && p[0] == 0x7F && p[2] == 0x78) return;
+
+    if (lane.discovering) {
+        discoveryOnReply(ecu, p, len); // negative replies count as "not supported"
+        releaseLane(lane);
+        return;
+    }
+
+    if (p[0] == 0x7F) {
+        timeoutLane(ecu, now);
+        return;
+    }
+
+    if (lane.batchCount > 1) {
+        // PIDs the ECU left out (or anything after a malformed entry) time out.
+        BatchDemux demux = {&lane, 0, now};
+        obdMode01Split(p, len, demuxMode01Pid, &demux);
+        finishLane(ecu, demux.doneMask, now);
+        return;
+    }
+
+    if (decodeSensorPayload(lane.sensor, p, len, now)) {
+        completeLane(ecu, now);
+    } else {
+        timeoutLane(ecu, now);
     }
-    return sensor;
 }
 
 static inline uint8_t xor_checksum(const uint8_t* p, size_t n) {
@@ -361,91 +811,259 @@ static inline uint8_t xor_checksum(const uint8_t* p, size_t n) {
   return x;
 }
 
-#pragma pack(push,1)
-// All primary values as IEEE-754 float (little-endian on ESP32)
-struct PayloadF {
-  uint8_t seq;          // increments each packet
-  float   rpm;          // from g_sensors[IDX_RPM]
-  float   hv_current_A; // can be negative
-  float   hv_voltage_V;
-  float   ect_C;
-  float   hv_intake_C;
-  float   tb1_C;
-  float   tb2_C;
-  float   tb3_C;
-  float   soc_pct;
-  float   mg1_temp_F;
-  float   mg1_rpm;
-  float   mg2_temp_F;
-  float   mg2_rpm;
-  int8_t  ebar;         // already small int
-  uint8_t est;          // state_energy_drain
-  uint8_t bfs;          // battery fan speed
-  uint8_t bfor;         // battery fan override
-  uint8_t dim;          // car dim signal
-  uint8_t off;          // display off flag
-};
-#pragma pack(pop)
-
 static uint8_t tx_seq = 0;
+static uint8_t tx_blocks_seq = 0;
 
 void initDisplayUart() {
   DISP.begin(UART_BAUD, SERIAL_8N1, UART2_RX_PIN, UART2_TX_PIN);
 }
 
-static inline void wr_f32(uint8_t *dst, float v) { memcpy(dst, &v, 4); }
-
-void sendSensorsFloat() {
-    const uint8_t n = sizeof(PayloadF);   // payload length (bytes)
-    const int need = 1 + 1 + n + 1;       // [0xAA][len][payload][csum]
-    if (DISP.availableForWrite() < need) return;
+// Where each dash_wire::Field's freshness comes from.
+constexpr SignalId WIRE_FRESHNESS[dash_wire::FIELD_COUNT] = {
+  SIG_ENGINE_RPM, SIG_HV_CURRENT, SIG_HV_VOLTAGE, SIG_ECT, SIG_HV_INTAKE_C, SIG_HV_TB1_C, SIG_HV_TB2_C,
+  SIG_HV_TB3_C, SIG_SOC, SIG_MG1_TEMP_F, SIG_MG1_RPM, SIG_MG2_TEMP_F, SIG_MG2_RPM, SIG_EBAR, SIG_HV_FAN_MODE
+};
+static_assert(dash_wire::FRESH == (int)SIGNAL_FRESH && dash_wire::LATE == (int)SIGNAL_LATE &&
+              dash_wire::STALE == (int)SIGNAL_STALE && dash_wire::NO_DATA == (int)SIGNAL_NO_DATA,
+              "dash_wire::Freshness mirrors SignalFreshness");
 
-    uint8_t buf[1 + 1 + sizeof(PayloadF) + 1];
+// [start][len][payload][csum], XOR over the payload only.
+void writeDisplayFrame(uint8_t start, const void* payload, uint8_t n) {
+    uint8_t buf[1 + 1 + 255 + 1];
     size_t o = 0;
-
-    buf[o++] = 0xAA;
+    buf[o++] = start;
     buf[o++] = n;
+    memcpy(&buf[o], payload, n);  o += n;
+    buf[o++] = xor_checksum(&buf[2], n);
+    DISP.write(buf, o);
+}
 
-    buf[o++] = tx_seq++;
+// Frame layout and scales are in dash_wire.h; the store already holds each
+// value in its wire integer, so packing is copies.
+void sendSensors(unsigned long now) {
+    const uint8_t n = sizeof(dash_wire::PayloadI);  // payload length (bytes)
+    if (DISP.availableForWrite() < 1 + 1 + n + 1) return;
+
+    // One consistent copy of the store, so the frame never mixes two updates.
+    SignalSnapshot snap;
+    signalStoreSnapshot(snap);
+
+    dash_wire::PayloadI pl;
+    pl.seq        = tx_seq++;
+    pl.rpm        = (uint16_t)snap.s[SIG_ENGINE_RPM].asInt();
+    pl.hv_current = (int16_t)snap.s[SIG_HV_CURRENT].asInt();
+    pl.hv_voltage = (uint16_t)snap.s[SIG_HV_VOLTAGE].asInt();
+    pl.ect        = (int16_t)snap.s[SIG_ECT].asInt();
+    pl.hv_intake  = (uint16_t)snap.s[SIG_HV_INTAKE_C].asInt();
+    pl.tb1        = (uint16_t)snap.s[SIG_HV_TB1_C].asInt();
+    pl.tb2        = (uint16_t)snap.s[SIG_HV_TB2_C].asInt();
+    pl.tb3        = (uint16_t)snap.s[SIG_HV_TB3_C].asInt();
+    pl.soc        = (uint8_t)snap.s[SIG_SOC].asInt();
+    pl.mg1_temp   = (uint8_t)snap.s[SIG_MG1_TEMP_F].asInt();
+    pl.mg1_rpm    = (int16_t)snap.s[SIG_MG1_RPM].asInt();
+    pl.mg2_temp   = (uint8_t)snap.s[SIG_MG2_TEMP_F].asInt();
+    pl.mg2_rpm    = (int16_t)snap.s[SIG_MG2_RPM].asInt();
+    pl.ebar       = (int8_t)snap.s[SIG_EBAR].asInt();
+    pl.est        = (uint8_t)snap.s[SIG_ENERGY_STATE].asInt();
+    pl.bfs        = (uint8_t)constrain(snap.s[SIG_HV_FAN_MODE].asInt(), 0, 6);  // fan speed 0..6
+    pl.bfor       = fanOverrideEnable ? 1 : 0;
+    pl.dim        = snap.s[SIG_CAR_DIM].asBool() ? 1 : 0;
+    pl.off        = snap.s[SIG_DISPLAY_OFF].asBool() ? 1 : 0;
+    pl.freshness  = 0;
+    for (uint8_t f = 0; f < dash_wire::FIELD_COUNT; f++) {
+        pl.freshness |= (uint32_t)signalFreshness(snap.s[WIRE_FRESHNESS[f]], now) << (2 * f);
+    }
+    writeDisplayFrame(dash_wire::START_SENSORS, &pl, n);
+}
 
-    wr_f32(&buf[o], g_sensors[IDX_RPM]);         o += 4;
-    wr_f32(&buf[o], g_sensors[IDX_HV_CURRENT]);  o += 4;
-    wr_f32(&buf[o], g_sensors[IDX_HV_VOLTAGE]);  o += 4;
-    wr_f32(&buf[o], g_sensors[IDX_ECT]);         o += 4;
-    wr_f32(&buf[o], g_sensors[IDX_HV_INTAKE_C]); o += 4;
-    wr_f32(&buf[o], g_sensors[IDX_HV_TB1_C]);    o += 4;
-    wr_f32(&buf[o], g_sensors[IDX_HV_TB2_C]);    o += 4;
-    wr_f32(&buf[o], g_sensors[IDX_HV_TB3_C]);    o += 4;
-    wr_f32(&buf[o], g_sensors[8]);               o += 4;  // soc_pct
-    wr_f32(&buf[o], g_sensors[IDX_MG1_TEMP_F]);  o += 4;
-    wr_f32(&buf[o], g_sensors[IDX_MG1_RPM]);     o += 4;
-    wr_f32(&buf[o], g_sensors[IDX_MG2_TEMP_F]);  o += 4;
-    wr_f32(&buf[o], g_sensors[IDX_MG2_RPM]);     o += 4;
+// Block voltages go in their own frame when a new reply has been stored, and
+// once a second regardless so a display that just booted (or a reply that
+// stopped coming) catches up. loop() is the store's only writer, so reading
+// the blocks one by one here can't straddle a reply.
+void sendBlocks(unsigned long now) {
+    static uint32_t lastSamples = 0;
+    static unsigned long lastSendMs = 0;
+    const uint32_t samples = signalRead(SIG_HV_BLOCK_SPREAD).samples;
+    if (samples == lastSamples && now - lastSendMs < 1000) return;
+
+    const uint8_t n = sizeof(dash_wire::BlocksPayload);
+    if (DISP.availableForWrite() < 1 + 1 + n + 1) return;
+
+    uint16_t raw[dash_wire::HV_BLOCK_COUNT];
+    uint8_t worst = SIGNAL_FRESH;
+    for (uint8_t b = 0; b < dash_wire::HV_BLOCK_COUNT; b++) {
+        const SignalSample s = signalRead((SignalId)(SIG_HV_BLOCK_01 + b));
+        raw[b] = (uint16_t)s.asInt();
+        const uint8_t f = signalFreshness(s, now);
+        if (f > worst) worst = f;
+    }
 
-    buf[o++] = (int8_t)g_sensors[9];             // ebar
-    buf[o++] = (uint8_t)g_sensors[10];           // est
+    dash_wire::BlocksPayload pl;
+    pl.seq = tx_blocks_seq++;
+    pl.freshness = worst;
+    dash_wire::encodeBlocks(raw, pl);
+    writeDisplayFrame(dash_wire::START_BLOCKS, &pl, n);
+    lastSamples = samples;
+    lastSendMs = now;
+}
 
-    // NEW: fan speed + override flag (bytes 39, 40)
-    buf[o++] = (uint8_t)g_sensors[IDX_BFS];      // fan speed 0..6
-    buf[o++] = fanOverrideEnable ? 1 : 0;     // 0/1  (make sure this is a bool var)
 
-    // car dim signal 
-    buf[o++] = g_sensors[IDX_CAR_DIM] ? 1 : 0;
 
-    // add display off flag
-    buf[o++] = g_sensors[IDX_DISPLAY_OFF];
+///////////////////////////////////////////////////////passive frame decoders////////////////////////////////////////////////////
+// One function per received ID, looked up through canDispatch. slots[] come
+// from the route table below. Signal layouts come from the DBCs through
+// can_decoders.h (scripts/gen_can_decoders.py), not hand-written shifts.
 
-    uint8_t csum = xor_checksum(&buf[2], n);     // XOR over payload only
-    buf[o++] = csum;
+// Engine RPM (non-polled)
+void decodeEngineRpm(const CanDriverFrame& can_message, const uint8_t* slots, unsigned long now) {
+    signalSetInt((SignalId)slots[0], dbc::powertrain::engine_rpm_raw(can_message.data), now);
+}
 
+// energy bar (non-polled), signed bar position + flow state nibble
+void decodeEnergyBar(const CanDriverFrame& can_message, const uint8_t* slots, unsigned long now) {
+    const uint8_t* d = can_message.data;
+    signalSetInt((SignalId)slots[0], dbc::priusv_energy_display::energy_bar_raw(d), now);
+    signalSetInt((SignalId)slots[1], dbc::priusv_energy_display::energy_flow_state_raw(d), now);
+}
 
-    // (Optional safety during bring-up)
-    if (o != (size_t)(1 + 1 + n + 1)) { Serial.printf("PACK LEN BUG: o=%u exp=%u\n", (unsigned)o, 1+1+n+1); }
+// dashboard brightness / dim state
+void decodeDashBrightness(const CanDriverFrame& can_message, const uint8_t* slots, unsigned long now) {
+    const uint8_t *d = can_message.data;
+
+    uint16_t als_raw = dbc::priusv_light_ambient_status::ambient_light_raw_raw(d);
+    bool car_dim_active = dbc::priusv_light_ambient_status::illumination_dim_active_raw(d) != 0;
+
+    // Track observed range (or set fixed numbers you like)
+    static uint16_t als_min = 80;    // darkest seen
+    static uint16_t als_max = 600;   // brightest seen
+    if (als_raw < als_min) als_min = als_raw;
+    if (als_raw > als_max) als_max = als_raw;
+
+    // ---- INVERTED map: dark -> low %, bright -> high % ----
+    uint8_t ui_brightness_pct = 50;  // default
+    if (als_max > als_min) {
+        uint16_t span = als_max - als_min;
+        uint16_t pos  = (als_raw <= als_min) ? 0 : (als_raw - als_min > span ? span : als_raw - als_min);
+        // invert here: 0..span -> 100..0
+        int pct = (int)((span - pos) * 100L / span);
+
+        // Optional floors so it's never too dim (different at night/day)
+        const uint8_t floor_day = 25;    // min brightness with lights off
+        const uint8_t floor_night = 5;   // min brightness with lights on
+        const uint8_t floor_pct = car_dim_active ? floor_night : floor_day;
+        if (pct < floor_pct) pct = floor_pct;
+
+        // Optional: mild gamma to match eye response (comment out if you want pure linear)
+        // float g = 1.3f; pct = (int)(powf(pct/100.0f, g)*100.0f + 0.5f);
+
+        ui_brightness_pct = (uint8_t)pct;
+    }
 
-    DISP.write(buf, o);
+    signalSetInt((SignalId)slots[0], ui_brightness_pct, now);   // percent for your display
+    signalSetBool((SignalId)slots[1], car_dim_active, now);
 }
 
+// dimmer knob signal, only used to tell when its all the way down
+void decodeDimmerKnob(const CanDriverFrame& can_message, const uint8_t* slots, unsigned long now) {
+    const bool dimmer_down = dbc::priusv_dimmer_rheostat_status::dimmer_down_or_display_off_raw_raw(can_message.data) == 0;
+    signalSetBool((SignalId)slots[0], dimmer_down, now);
+}
 
+// drive mode flags, slots are EV / ECO / PWR
+void decodeDriveMode(const CanDriverFrame& can_message, const uint8_t* slots, unsigned long now) {
+    namespace mode = dbc::priusv_drive_mode_status;
+    // Guard length: the flags byte is D5
+    if (can_message.length <= mode::drive_mode_flags_raw_field::LAST_BYTE) return;
+    const uint8_t* d = can_message.data;
+
+    bool ev_on  = mode::ev_mode_active_raw(d) != 0;
+    bool pwr_on = mode::pwr_mode_active_raw(d) != 0;
+    bool eco_on = mode::eco_mode_active_raw(d) != 0;
+
+    // Optional: enforce mutual exclusivity ECO vs PWR (defensive)
+    if (eco_on && pwr_on) {
+        // If this ever happens due to noise, pick one policy:
+        // e.g., clear both or prefer the previous state.
+        eco_on = pwr_on = false;
+    }
+
+    signalSetBool((SignalId)slots[0], ev_on, now);
+    signalSetBool((SignalId)slots[1], eco_on, now);
+    signalSetBool((SignalId)slots[2], pwr_on, now);
+}
+
+void decodeSteeringButtons(const CanDriverFrame& can_message, const uint8_t*, unsigned long now) {
+    handleSteeringButton(dbc::priusv_steering_wheel_buttons::steering_button_code_raw(can_message.data), now);
+}
+
+void decodeBodyAck(const CanDriverFrame& can_message, const uint8_t*, unsigned long) {
+    handleBodyAckFrame(can_message);
+}
+
+// Broadcast kinematics: raw samples into the kinematics ring at full rate.
+void decodeKinematics(const CanDriverFrame& can_message, const uint8_t*, unsigned long now) {
+    kinOnKinematics(can_message.data, now);
+}
+
+void decodeWheelSpeeds(const CanDriverFrame& can_message, const uint8_t*, unsigned long now) {
+    kinOnWheelSpeeds(can_message.data, now);
+}
+
+void decodeSpeed(const CanDriverFrame& can_message, const uint8_t*, unsigned long now) {
+    kinOnSpeed(can_message.data, now);
+}
+
+// Polled sensor responses (FC already sent by the can_rx task); slot 0 is the ECU.
+void decodeDiagResponse(const CanDriverFrame& can_message, const uint8_t* slots, unsigned long now) {
+    handleDiagResponse(slots[0], can_message, now);
+}
+
+constexpr uint8_t NO_SLOT = CAN_SLOT_NONE;
+
+constexpr CanRoute CAN_ROUTES[] = {
+  {dbc::powertrain::ID,                    decodeEngineRpm,       {SIG_ENGINE_RPM, NO_SLOT, NO_SLOT, NO_SLOT}},
+  {dbc::priusv_energy_display::ID,         decodeEnergyBar,       {SIG_EBAR, SIG_ENERGY_STATE, NO_SLOT, NO_SLOT}},
+  {dbc::priusv_light_ambient_status::ID,   decodeDashBrightness,  {SIG_DASH_BRIGHT, SIG_CAR_DIM, NO_SLOT, NO_SLOT}},
+  {dbc::priusv_dimmer_rheostat_status::ID, decodeDimmerKnob,      {SIG_DISPLAY_OFF, NO_SLOT, NO_SLOT, NO_SLOT}},
+  {dbc::priusv_drive_mode_status::ID,      decodeDriveMode,       {SIG_MODE_EV, SIG_MODE_ECO, SIG_MODE_PWR, NO_SLOT}},
+  {dbc::priusv_steering_wheel_buttons::ID, decodeSteeringButtons, {NO_SLOT, NO_SLOT, NO_SLOT, NO_SLOT}},
+  {dbc::kinematics::ID,                    decodeKinematics,      {NO_SLOT, NO_SLOT, NO_SLOT, NO_SLOT}},
+  {dbc::wheel_speeds::ID,                  decodeWheelSpeeds,     {NO_SLOT, NO_SLOT, NO_SLOT, NO_SLOT}},
+  {dbc::speed::ID,                         decodeSpeed,           {NO_SLOT, NO_SLOT, NO_SLOT, NO_SLOT}},
+  {0x758,                                  decodeBodyAck,         {NO_SLOT, NO_SLOT, NO_SLOT, NO_SLOT}},  // window/wireless buzzer ACKs
+  {0x7E8,                                  decodeDiagResponse,    {ECU_ENGINE, NO_SLOT, NO_SLOT, NO_SLOT}},
+  {0x7EA,                                  decodeDiagResponse,    {ECU_HYBRID, NO_SLOT, NO_SLOT, NO_SLOT}},
+  {0x7B8,                                  decodeDiagResponse,    {ECU_SKID, NO_SLOT, NO_SLOT, NO_SLOT}},
+  {0x7C8,                                  decodeDiagResponse,    {ECU_BODY, NO_SLOT, NO_SLOT, NO_SLOT}},
+  {0x7CC,                                  decodeDiagResponse,    {ECU_HVAC, NO_SLOT, NO_SLOT, NO_SLOT}},
+};
+static_assert(canRoutesValid(CAN_ROUTES), "CAN_ROUTES: duplicate or non-standard ID");
+constexpr CanDispatch<sizeof(CAN_ROUTES) / sizeof(CAN_ROUTES[0])> canDispatch(CAN_ROUTES);
+// Every ID we watch is a route (diag responses included), so they all fit.
+static_assert(canDispatch.size() <= CAN_RX_MAX_WATCHED, "CAN_ROUTES outgrew CAN_RX_MAX_WATCHED");
+
+// A periodic broadcast that stops (gateway asleep, a module dropped off)
+// leaves its signals at their last value; mark them held so they read as
+// late straight away rather than after the store's generous gaps. The next
+// decoded frame makes them good again.
+void updateBroadcastSilence() {
+    static bool silent[sizeof(CAN_ROUTES) / sizeof(CAN_ROUTES[0])] = {};
+    const uint32_t nowUs = micros();
+    for (size_t i = 0; i < canDispatch.size(); i++) {
+        const CanRoute& r = canDispatch.route(i);
+        if (r.decode == decodeDiagResponse) continue; // slots are ECUs, and replies aren't periodic
+        const bool now = canIdStatsSilent(r.id, nowUs);
+        if (now && !silent[i]) {
+            Serial.printf("[CAN] 0x%03X went silent\n", r.id);
+            for (uint8_t slot : r.slots) {
+                if (slot != NO_SLOT) signalSetQuality((SignalId)slot, SIGNAL_HELD);
+            }
+        } else if (!now && silent[i]) {
+            Serial.printf("[CAN] 0x%03X back\n", r.id);
+        }
+        silent[i] = now;
+    }
+}
 
 ////////////////////////////////////////////////////////////setup//////////////////////////////////////////////////////////
 void setup() {
@@ -455,19 +1073,24 @@ void setup() {
     Serial.println("------------------------");
     Serial.println(" CAN...............INIT");
 
-    CAN0.setCANPins(GPIO_NUM_4, GPIO_NUM_5);
-    CAN0.begin(500000); // 500Kbps
-
-    // CAN0.watchFor();
+    // Everything with a decoder; diag responses get trimmed once discovery is done.
+    for (size_t i = 0; i < canDispatch.size(); i++) {
+        canRxWatch(canDispatch.route(i).id);
+    }
 
-    CAN0.watchFor(0x1C4); // engine RPM
-    CAN0.watchFor(0x247); // energy bar + state_energy_drain
-    CAN0.watchFor(0x620); // dashboard brightness + dim state
-    CAN0.watchFor(0x7EA); // multi-frame responses go here
-    CAN0.watchFor(0x610); // dimmer knob signal
-    CAN0.watchFor(0x49B); // drive mode status
-    CAN0.watchFor(0x58E); // steering wheel directional/enter/back buttons
-    CAN0.watchFor(0x758); // body ECU positive responses (window/wireless buzzer ACKs)
+    // TX on GPIO5, RX on GPIO4, 500 kbps; frames come in on the can_rx task.
+    // One-deep driver TX queue: can_tx does the ordering.
+    CanDriverConfig can = {};
+    can.txPin = GPIO_NUM_5;
+    can.rxPin = GPIO_NUM_4;
+    can.bitrate = 500000;
+    can.rxQueueLen = 64;
+    can.txQueueLen = 1;
+    if (!canDriverBegin(can)) Serial.println(" CAN.............FAILED");
+    canRxApplyFilters(); // hardware filter from the watch list above
+    if (!canRxBegin()) Serial.println(" CAN RX..........FAILED");
+    if (!canTxBegin()) Serial.println(" CAN TX..........FAILED");
+    if (!traceBegin()) Serial.println(" TRACE...........FAILED");
 
     Serial.println(" CAN............500Kbps");
 
@@ -481,499 +1104,165 @@ void setup() {
     peer.channel = 0; // use current channel
     peer.encrypt = false;
     esp_now_add_peer(&peer);
+    esp_now_register_recv_cb(onEspNowRecv); // MatrixIndicator subscriptions
     Serial.println(" ESP-NOW.............INIT");
 
     const unsigned long now = millis();
-    for (uint8_t s = 0; s < SENSOR_COUNT; s++) {
-        sensorNextDueMs[s] = now;
+    for (uint8_t sensor = 0; sensor < SENSOR_COUNT; sensor++) {
+        sensorEcu[sensor] = ecuForRequestId(pidRequests[sensorRequests[sensor]].requestId);
+        const PollTiming& t = sensorTiming[sensor];
+        pollSchedConfigure(sensor, sensorEcu[sensor], t.periodMs, t.jitterMs);
+        if (t.idleFill) {
+            pollSchedSetIdleFill(sensor, t.minMs);
+        } else {
+            pollSchedSetAdaptive(sensor, t.minMs, t.maxMs);
+        }
+        if (t.laneShare) pollSchedSetLaneShare(sensor, t.laneShare);
     }
+    pollSchedStart(now);
+    loop_profile::init(loopProfile, getCpuFrequencyMhz(), STAGE_NAMES, STAGE_COUNT, LOOP_BUDGET_US);
+
+    // Nothing is polled until someone subscribes, apart from our own needs.
+    subscribeLocalConsumers(now);
+    subsService(now);
+    applySubscriptionDemand(now);
+
+    uint32_t requestIds[ECU_COUNT];
+    for (uint8_t e = 0; e < ECU_COUNT; e++) {
+        busLoadMarkInduced(diagEcus[e].responseId); // replies count as our traffic
+        isoTpInit(ecuLanes[e].isotp, diagEcus[e].requestId, diagEcus[e].responseId,
+                  0, 0, true); // FC comes from the can_rx task
+        releaseLane(ecuLanes[e]);
+        requestIds[e] = diagEcus[e].requestId;
+    }
+    // Lanes probe capabilities (or load them from NVS) before polling.
+    discoveryInit(requestIds, ECU_COUNT, ECU_ENGINE);
 }
 
 ////////////////////////////////////////////////////////////main loop//////////////////////////////////////////////////////////
 void loop() {
-    CAN_FRAME can_message;
+    CanDriverFrame can_message;
     unsigned long currentTime = millis();
+    loop_profile::beginPass(loopProfile);
     processSteeringControlState(currentTime);
+    loop_profile::endStage(loopProfile, STAGE_STEERING);
+    pollDebugConsole();
+    canDriverService();
+    updateBusLoad(currentTime);
+    updateLoopProfileSignals(currentTime);
+    subsPollUart(DISP, currentTime);
+    if (subsService(currentTime)) {
+        applySubscriptionDemand(currentTime);
+        updateDiagWatch();
+    }
     const bool windowBusy = isWindowMotionBusy();
     static bool lastWindowBusy = false;
     static unsigned long lastWindowWaitDiagMs = 0;
     static unsigned long lastWaitingDiagMs = 0;
 
-    if (POLL_DIAG && windowBusy != lastWindowBusy) {
-        Serial.printf("[POLL %lu] WINDOW_BUSY %s waiting=%u sensor=%s\n",
-                      currentTime, windowBusy ? "ON" : "OFF", waiting ? 1 : 0,
-                      sensorName(currentPollSensor));
+    if (windowBusy != lastWindowBusy) {
+        traceEvent(TRACE_WINDOW_BUSY, TRACE_NO_SENSOR, windowBusy);
         lastWindowBusy = windowBusy;
     }
 
-    if (POLL_DIAG && windowBusy && waiting && currentTime - lastWindowWaitDiagMs >= 250) {
-        Serial.printf("[POLL %lu] WAIT_PAUSED_BY_WINDOW sensor=%s elapsed=%lu\n",
-                      currentTime, sensorName(currentPollSensor), currentTime - requestTimeout);
+    if (windowBusy && lanesInFlight() && currentTime - lastWindowWaitDiagMs >= 250) {
+        traceEvent(TRACE_WINDOW_WAIT, TRACE_NO_SENSOR, lanesInFlight());
         lastWindowWaitDiagMs = currentTime;
     }
 
-    if (POLL_DIAG && !windowBusy && waiting && currentTime - lastWaitingDiagMs >= POLL_DIAG_GAP_MS) {
-        pollDiagMark("WAITING", currentTime);
-        Serial.printf("[POLL %lu] WAITING sensor=%s elapsed=%lu limit=%lu since_last_rx=%lu\n",
-                      currentTime, sensorName(currentPollSensor),
-                      currentTime - requestTimeout,
-                      currentPollSensor < SENSOR_COUNT ? sensorTimeoutMs[currentPollSensor] : 0,
-                      pollDiagLastRxMs ? currentTime - pollDiagLastRxMs : 0);
+    if (!windowBusy && lanesInFlight() && currentTime - lastWaitingDiagMs >= TRACE_WAITING_MS) {
+        for (uint8_t e = 0; e < ECU_COUNT; e++) {
+            const EcuLane& lane = ecuLanes[e];
+            if (!lane.waiting) continue;
+            traceEvent(TRACE_WAITING, lane.sensor, traceMs(currentTime - lane.requestMs));
+        }
         lastWaitingDiagMs = currentTime;
     }
 
-    // STEP 1: PID scheduler
-    if (!windowBusy && !waiting) {
-        int8_t nextSensor = pickNextDueSensor(currentTime);
-        if (nextSensor >= 0) {
-            currentPollSensor = (uint8_t)nextSensor;
-            if (POLL_DIAG) {
-                pollDiagMark("REQ", currentTime);
-                Serial.printf("[POLL %lu] REQ sensor=%s timeout=%lu\n",
-                              currentTime, sensorName(currentPollSensor),
-                              sensorTimeoutMs[currentPollSensor]);
+    static unsigned long lastBehindMs = 0;
+    if (currentTime - lastBehindMs >= 100) {
+        updateSensorsBehind(currentTime);
+        updateBroadcastSilence();
+        lastBehindMs = currentTime;
+    }
+    loop_profile::endStage(loopProfile, STAGE_SERVICE);
+
+    // STEP 1: PID scheduler, one request in flight per ECU
+    if (!windowBusy) {
+        for (uint8_t e = 0; e < ECU_COUNT; e++) {
+            EcuLane& lane = ecuLanes[e];
+            if (lane.waiting) continue;
+            // Probes and polls take turns while discovery runs, so a slow or
+            // sleeping ECU doesn't hold its sensors back; until it's done
+            // every PID counts as supported.
+            if (!lane.capsApplied && lane.probeTurn) {
+                uint8_t service, pid;
+                const DiscoveryStep step = discoveryNext(e, &service, &pid);
+                if (step == DISCOVERY_REQUEST) {
+                    sendDiscoveryProbe(e, service, pid, currentTime);
+                    lane.probeTurn = false;
+                    continue;
+                }
+                if (step == DISCOVERY_DONE) {
+                    applyCapabilities(e, currentTime);
+                    updateDiagWatch();
+                }
+            }
+            lane.probeTurn = true;
+            int8_t nextSensor = pollSchedPick(e, currentTime);
+            if (nextSensor < 0) continue;
+            buildLaneBatch(e, (uint8_t)nextSensor, currentTime);
+            traceEvent(TRACE_REQ, lane.sensor, lane.batchCount);
+            for (uint8_t i = 0; i < lane.batchCount; i++) {
+                pollSchedDispatched(lane.batch[i], currentTime);
             }
-            sendSensorRequest(currentPollSensor);
-            waiting = true;
-            requestTimeout = currentTime;
+            sendLaneRequest(lane, currentTime);
+            lane.waiting = true;
+            lane.requestMs = currentTime;
         }
     }
+    loop_profile::endStage(loopProfile, STAGE_SCHEDULER);
 
     // STEP 2: Process CAN messages before timeout checks so queued replies win.
-    while (CAN0.read(can_message)) {
-
+    while (canRxPop(can_message)) {
         // force battery fan on
-        // sendCANFrame(0x7E2, {0x06,0x30,0x81,0x06,0x06,6,0x00,0x00});
-
-
-        switch (can_message.id) {
-
-            // Engine RPM (non-polled)
-            case 0x1C4:
-                g_sensors[0] = Process_Endian(can_message.data.byte[0], can_message.data.byte[1]);
-                break;
-
-            // energy bar (non-polled)
-            case 0x247: { // BO_ 583 Display_1
-                const uint8_t* d = can_message.data.byte;
-
-                // SG_ BAR_ENERGY : 15|8@0-   -> signed 8-bit at byte 1
-                int8_t bar_energy = (int8_t)d[1];
+        // sendCANFrame(CAN_TX_KEEPALIVE, 0x7E2, {0x06,0x30,0x81,0x06,0x06,6,0x00,0x00});
 
-                // SG_ STATE_ENERGYDRAIN : 3|4@0+ -> bits 3..0 of byte 0
-                uint8_t state_energy_drain = d[0] & 0x0F;
-
-                // TODO: store them wherever you like
-                // e.g., g_sensors[8] = bar_energy;
-                //       g_sensors[9] = state_energy_drain;
-
-                g_sensors[9] = bar_energy;
-                g_sensors[10] = state_energy_drain;
-
-                // (optional) quick print
-                // Serial.print("BAR_ENERGY="); Serial.print(bar_energy);
-                // Serial.print("  STATE_ENERGYDRAIN="); Serial.println(state_energy_drain);
-                break;
-            }
-
-            // dashboard brightness / dim state
-            case 0x620: {
-                const uint8_t *d = can_message.data.byte;
-
-                uint16_t als_raw = (uint16_t(d[2]) << 8) | d[3];   // D3<<8 | D4
-                bool car_dim_active = (d[4] & 0x40) != 0;          // D5 bit6
-
-                // Track observed range (or set fixed numbers you like)
-                static uint16_t als_min = 80;    // darkest seen
-                static uint16_t als_max = 600;   // brightest seen
-                if (als_raw < als_min) als_min = als_raw;
-                if (als_raw > als_max) als_max = als_raw;
-
-                // ---- INVERTED map: dark -> low %, bright -> high % ----
-                uint8_t ui_brightness_pct = 50;  // default
-                if (als_max > als_min) {
-                    uint16_t span = als_max - als_min;
-                    uint16_t pos  = (als_raw <= als_min) ? 0 : (als_raw - als_min > span ? span : als_raw - als_min);
-                    // invert here: 0..span -> 100..0
-                    int pct = (int)((span - pos) * 100L / span);
-
-                    // Optional floors so it's never too dim (different at night/day)
-                    const uint8_t floor_day = 25;    // min brightness with lights off
-                    const uint8_t floor_night = 5;   // min brightness with lights on
-                    const uint8_t floor_pct = car_dim_active ? floor_night : floor_day;
-                    if (pct < floor_pct) pct = floor_pct;
-
-                    // Optional: mild gamma to match eye response (comment out if you want pure linear)
-                    // float g = 1.3f; pct = (int)(powf(pct/100.0f, g)*100.0f + 0.5f);
-
-                    ui_brightness_pct = (uint8_t)pct;
-                }
-
-                // store/send as before
-                g_sensors[IDX_DASH_BRIGHT] = (float)ui_brightness_pct;   // percent for your display
-                g_sensors[IDX_CAR_DIM] = car_dim_active ? 1.0f : 0.0f;
-
-                // Serial.printf("ALS=%u -> %u%%  DIM=%d\n", als_raw, ui_brightness_pct, car_dim_active);
-                break;
-            }
-
-            // dimmer knob signal, only used to tell when its all the way down
-            case 0x610: {
-                const bool dimmer_down = (can_message.data.byte[3] == 0x00);
-                // Serial.println(dimmer_down ? "Dimmer Down" : "Dimmer Up");
-                g_sensors[IDX_DISPLAY_OFF] = dimmer_down ? 1.0f : 0.0f;
-                break;
-            }
+        canIdStatsOnFrame(can_message, can_message.us);
+        canDispatch.dispatch(can_message, currentTime);
+    } // end CAN read drain loop
 
-            case 0x49B: {
-            // Guard length: we need at least 4 bytes (D1..D4)
-            // print entire message for debugging
-            // Serial.print("49B: ");
-            // for (int i = 0; i < can_message.length; i++) {
-            //   Serial.print(can_message.data.byte[i], HEX);
-            //   Serial.print(" ");
-            // }
-            // Serial.println();
-                if (can_message.length >= 4) {
-                    uint8_t flags = can_message.data.byte[4];  // D4 in your CSV
-
-                    bool ev_on  = (flags & 0x02) != 0;  // bit1
-                    bool pwr_on = (flags & 0x04) != 0;  // bit2
-                    bool eco_on = (flags & 0x08) != 0;  // bit3
-
-                    // Optional: enforce mutual exclusivity ECO vs PWR (defensive)
-                    if (eco_on && pwr_on) {
-                    // If this ever happens due to noise, pick one policy:
-                    // e.g., clear both or prefer the previous state.
-                    eco_on = pwr_on = false;
-                    }
-
-                    // Store as 0/1 in g_sensors (or keep as bools if you prefer)
-                    g_sensors[IDX_MODE_EV]  = ev_on  ? 1.0f : 0.0f;
-                    g_sensors[IDX_MODE_ECO] = eco_on ? 1.0f : 0.0f;
-                    g_sensors[IDX_MODE_PWR] = pwr_on ? 1.0f : 0.0f;
-
-                    // Optional quick print
-                    // Serial.printf("Modes: EV=%d ECO=%d PWR=%d (flags=0x%02X)\n", ev_on, eco_on, pwr_on, flags);
-                }
-                break;
-            }
+    currentTime = millis();
+    updateKinematicsSignals(currentTime);
+    loop_profile::endStage(loopProfile, STAGE_CAN_DRAIN);
 
-            case 0x58E: {
-                // Steering button code is in D6.
-                uint8_t code = can_message.data.byte[5];
-                handleSteeringButton(code, currentTime);
-                break;
-            }
+    // STEP 3: ISO-TP timers (N_Bs/N_Cr, pending CFs) and in-flight timeouts
+    for (uint8_t e = 0; e < ECU_COUNT; e++) {
+        if (isoTpPoll(ecuLanes[e].isotp, currentTime) == ISOTP_RX_ERROR && ecuLanes[e].waiting) {
+            timeoutLane(e, currentTime);
+        }
+    }
 
-            case 0x758: {
-                handleBodyAckFrame(can_message);
-                break;
+    if (!windowBusy) {
+        for (uint8_t e = 0; e < ECU_COUNT; e++) {
+            const EcuLane& lane = ecuLanes[e];
+            if (!lane.waiting) continue;
+            const unsigned long limit = lane.discovering ? DISCOVERY_TIMEOUT_MS
+                                      : lane.sensor < SENSOR_COUNT ? laneTimeoutMs(lane)
+                                      : 0;
+            if (limit != 0 && currentTime - lane.requestMs >= limit) {
+                timeoutLane(e, currentTime);
             }
-
-
-
-
-            // Polled sensor responses
-            case 0x7EA: {
-
-                // Debug dump of 7EA frames
-                // Serial.print("7EA: ");
-                // for (int i = 0; i < can_message.length; i++) {
-                //   Serial.print(can_message.data.byte[i], HEX);
-                //   Serial.print(" ");
-                // }
-                // Serial.println();
-
-	                if (waiting) {
-	                    const uint8_t* b = can_message.data.byte;
-	                    const uint8_t  pciType = b[0] & 0xF0; // 0x00=SF, 0x10=FF, 0x20=CF, 0x30=FC
-	                    const uint8_t  seq     = b[0] & 0x0F; // CF sequence (1..15)
-
-                        // ISO-TP timing matters: answer first frames with FC before
-                        // any Serial diagnostics can block the loop.
-                        bool sentImmediateFc = false;
-                        if (pciType == 0x10 && can_message.length >= 4) {
-	                            const bool needsFc =
-	                                (currentPollSensor == SENSOR_HV_CURRENT && b[2] == 0x61 && b[3] == 0x98) ||
-	                                (currentPollSensor == SENSOR_HV_VOLTAGE && b[2] == 0x61 && b[3] == 0x74) ||
-	                                (currentPollSensor == SENSOR_HV_TEMPS && b[2] == 0x61 && b[3] == 0x87);
-                            if (needsFc) {
-                                sendFlowControl(0x7E2, 0x00, 0x00);
-                                sentImmediateFc = true;
-                            }
-                        }
-
-	                    pollDiagFrame("RX", currentTime, can_message);
-                        if (sentImmediateFc && POLL_DIAG) {
-                            Serial.printf("[POLL %lu] FC_IMMEDIATE sensor=%s target=0x7E2 stmin=0\n",
-                                          currentTime, sensorName(currentPollSensor));
-                        }
-
-                    switch (currentPollSensor) {
-	                        // ---------------------- Battery Current (21 98) ----------------------
-	                        case 0: {
-	                            bool decoded = false;
-
-                            // SF layout (if ever used): b[1]=0x61, b[2]=0x98, A=b[3], B=b[4]
-                            // if (pciType == 0x00 /*SF*/ && b[1] == 0x61 && b[2] == 0x98 && can_message.length >= 5) {
-                            //     g_sensors[1] = ((b[3] * 256 + b[4]) / 100.0f) - 327.7f;
-                            //     decoded = true;
-                            // }
-
-	                            // FF layout (your logs show FF for 61 98): A=b[4], B=b[5]
-		                            if (pciType == 0x10 /*FF*/ && b[2] == 0x61 && b[3] == 0x98 && can_message.length >= 6) {
-		                                g_sensors[1] = ((b[4] * 256 + b[5]) / 100.0f) - 327.7f;
-		                                if (POLL_DIAG) {
-		                                    Serial.printf("[POLL %lu] DECODE sensor=%s amps=%.2f\n",
-		                                                  currentTime, sensorName(currentPollSensor),
-		                                                  (double)g_sensors[IDX_HV_CURRENT]);
-		                                }
-		                                // Value is in the FF, but finish the ISO-TP exchange by
-	                                    // waiting for CF#1 before starting another request.
-		                            }
-
-                                if (pciType == 0x20 /*CF*/ && seq == 0x01) {
-                                    decoded = true;
-                                }
-
-	                            if (decoded) {
-	                                completeCurrentSensor(currentTime);
-                            }
-                            break;
-                        }
-
-                        // ---------------------- Battery Voltage (21 74) ----------------------
-                        case 1: {
-		                            if (pciType == 0x10 /*FF*/ && b[2] == 0x61 && b[3] == 0x74) {
-		                                // Be loud so we know this ran:
-		                                // Serial.println("FF 61 74 seen -> sending FC to 0x7EA and 0x7E2 (BS=0, STmin=5ms)");
-		                                // Send FC back to the ECU so it sends the consecutive frame.
-		                                // do NOT advance; wait for CF#1 (seq==1), which carries F/G
-	                            }
-
-
-                            // CF#1 carries F,G at b[2],b[3] → Voltage=(F*256+G)/2
-	                            if (pciType == 0x20 /*CF*/ && seq == 0x01 && can_message.length >= 4) {
-	                                uint16_t raw = (uint16_t(b[2]) << 8) | b[3]; // F,G
-	                                g_sensors[2] = raw / 2.0f;                    // volts
-                                    if (POLL_DIAG) {
-                                        Serial.printf("[POLL %lu] DECODE sensor=%s volts=%.1f\n",
-                                                      currentTime, sensorName(currentPollSensor),
-                                                      (double)g_sensors[IDX_HV_VOLTAGE]);
-                                    }
-	                                completeCurrentSensor(currentTime);
-	                            }
-                            break;
-                        }
-
-                        // ---------------------- Coolant Temp (Mode 01 PID 05) ----------------------
-                        case 2: {
-                            bool decoded = false;
-
-                            // Proper Mode 01 SF: b[1]=0x41, b[2]=0x05, A=b[3]
-	                            if (pciType == 0x00 /*SF*/ && b[1] == 0x41 && b[2] == 0x05 && can_message.length >= 4) {
-	                                g_sensors[3] = b[3] - 40.0f;
-	                                decoded = true;
-                                    if (POLL_DIAG) {
-                                        Serial.printf("[POLL %lu] DECODE sensor=%s c=%.1f\n",
-                                                      currentTime, sensorName(currentPollSensor),
-                                                      (double)g_sensors[IDX_ECT]);
-                                    }
-	                            }
-
-                            if (decoded) {
-                                completeCurrentSensor(currentTime);
-                            }
-                            break;
-                        }
-
-                        case 3: { // 21 87 — HV battery temps & intake temp
-                            const uint8_t* b = can_message.data.byte;
-                            const uint8_t  pciType = b[0] & 0xF0; // 0x10=FF, 0x20=CF
-                            const uint8_t  seq     = b[0] & 0x0F;
-
-                            auto word_to_C = [](uint16_t w)->float {
-                                return (w * 255.9f / 65535.0f) - 50.0f;  // Celsius per Torque equation
-                            };
-
-                            // FF: 61 87, payload: A=b[4],B=b[5],C=b[6],D=b[7]
-		                            if (pciType == 0x10 && b[2] == 0x61 && b[3] == 0x87) {
-		                                // Send Flow Control to the ECU so we get CF#1 with E..H
-
-	                                uint16_t AB = (uint16_t(b[4]) << 8) | b[5]; // Intake
-                                uint16_t CD = (uint16_t(b[6]) << 8) | b[7]; // TB1
-	                                g_sensors[IDX_HV_INTAKE_C] = word_to_C(AB);
-	                                g_sensors[IDX_HV_TB1_C]    = word_to_C(CD);
-                                    if (POLL_DIAG) {
-                                        Serial.printf("[POLL %lu] DECODE_PART sensor=%s intake=%.1f tb1=%.1f\n",
-                                                      currentTime, sensorName(currentPollSensor),
-                                                      (double)g_sensors[IDX_HV_INTAKE_C],
-                                                      (double)g_sensors[IDX_HV_TB1_C]);
-                                    }
-	                                // Do not advance yet; finish TB2/TB3 from CF#1
-	                            }
-
-                            // CF#1: seq==1, payload: E=b[1],F=b[2],G=b[3],H=b[4],I=b[5]...
-                            if (pciType == 0x20 && seq == 0x01 && can_message.length >= 5) {
-                                uint16_t EF = (uint16_t(b[1]) << 8) | b[2]; // TB2 uses E,F
-	                                uint16_t GH = (uint16_t(b[3]) << 8) | b[4]; // TB3 uses G,H
-	                                g_sensors[6] = (EF * 255.9f / 65535.0f) - 50.0f; // TB2 °C
-	                                g_sensors[7] = (GH * 255.9f / 65535.0f) - 50.0f; // TB3 °C
-                                    if (POLL_DIAG) {
-                                        Serial.printf("[POLL %lu] DECODE sensor=%s tb2=%.1f tb3=%.1f\n",
-                                                      currentTime, sensorName(currentPollSensor),
-                                                      (double)g_sensors[IDX_HV_TB2_C],
-                                                      (double)g_sensors[IDX_HV_TB3_C]);
-                                    }
-
-	                                completeCurrentSensor(currentTime);
-	                            }
-
-                            break;
-                        }
-
-                        case 4: { // SOC - 01 5B
-                            bool decoded = false;
-                            const uint8_t* b = can_message.data.byte;
-                            uint8_t pciType = b[0] & 0xF0; // 0x00 = SF
-
-                            // Mode 01 SF reply: b[1]=0x41, b[2]=0x5B, A=b[3]
-	                            if (pciType == 0x00 && b[1] == 0x41 && b[2] == 0x5B && can_message.length >= 4) {
-	                                float soc = (b[3] * 20.0f) / 51.0f; // percent
-	                                g_sensors[8] = soc;                 // pick any free slot; e.g., index 8
-	                                decoded = true;
-                                    if (POLL_DIAG) {
-                                        Serial.printf("[POLL %lu] DECODE sensor=%s pct=%.1f\n",
-                                                      currentTime, sensorName(currentPollSensor),
-                                                      (double)g_sensors[8]);
-                                    }
-	                            }
-                            if (decoded) {
-                                completeCurrentSensor(currentTime);
-                            }
-                            break;
-                        }
-                        
-                        // ---------------------- HV battery fan mode (21 9B) ----------------------
-	                        case 5: {
-                            bool decoded = false;
-                            uint8_t mode = 0xFF;  // invalid placeholder
-
-                            // We’re in 0x7EA and waiting==true already
-                            // pciType & seq are computed above
-
-                            //print this entire frame for debugging
-                            // for(int i=0; i<can_message.length; i++) {
-                            //     Serial.print(can_message.data.byte[i], HEX);
-                            //     Serial.print(" ");
-                            // }
-                            // Serial.println();
-                            
-
-                            // Single Frame: [00 len][61][9B][A][B]...
-                            if (pciType == 0x00 /*SF*/ && b[1] == 0x61 && b[2] == 0x9B) {
-                                if (can_message.length >= 5) {          // need A and B present
-                                    mode = b[4];                        // B = second byte after 61 9B
-                                    decoded = true;
-                                }
-                            }
-
-                            // First Frame: [10 xx][61][9B][A][B]...
-                            if (pciType == 0x10 /*FF*/ && b[2] == 0x61 && b[3] == 0x9B) {
-                                if (can_message.length >= 6) {          // A at b[4], B at b[5]
-                                    mode = b[5];
-                                    decoded = true;
-                                    // No Flow Control needed: we already have byte B in the FF
-                                }
-                            }
-
-                            // (Ignore CFs — we don’t need them for byte B)
-
-	                            if (decoded) {
-	                                if (mode <= 6) {
-	                                    g_sensors[11] = mode;               // pick free slot for BFS
-	                                } else {
-	                                    g_sensors[11] = 0;                  // clamp/guard if odd value
-	                                }
-                                    if (POLL_DIAG) {
-                                        Serial.printf("[POLL %lu] DECODE sensor=%s mode=%u\n",
-                                                      currentTime, sensorName(currentPollSensor),
-                                                      (unsigned)g_sensors[IDX_BFS]);
-                                    }
-	                                completeCurrentSensor(currentTime);
-	                            }
-	                            break;
-	                        }
-
-                            // ---------------------- MG1 temperature + RPM (21 61) ----------------------
-                            case SENSOR_MG1: {
-                                bool decoded = false;
-
-                                // Torque CSV rows:
-                                // MG1 temperature = A * 9 / 5 - 40
-                                // MG1 revolution = D * 256 + E - 32768
-                                // 21 61 replies fit in one ISO-TP single frame:
-                                // [07][61][61][A][B][C][D][E]
-                                if (pciType == 0x00 && b[1] == 0x61 && b[2] == 0x61 && can_message.length >= 8) {
-                                    g_sensors[IDX_MG1_TEMP_F] = b[3] * 9.0f / 5.0f - 40.0f;
-                                    g_sensors[IDX_MG1_RPM] = (float)(((uint16_t)b[6] << 8) | b[7]) - 32768.0f;
-                                    decoded = true;
-                                }
-
-                                if (decoded) {
-                                    completeCurrentSensor(currentTime);
-                                }
-                                break;
-                            }
-
-                            // ---------------------- MG2 temperature + RPM (21 62) ----------------------
-                            case SENSOR_MG2: {
-                                bool decoded = false;
-
-                                // Torque CSV rows:
-                                // MG2 temperature = A * 9 / 5 - 40
-                                // MG2 revolution = D * 256 + E - 32768
-                                // 21 62 replies fit in one ISO-TP single frame:
-                                // [07][61][62][A][B][C][D][E]
-                                if (pciType == 0x00 && b[1] == 0x61 && b[2] == 0x62 && can_message.length >= 8) {
-                                    g_sensors[IDX_MG2_TEMP_F] = b[3] * 9.0f / 5.0f - 40.0f;
-                                    g_sensors[IDX_MG2_RPM] = (float)(((uint16_t)b[6] << 8) | b[7]) - 32768.0f;
-                                    decoded = true;
-                                }
-
-                                if (decoded) {
-                                    completeCurrentSensor(currentTime);
-                                }
-                                break;
-                            }
-
-
-
-                    }
-	                } else if (POLL_DIAG) {
-                        pollDiagFrame("STRAY_RX_NOT_WAITING", currentTime, can_message);
-                    }
-	                break;
-	            }
-
-            default:
-                break;
         }
-    } // end CAN read drain loop
-
-    currentTime = millis();
-
-    // STEP 3: in-flight timeout
-    if (!windowBusy && waiting && currentPollSensor < SENSOR_COUNT && currentTime - requestTimeout >= sensorTimeoutMs[currentPollSensor]) {
-        timeoutCurrentSensor(currentTime);
     }
+    loop_profile::endStage(loopProfile, STAGE_TIMEOUTS);
 
     // fan override every 2 seconds if enabled
     static unsigned long lastFanOverrideTime = 0;
 
     // if any battery temp is over 37c, enable fan override
-    if(g_sensors[IDX_HV_TB1_C] > 37.0 || g_sensors[IDX_HV_TB2_C] > 37.0 || g_sensors[IDX_HV_TB3_C] > 37.0) {
+    constexpr int32_t FAN_OVERRIDE_RAW = dash_wire::HvTemp::fromValue(37);
+    if(signalInt(SIG_HV_TB1_C) > FAN_OVERRIDE_RAW || signalInt(SIG_HV_TB2_C) > FAN_OVERRIDE_RAW || signalInt(SIG_HV_TB3_C) > FAN_OVERRIDE_RAW) {
         fanOverrideEnable = 1;
     } else {
         fanOverrideEnable = 0;
@@ -982,43 +1271,32 @@ void loop() {
     if (currentTime - lastFanOverrideTime >= 2000) {
         if(fanOverrideEnable == 1) {
             // force battery fan on
-            sendCANFrame(0x7E2, {0x06,0x30,0x81,0x06,0x06,6,0x00,0x00});
+            sendCANFrame(CAN_TX_KEEPALIVE, 0x7E2, {0x06,0x30,0x81,0x06,0x06,6,0x00,0x00});
         }
         lastFanOverrideTime = currentTime;
     }
+    loop_profile::endStage(loopProfile, STAGE_FAN);
 
 
 
     // STEP 4: Serial output
     static unsigned long lastPrintTime = 0;
     if (currentTime - lastPrintTime >= 30) {
-        // Serial.print(F("RPM: "));       Serial.print(g_sensors[IDX_RPM]);            Serial.print(' ');
-        // Serial.print(F("Bat I: "));     Serial.print(g_sensors[IDX_HV_CURRENT], 2);  Serial.print(F("A "));
-        // Serial.print(F("Bat V: "));     Serial.print(g_sensors[IDX_HV_VOLTAGE], 1);  Serial.print(F("V "));
-        // Serial.print(F("Coolant: "));   Serial.print(g_sensors[IDX_ECT], 1);         Serial.print(F("C "));
-        // Serial.print(F("HV Intake: ")); Serial.print(g_sensors[IDX_HV_INTAKE_C], 1); Serial.print(F("C "));
-        // Serial.print(F("TB1: "));       Serial.print(g_sensors[IDX_HV_TB1_C], 1);    Serial.print(F("C "));
-        // Serial.print(F("TB2: "));       Serial.print(g_sensors[IDX_HV_TB2_C], 1);    Serial.print(F("C "));
-        // Serial.print(F("TB3: "));       Serial.print(g_sensors[IDX_HV_TB3_C], 1);    Serial.print(F("C "));
-        // Serial.print(F("SOC: "));       Serial.print(g_sensors[8], 1);               Serial.print(F("% "));
-        // Serial.print(F("Ebar: "));      Serial.print((int)g_sensors[9]);             Serial.print(F("  "));
-        // Serial.print(F("ES: "));        Serial.print((int)g_sensors[10]);            Serial.print(F("  "));
-        // Serial.print(F("BFS: "));     Serial.print((int)g_sensors[11]);            Serial.print(F("  "));
-        // Serial.print(F("Dash Bright: ")); Serial.print((int)g_sensors[IDX_DASH_BRIGHT]); Serial.print(F("%  "));
-        // Serial.print(F("Car Dim: "));  Serial.print((int)g_sensors[IDX_CAR_DIM]);    Serial.print(F("  "));
-        // Serial.println();
-
-        // sendCANFrame(0x7E2, {0x06,0x30,0x81,0x06,0x06,6,0x00,0x00});
-
-        sendSensorsFloat();
+        // per-signal values, ages and quality: 'v' on the debug console
+
+        // sendCANFrame(CAN_TX_KEEPALIVE, 0x7E2, {0x06,0x30,0x81,0x06,0x06,6,0x00,0x00});
+
+        sendSensors(currentTime);
+        sendBlocks(currentTime);
         lastPrintTime = currentTime;
     }
+    loop_profile::endStage(loopProfile, STAGE_UART);
 
     // STEP 5: ESP-NOW send
-    uint8_t engine_on = (g_sensors[IDX_RPM] > 500.0f) ? 1 : 0;
-    uint8_t car_dim = (uint8_t)g_sensors[IDX_CAR_DIM] ? 1 : 0;
-    uint8_t ev_mode = int(g_sensors[IDX_MODE_EV]); // placeholder for future use
-    uint8_t display_off = int(g_sensors[IDX_DISPLAY_OFF]); 
+    uint8_t engine_on = (signalInt(SIG_ENGINE_RPM) > 500) ? 1 : 0;
+    uint8_t car_dim = signalBool(SIG_CAR_DIM) ? 1 : 0;
+    uint8_t ev_mode = signalBool(SIG_MODE_EV) ? 1 : 0; // placeholder for future use
+    uint8_t display_off = signalBool(SIG_DISPLAY_OFF) ? 1 : 0;
 
     uint8_t flags =
         (engine_on << 0) |
@@ -1035,6 +1313,7 @@ void loop() {
         // Serial.print("ESP-NOW send: ");
         // Serial.println(flags, BIN);
     }
+    loop_profile::endStage(loopProfile, STAGE_ESPNOW);
 
 
 
@@ -0,0 +1,44 @@
+#include "obd_mode01.h"
+
+namespace {
+
+// Data length per PID 0x00..0x64 from J1979. 0 marks PIDs we don't know.
+constexpr uint8_t MODE01_DATA_LENGTH[] = {
+    // 0x00
+    4, 4, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1,
+    // 0x10
+    2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2,
+    // 0x20
+    4, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 1, 1, 1, 1,
+    // 0x30
+    1, 2, 2, 1, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2, 2,
+    // 0x40
+    4, 4, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 4,
+    // 0x50
+    4, 1, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 1,
+    // 0x60
+    4, 1, 1, 2, 5
+};
+
+} // namespace
+
+uint8_t obdMode01DataLength(uint8_t pid) {
+    if (pid >= sizeof(MODE01_DATA_LENGTH)) return 0;
+    return MODE01_DATA_LENGTH[pid];
+}
+
+bool obdMode01Split(const uint8_t* p, uint16_t len,
+                    void (*onPid)(uint8_t pid, const uint8_t* data, uint8_t dataLen, void* ctx),
+                    void* ctx) {
+    if (len < 2 || p[0] != (OBD_MODE01 | 0x40)) return false;
+
+    uint16_t o = 1;
+    while (o < len) {
+        const uint8_t pid = p[o];
+        const uint8_t n = obdMode01DataLength(pid);
+        if (n == 0 || o + 1 + n > len) return false;
+        onPid(pid, &p[o + 1], n, ctx);
+        o += 1 + n;
+    }
+    return true;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Arduino.h>
+
+// SAE J1979 Mode 01 helpers. One Mode 01 request may ask for up to six PIDs;
+// the reply is 41 followed by each PID and its data bytes, so splitting it
+// back up needs the fixed data length of every PID.
+
+constexpr uint8_t OBD_MODE01 = 0x01;
+constexpr uint8_t OBD_MAX_PIDS_PER_REQUEST = 6;
+
+// Data bytes that follow the PID in a reply, or 0 if unknown (don't batch it).
+uint8_t obdMode01DataLength(uint8_t pid);
+
+// Walk a 41 <pid> <data...> <pid> <data...> reply. Calls onPid for each PID
+// with a pointer to its data bytes. Returns false if the reply is malformed
+// or contains a PID of unknown length; PIDs before that point are delivered.
+bool obdMode01Split(const uint8_t* p, uint16_t len,
+                    void (*onPid)(uint8_t pid, const uint8_t* data, uint8_t dataLen, void* ctx),
+                    void* ctx);
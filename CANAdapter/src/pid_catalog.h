@@ -0,0 +1,2660 @@
+// Generated by scripts/gen_pid_catalog.py from the Torque CSV and
+// SavvyCANstuff/prius_v_2016_pid_overlay.csv. Do not edit by hand.
+#pragma once
+
+#include <stdint.h>
+
+#include "fixed_point.h"
+
+// One diagnostic request. Replies come back on requestId + 8 and must echo
+// (service | 0x40, pid). minLen counts the two echo bytes.
+struct PidRequest {
+    uint32_t requestId;
+    uint32_t responseId;
+    uint8_t service;
+    uint8_t pid;
+    uint8_t minLen;
+};
+
+// One decoded value. decode() takes the full reply payload, A is p[2].
+// Linear equations also have decodeRaw(), the integer the value is carried
+// in, with decode(p) == raw * scale + offset; the rest have nullptr.
+struct PidDef {
+    uint8_t request;
+    float (*decode)(const uint8_t* p);
+    const char* shortName;
+    const char* units;
+    int32_t (*decodeRaw)(const uint8_t* p);
+    FixedScaleInfo scale;
+};
+
+enum : uint8_t {
+    PIDREQ_7B0_2103,
+    PIDREQ_7B0_2106,
+    PIDREQ_7B0_2107,
+    PIDREQ_7B0_2147,
+    PIDREQ_7B0_2158,
+    PIDREQ_7B0_21A3,
+    PIDREQ_7B0_21A6,
+    PIDREQ_7B0_21BC,
+    PIDREQ_7B0_21BE,
+    PIDREQ_7C0_2112,
+    PIDREQ_7C0_2113,
+    PIDREQ_7C0_2129,
+    PIDREQ_7C0_2141,
+    PIDREQ_7C0_2168,
+    PIDREQ_7C0_21A7,
+    PIDREQ_7C0_21AC,
+    PIDREQ_7C4_2121,
+    PIDREQ_7C4_2122,
+    PIDREQ_7C4_2124,
+    PIDREQ_7C4_2126,
+    PIDREQ_7C4_2129,
+    PIDREQ_7C4_213C,
+    PIDREQ_7C4_213D,
+    PIDREQ_7C4_2141,
+    PIDREQ_7C4_2143,
+    PIDREQ_7C4_2144,
+    PIDREQ_7C4_2149,
+    PIDREQ_7C4_214A,
+    PIDREQ_7C4_214B,
+    PIDREQ_7C4_214C,
+    PIDREQ_7C4_2153,
+    PIDREQ_7E0_2101,
+    PIDREQ_7E0_213C,
+    PIDREQ_7E0_2149,
+    PIDREQ_7E2_0105,
+    PIDREQ_7E2_015B,
+    PIDREQ_7E2_2101,
+    PIDREQ_7E2_2141,
+    PIDREQ_7E2_2161,
+    PIDREQ_7E2_2162,
+    PIDREQ_7E2_2167,
+    PIDREQ_7E2_2168,
+    PIDREQ_7E2_2170,
+    PIDREQ_7E2_2171,
+    PIDREQ_7E2_2174,
+    PIDREQ_7E2_2175,
+    PIDREQ_7E2_2178,
+    PIDREQ_7E2_2179,
+    PIDREQ_7E2_217C,
+    PIDREQ_7E2_217D,
+    PIDREQ_7E2_2181,
+    PIDREQ_7E2_2187,
+    PIDREQ_7E2_218A,
+    PIDREQ_7E2_218E,
+    PIDREQ_7E2_2192,
+    PIDREQ_7E2_2195,
+    PIDREQ_7E2_2198,
+    PIDREQ_7E2_219B,
+    PIDREQ_7E2_21C1,
+    PIDREQ_7E2_21E1,
+    PID_REQUEST_COUNT
+};
+
+enum : uint16_t {
+    PID_7B0_2103_FR_WS,
+    PID_7B0_2103_FL_WS,
+    PID_7B0_2103_RR_WS,
+    PID_7B0_2103_RL_WS,
+    PID_7B0_2106_YR1,
+    PID_7B0_2106_YR2,
+    PID_7B0_2107_WC_PRES,
+    PID_7B0_2147_LATERAL_G,
+    PID_7B0_2147_FWD_RWD_G,
+    PID_7B0_2147_YR_VAL,
+    PID_7B0_2147_STEERANGLE,
+    PID_7B0_2158_REGENCOOP,
+    PID_7B0_21A3_SLA_CURR,
+    PID_7B0_21A3_SLR_CURR,
+    PID_7B0_21A3_SSC_CURR,
+    PID_7B0_21A3_SCC_CURR,
+    PID_7B0_21A3_SMC_CURR,
+    PID_7B0_21A3_SRC_CURR,
+    PID_7B0_21A6_INSP_MODE,
+    PID_7B0_21BC_HAZ_HIST,
+    PID_7B0_21BE_FRS_OPEN,
+    PID_7B0_21BE_FLS_OPEN,
+    PID_7B0_21BE_RRS_OPEN,
+    PID_7B0_21BE_RLS_OPEN,
+    PID_7B0_21BE_YR_OPEN,
+    PID_7B0_21BE_DECEL_OPEN,
+    PID_7B0_21BE_STEER_OPEN,
+    PID_7B0_21BE_MC_OPEN,
+    PID_7B0_21BE_STROKE_OPEN,
+    PID_7B0_21BE_FRWC_OPEN,
+    PID_7B0_21BE_ACC_OPEN,
+    PID_7B0_21BE_HVC_OPEN,
+    PID_7C0_2112_TAIL_CANCEL,
+    PID_7C0_2113_AUX_B_VOLT,
+    PID_7C0_2129_FUEL_LEVEL,
+    PID_7C0_2141_OIL_CHG_DIST,
+    PID_7C0_2168_RHEOSTAT,
+    PID_7C0_21A7_SBB_QUERY,
+    PID_7C0_21AC_RB_QUERY,
+    PID_7C4_2121_ROOM,
+    PID_7C4_2122_AMBIENT,
+    PID_7C4_2124_SOLAR_D,
+    PID_7C4_2126_COOLANT,
+    PID_7C4_2129_SET_T_D,
+    PID_7C4_213C_BLOWER_LEVEL,
+    PID_7C4_213D_ADJAMBIENT,
+    PID_7C4_2141_A_M_STP_D,
+    PID_7C4_2141_A_M_SAP_D,
+    PID_7C4_2143_A_O_SP_D,
+    PID_7C4_2143_A_O_SAP_D,
+    PID_7C4_2144_A_I_DTP,
+    PID_7C4_2144_A_I_DAP,
+    PID_7C4_2149_COMP_SPD,
+    PID_7C4_214A_COMP_T_SPD,
+    PID_7C4_214B_EVAP_FIN,
+    PID_7C4_214C_EVAP_TGT,
+    PID_7C4_2153_REG_PRES,
+    PID_7E0_2101_CAL_D_LOAD,
+    PID_7E0_2101_VEH_LOAD,
+    PID_7E0_2101_MAF,
+    PID_7E0_2101_MAP,
+    PID_7E0_2101_IAT,
+    PID_7E0_2101_ATMPRES,
+    PID_7E0_2101_COOLANT,
+    PID_7E0_2101_RPM,
+    PID_7E0_2101_MPH,
+    PID_7E0_2101_IGN_TIME,
+    PID_7E0_213C_INJ_VOL,
+    PID_7E0_213C_INJ_DUR,
+    PID_7E0_2149_ACTENGTORQ,
+    PID_7E2_015B_SOC,
+    PID_7E2_2101_CAL_D_LOAD,
+    PID_7E2_2101_MAP,
+    PID_7E2_2101_IAT,
+    PID_7E2_2101_AMBIENT,
+    PID_7E2_2101_ATMPRES,
+    PID_7E2_2101_COOLANT,
+    PID_7E2_2101_RPM,
+    PID_7E2_2101_MPH,
+    PID_7E2_2101_IGN_TIME,
+    PID_7E2_2101_THROTTLE,
+    PID_7E2_2101_AP1,
+    PID_7E2_2101_AP2,
+    PID_7E2_2101_DTC_WARM,
+    PID_7E2_2101_DTC_DIST,
+    PID_7E2_2101_DTC_TIME,
+    PID_7E2_2101_B,
+    PID_7E2_2101_SOC_ALL,
+    PID_7E2_2141_SHIFT_M,
+    PID_7E2_2141_SHIFT_S,
+    PID_7E2_2141_SHIFT_SEL_M,
+    PID_7E2_2141_SHIFT_SEL_S,
+    PID_7E2_2141_AUX_B_T,
+    PID_7E2_2141_RPM_SENSOR,
+    PID_7E2_2141_P_POS_VOLT,
+    PID_7E2_2161_MG1T,
+    PID_7E2_2161_MG1T_IGN,
+    PID_7E2_2161_MG1T_MAX,
+    PID_7E2_2161_MG1_RPM,
+    PID_7E2_2162_MG2T,
+    PID_7E2_2162_MG2T_IGN,
+    PID_7E2_2162_MG2T_MAX,
+    PID_7E2_2162_MG2_RPM,
+    PID_7E2_2167_MG1_TORQ,
+    PID_7E2_2167_MG1_E_TORQ,
+    PID_7E2_2167_MG1_MODE,
+    PID_7E2_2168_MG2_TORQ,
+    PID_7E2_2168_MG2_E_TORQ,
+    PID_7E2_2168_MG2_MODE,
+    PID_7E2_2170_INV1T,
+    PID_7E2_2170_INV1T_IGN,
+    PID_7E2_2170_INV1T_MAX,
+    PID_7E2_2170_MG1_GATE,
+    PID_7E2_2171_INV2T,
+    PID_7E2_2171_INV2T_IGN,
+    PID_7E2_2171_INV2T_MAX,
+    PID_7E2_2171_MG2_GATE,
+    PID_7E2_2174_BC_U,
+    PID_7E2_2174_BC_L,
+    PID_7E2_2174_BC_IGN,
+    PID_7E2_2174_BC_MAX,
+    PID_7E2_2174_CNV_GATE,
+    PID_7E2_2174_O_V_I_P_CNV,
+    PID_7E2_2174_O_V_I_P_INV,
+    PID_7E2_2174_VLB,
+    PID_7E2_2174_VHB,
+    PID_7E2_2175_P_DCDC,
+    PID_7E2_2175_A_C_GATE,
+    PID_7E2_2175_WP_RUN,
+    PID_7E2_2175_INV_WP,
+    PID_7E2_2175_INV_COOLANT,
+    PID_7E2_2178_INV1_S_D,
+    PID_7E2_2178_INV1_FAIL,
+    PID_7E2_2178_INV2_S_D,
+    PID_7E2_2178_INV2_FAIL,
+    PID_7E2_2179_DCTPD,
+    PID_7E2_2179_WP_DUTY,
+    PID_7E2_2179_CNV_S_D,
+    PID_7E2_2179_CNV_FAIL,
+    PID_7E2_217C_MG1_CF,
+    PID_7E2_217C_MG2_CF,
+    PID_7E2_217D_B_RATIO,
+    PID_7E2_217D_CNV_CF,
+    PID_7E2_217D_A_C_PWR,
+    PID_7E2_2181_V01,
+    PID_7E2_2181_V02,
+    PID_7E2_2181_V03,
+    PID_7E2_2181_V04,
+    PID_7E2_2181_V05,
+    PID_7E2_2181_V06,
+    PID_7E2_2181_V07,
+    PID_7E2_2181_V08,
+    PID_7E2_2181_V09,
+    PID_7E2_2181_V10,
+    PID_7E2_2181_V11,
+    PID_7E2_2181_V12,
+    PID_7E2_2181_V13,
+    PID_7E2_2181_V14,
+    PID_7E2_2181_AUX_BTY,
+    PID_7E2_2181_VB,
+    PID_7E2_2181_VMF,
+    PID_7E2_2187_TB_INTAKE,
+    PID_7E2_2187_TB_1,
+    PID_7E2_2187_TB_2,
+    PID_7E2_2187_TB_3,
+    PID_7E2_218A_IB,
+    PID_7E2_218E_C_FAN_0,
+    PID_7E2_218E_C_FAN_RLY,
+    PID_7E2_2192_VMIN,
+    PID_7E2_2192_BLK_MIN,
+    PID_7E2_2192_VMAX,
+    PID_7E2_2192_BLK_MAX,
+    PID_7E2_2192_VMAX_VMIN,
+    PID_7E2_2192_BTY_BLK,
+    PID_7E2_2192_LOW_COUNT,
+    PID_7E2_2192_DCI_COUNT,
+    PID_7E2_2192_HIGH_COUNT,
+    PID_7E2_2192_HOT_COUNT,
+    PID_7E2_2195_R01,
+    PID_7E2_2195_R02,
+    PID_7E2_2195_R03,
+    PID_7E2_2195_R04,
+    PID_7E2_2195_R05,
+    PID_7E2_2195_R06,
+    PID_7E2_2195_R07,
+    PID_7E2_2195_R08,
+    PID_7E2_2195_R09,
+    PID_7E2_2195_R10,
+    PID_7E2_2195_R11,
+    PID_7E2_2195_R12,
+    PID_7E2_2195_R13,
+    PID_7E2_2195_R14,
+    PID_7E2_2198_BTY_CURR,
+    PID_7E2_2198_DISCHG_CTRL,
+    PID_7E2_2198_CHG_CTRL,
+    PID_7E2_2198_DELTA_SOC,
+    PID_7E2_2198_SOC_IG_ON,
+    PID_7E2_2198_SOC_MAX,
+    PID_7E2_2198_SOC_MIN,
+    PID_7E2_219B_ECU_MODE,
+    PID_7E2_219B_FAN_MODE,
+    PID_7E2_219B_SBRS,
+    PID_7E2_219B_S_C_WAVE_HI,
+    PID_7E2_21C1_DEST,
+    PID_7E2_21E1_CURR_CODE,
+    PID_7E2_21E1_HIST_CODE,
+    PID_7E2_0105_ECT,
+    PID_7E2_2187_TB_INTAKE_C,
+    PID_7E2_2187_TB_1_C,
+    PID_7E2_2187_TB_2_C,
+    PID_7E2_2187_TB_3_C,
+    PID_CATALOG_COUNT
+};
+
+namespace pid_decode {
+// FR Wheel Speed: A * 32 / 25 * 15625 / 25146 [mph]
+inline float pid_7b0_2103_fr_ws(const uint8_t* p) { return (float)(p[2] * 32.0f / 25.0f * 15625.0f / 25146.0f); }
+// FL Wheel Speed: B * 32 / 25 * 15625 / 25146 [mph]
+inline float pid_7b0_2103_fl_ws(const uint8_t* p) { return (float)(p[3] * 32.0f / 25.0f * 15625.0f / 25146.0f); }
+// RR Wheel Speed: C * 32 / 25 * 15625 / 25146 [mph]
+inline float pid_7b0_2103_rr_ws(const uint8_t* p) { return (float)(p[4] * 32.0f / 25.0f * 15625.0f / 25146.0f); }
+// RL Wheel Speed: D * 32 / 25 * 15625 / 25146 [mph]
+inline float pid_7b0_2103_rl_ws(const uint8_t* p) { return (float)(p[5] * 32.0f / 25.0f * 15625.0f / 25146.0f); }
+// Yaw Rate Sensor: A - 128 [degrees/s]
+inline float pid_7b0_2106_yr1(const uint8_t* p) { return (float)(p[2] - 128.0f); }
+// Yaw Rate Sensor2: B - 128 [degrees/s]
+inline float pid_7b0_2106_yr2(const uint8_t* p) { return (float)(p[3] - 128.0f); }
+// Wheel Cylinder Pressure Sensor: A / 51 [V]
+inline float pid_7b0_2107_wc_pres(const uint8_t* p) { return (float)(p[2] / 51.0f); }
+// Lateral G: A * 50.02 / 255 - 25.11 [m/s2]
+inline float pid_7b0_2147_lateral_g(const uint8_t* p) { return (float)(p[2] * 50.02f / 255.0f - 25.11f); }
+// Forward and Rearward G: B * 50.02 / 255 - 25.11 [m/s2]
+inline float pid_7b0_2147_fwd_rwd_g(const uint8_t* p) { return (float)(p[3] * 50.02f / 255.0f - 25.11f); }
+// Yaw Rate Value: C - 128 [degrees/s]
+inline float pid_7b0_2147_yr_val(const uint8_t* p) { return (float)(p[4] - 128.0f); }
+// Steering Angle Value: (D * 256 + E) / 10 - 3276.8 [degrees]
+inline float pid_7b0_2147_steerangle(const uint8_t* p) { return (float)((p[5] * 256.0f + p[6]) / 10.0f - 3276.8f); }
+// Regen Cooperation: {A:7} [Off/On]
+inline float pid_7b0_2158_regencoop(const uint8_t* p) { return (float)(((p[2] >> 7) & 1)); }
+// SLA Solenoid Current: A * 3 / 255 [A]
+inline float pid_7b0_21a3_sla_curr(const uint8_t* p) { return (float)(p[2] * 3.0f / 255.0f); }
+// SLR Solenoid Current: B * 3 / 255 [A]
+inline float pid_7b0_21a3_slr_curr(const uint8_t* p) { return (float)(p[3] * 3.0f / 255.0f); }
+// SSC Solenoid Current: C * 3 / 255 [A]
+inline float pid_7b0_21a3_ssc_curr(const uint8_t* p) { return (float)(p[4] * 3.0f / 255.0f); }
+// SCC Solenoid Current: D * 3 / 255 [A]
+inline float pid_7b0_21a3_scc_curr(const uint8_t* p) { return (float)(p[5] * 3.0f / 255.0f); }
+// SMC Solenoid Current: E * 3 / 255 [A]
+inline float pid_7b0_21a3_smc_curr(const uint8_t* p) { return (float)(p[6] * 3.0f / 255.0f); }
+// SRC Solenoid Current: F * 3 / 255 [A]
+inline float pid_7b0_21a3_src_curr(const uint8_t* p) { return (float)(p[7] * 3.0f / 255.0f); }
+// Inspection Mode (Other=Off,Inspect=On): {A:7} [Off/On]
+inline float pid_7b0_21a6_insp_mode(const uint8_t* p) { return (float)(((p[2] >> 7) & 1)); }
+// Hazard Switch History (Incomplete=Off,Complete=On): {A:5} [Off/On]
+inline float pid_7b0_21bc_haz_hist(const uint8_t* p) { return (float)(((p[2] >> 5) & 1)); }
+// FR Speed Open (Normal=0,Error=1): {A:7} [Off/On]
+inline float pid_7b0_21be_frs_open(const uint8_t* p) { return (float)(((p[2] >> 7) & 1)); }
+// FL Speed Open (Normal=0,Error=1): {A:6} [Off/On]
+inline float pid_7b0_21be_fls_open(const uint8_t* p) { return (float)(((p[2] >> 6) & 1)); }
+// RR Speed Open (Normal=0,Error=1): {A:5} [Off/On]
+inline float pid_7b0_21be_rrs_open(const uint8_t* p) { return (float)(((p[2] >> 5) & 1)); }
+// RL Speed Open (Normal=0,Error=1): {A:4} [Off/On]
+inline float pid_7b0_21be_rls_open(const uint8_t* p) { return (float)(((p[2] >> 4) & 1)); }
+// Yaw Rate Open (Normal=0,Error=1): {A:2} [Off/On]
+inline float pid_7b0_21be_yr_open(const uint8_t* p) { return (float)(((p[2] >> 2) & 1)); }
+// Deceleration Open (Normal=0,Error=1): {A:1} [Off/On]
+inline float pid_7b0_21be_decel_open(const uint8_t* p) { return (float)(((p[2] >> 1) & 1)); }
+// Steering Open (Normal=0,Error=1): {A:0} [Off/On]
+inline float pid_7b0_21be_steer_open(const uint8_t* p) { return (float)(((p[2] >> 0) & 1)); }
+// Master Cylinder Open (Normal=0,Error=1): {B:7} [Off/On]
+inline float pid_7b0_21be_mc_open(const uint8_t* p) { return (float)(((p[3] >> 7) & 1)); }
+// Stroke Open (Normal=0,Error=1): {B:5} [Off/On]
+inline float pid_7b0_21be_stroke_open(const uint8_t* p) { return (float)(((p[3] >> 5) & 1)); }
+// FR Wheel Cylinder Open (Normal=0,Error=1): {B:3} [Off/On]
+inline float pid_7b0_21be_frwc_open(const uint8_t* p) { return (float)(((p[3] >> 3) & 1)); }
+// Accumulator Open (Normal=0,Error=1): {C:7} [Off/On]
+inline float pid_7b0_21be_acc_open(const uint8_t* p) { return (float)(((p[4] >> 7) & 1)); }
+// HV Communication Open (Normal=0,Error=1): {C:6} [Off/On]
+inline float pid_7b0_21be_hvc_open(const uint8_t* p) { return (float)(((p[4] >> 6) & 1)); }
+// Tail Cancel SW: {A:5} [Off/On]
+inline float pid_7c0_2112_tail_cancel(const uint8_t* p) { return (float)(((p[2] >> 5) & 1)); }
+// +B Voltage Value: A / 10 [V]
+inline float pid_7c0_2113_aux_b_volt(const uint8_t* p) { return (float)(p[2] / 10.0f); }
+// Fuel Input: A * 500 / 3785 [US Gallons]
+inline float pid_7c0_2129_fuel_level(const uint8_t* p) { return (float)(p[2] * 500.0f / 3785.0f); }
+// Distance Since Oil Change for U.S.A. (reset): A * 100 [mile]
+inline float pid_7c0_2141_oil_chg_dist(const uint8_t* p) { return (float)(p[2] * 100.0f); }
+// Rheostat value (dark=0,bright=255): A [Number]
+inline float pid_7c0_2168_rheostat(const uint8_t* p) { return (float)(p[2]); }
+// Seat Belt Beep Query (Dis A=0,Ena R=32,Ena P=64,Dis D=96,Ena D=128,Dis P=160,192=Dis R,Ena A=160): A [Number]
+inline float pid_7c0_21a7_sbb_query(const uint8_t* p) { return (float)(p[2]); }
+// Reverse Beep Query (Ena=0,Dis=64): A [Number]
+inline float pid_7c0_21ac_rb_query(const uint8_t* p) { return (float)(p[2]); }
+// Room Temp Sensor: A * 9 / 20 + 20.3 [F]
+inline float pid_7c4_2121_room(const uint8_t* p) { return (float)(p[2] * 9.0f / 20.0f + 20.3f); }
+// Ambient Temp Sensor: A * 160.65 / 255 - 9.94 [F]
+inline float pid_7c4_2122_ambient(const uint8_t* p) { return (float)(p[2] * 160.65f / 255.0f - 9.94f); }
+// Solar Sensor (D side): A [Number]
+inline float pid_7c4_2124_solar_d(const uint8_t* p) { return (float)(p[2]); }
+// Engine Coolant Temp: A * 160.65 / 255 + 34.34 [F]
+inline float pid_7c4_2126_coolant(const uint8_t* p) { return (float)(p[2] * 160.65f / 255.0f + 34.34f); }
+// Set Temperature (D side): A * 27 / 255 + 63.5 [F]
+inline float pid_7c4_2129_set_t_d(const uint8_t* p) { return (float)(p[2] * 27.0f / 255.0f + 63.5f); }
+// Blower Motor Speed Level: A * 31 / 255 [Number]
+inline float pid_7c4_213c_blower_level(const uint8_t* p) { return (float)(p[2] * 31.0f / 255.0f); }
+// Adjusted Ambient Temp: A * 146.88 / 255 - 23.44 [F]
+inline float pid_7c4_213d_adjambient(const uint8_t* p) { return (float)(p[2] * 146.88f / 255.0f - 23.44f); }
+// Air Mix Servo Targ Pulse (D): A [Number]
+inline float pid_7c4_2141_a_m_stp_d(const uint8_t* p) { return (float)(p[2]); }
+// Air Mix Servo Actual Pulse (D): B [Number]
+inline float pid_7c4_2141_a_m_sap_d(const uint8_t* p) { return (float)(p[3]); }
+// Air Outlet Servo Pulse (D): A [Number]
+inline float pid_7c4_2143_a_o_sp_d(const uint8_t* p) { return (float)(p[2]); }
+// Air Outlet Servo Actu Pulse (D): B [Number]
+inline float pid_7c4_2143_a_o_sap_d(const uint8_t* p) { return (float)(p[3]); }
+// Air Inlet Damper Targ Pulse: A [Number]
+inline float pid_7c4_2144_a_i_dtp(const uint8_t* p) { return (float)(p[2]); }
+// Air Inlet Damper Actual Pulse: B [Number]
+inline float pid_7c4_2144_a_i_dap(const uint8_t* p) { return (float)(p[3]); }
+// Compressor Speed: A * 256 + B [RPM]
+inline float pid_7c4_2149_comp_spd(const uint8_t* p) { return (float)(p[2] * 256.0f + p[3]); }
+// Compressor Target Speed: A * 256 + B [RPM]
+inline float pid_7c4_214a_comp_t_spd(const uint8_t* p) { return (float)(p[2] * 256.0f + p[3]); }
+// Evaporator Fin Thermistor: A * 160.65 / 255 - 21.46 [F]
+inline float pid_7c4_214b_evap_fin(const uint8_t* p) { return (float)(p[2] * 160.65f / 255.0f - 21.46f); }
+// Evaporator Target Temp: (A * 256 + B) * 9 / 500 - 557.82 [F]
+inline float pid_7c4_214c_evap_tgt(const uint8_t* p) { return (float)((p[2] * 256.0f + p[3]) * 9.0f / 500.0f - 557.82f); }
+// Regulator Pressure Sensor: (A * 3.75105 / 255 - 0.45668) * 145.0377438972831 [PSIG]
+inline float pid_7c4_2153_reg_pres(const uint8_t* p) { return (float)((p[2] * 3.75105f / 255.0f - 0.45668f) * 145.0377438972831f); }
+// Calculated Load: A * 20 / 51 [%]
+inline float pid_7e0_2101_cal_d_load(const uint8_t* p) { return (float)(p[2] * 20.0f / 51.0f); }
+// Vehicle Load: (B * 256 + C) * 25700 / 65535 [%]
+inline float pid_7e0_2101_veh_load(const uint8_t* p) { return (float)((p[3] * 256.0f + p[4]) * 25700.0f / 65535.0f); }
+// Mass Air Flow: (D * 256 + E) / 100 [gm/sec]
+inline float pid_7e0_2101_maf(const uint8_t* p) { return (float)((p[5] * 256.0f + p[6]) / 100.0f); }
+// Manifold Air Pressure: F * 1913 / 255 [mmHg]
+inline float pid_7e0_2101_map(const uint8_t* p) { return (float)(p[7] * 1913.0f / 255.0f); }
+// Intake air temperature: G * 9 / 5 - 40 [F]
+inline float pid_7e0_2101_iat(const uint8_t* p) { return (float)(p[8] * 9.0f / 5.0f - 40.0f); }
+// Atmosphere pressure: H * 1913 / 255 [mmHg]
+inline float pid_7e0_2101_atmpres(const uint8_t* p) { return (float)(p[9] * 1913.0f / 255.0f); }
+// Coolant temperature: I * 9 / 5 - 40 [F]
+inline float pid_7e0_2101_coolant(const uint8_t* p) { return (float)(p[10] * 9.0f / 5.0f - 40.0f); }
+// Engine Speed: (J * 256 + K) / 4 [RPM]
+inline float pid_7e0_2101_rpm(const uint8_t* p) { return (float)((p[11] * 256.0f + p[12]) / 4.0f); }
+// Vehicle Speed: L * 15625 / 25146 [mph]
+inline float pid_7e0_2101_mph(const uint8_t* p) { return (float)(p[13] * 15625.0f / 25146.0f); }
+// Engine Run Time: M * 256 + N [sec.]
+inline float pid_7e0_2101_ign_time(const uint8_t* p) { return (float)(p[14] * 256.0f + p[15]); }
+// Injection volume (Cylinder 1) for 10 times: (A * 256 + B) * 0.0692173044706726 / 65535 [fl oz]
+inline float pid_7e0_213c_inj_vol(const uint8_t* p) { return (float)((p[2] * 256.0f + p[3]) * 0.0692173044706726f / 65535.0f); }
+// Injection duration for cylinder 1: C * 256 + D [micro sec.]
+inline float pid_7e0_213c_inj_dur(const uint8_t* p) { return (float)(p[4] * 256.0f + p[5]); }
+// Actual Engine Torque: ((D * 256 + E) - 32768) * 0.7375621 [ft�lb]
+inline float pid_7e0_2149_actengtorq(const uint8_t* p) { return (float)(((p[5] * 256.0f + p[6]) - 32768.0f) * 0.7375621f); }
+// State of Charge: A * 20 / 51 [%]
+inline float pid_7e2_015b_soc(const uint8_t* p) { return (float)(p[2] * 20.0f / 51.0f); }
+// Calculated Load: A * 20 / 51 [%]
+inline float pid_7e2_2101_cal_d_load(const uint8_t* p) { return (float)(p[2] * 20.0f / 51.0f); }
+// Manifold Air Pressure: B * 1913 / 255 [mmHg]
+inline float pid_7e2_2101_map(const uint8_t* p) { return (float)(p[3] * 1913.0f / 255.0f); }
+// Intake air temperature: C * 9 / 5 - 40 [F]
+inline float pid_7e2_2101_iat(const uint8_t* p) { return (float)(p[4] * 9.0f / 5.0f - 40.0f); }
+// Ambient Temperature: D * 9 / 5 - 40 [F]
+inline float pid_7e2_2101_ambient(const uint8_t* p) { return (float)(p[5] * 9.0f / 5.0f - 40.0f); }
+// Atmosphere pressure: E * 1913 / 255 [mmHg]
+inline float pid_7e2_2101_atmpres(const uint8_t* p) { return (float)(p[6] * 1913.0f / 255.0f); }
+// Engine Coolant temperature: F * 9 / 5 - 40 [F]
+inline float pid_7e2_2101_coolant(const uint8_t* p) { return (float)(p[7] * 9.0f / 5.0f - 40.0f); }
+// Engine Speed: (G * 256 + H) / 4 [RPM]
+inline float pid_7e2_2101_rpm(const uint8_t* p) { return (float)((p[8] * 256.0f + p[9]) / 4.0f); }
+// Vehicle Speed: I * 15625 / 25146 [mph]
+inline float pid_7e2_2101_mph(const uint8_t* p) { return (float)(p[10] * 15625.0f / 25146.0f); }
+// Engine Run Time: J * 256 + K [sec.]
+inline float pid_7e2_2101_ign_time(const uint8_t* p) { return (float)(p[11] * 256.0f + p[12]); }
+// Throttle Position: L * 20 / 51 [%]
+inline float pid_7e2_2101_throttle(const uint8_t* p) { return (float)(p[13] * 20.0f / 51.0f); }
+// Accel Pedal Pos #1: M * 20 / 51 [%]
+inline float pid_7e2_2101_ap1(const uint8_t* p) { return (float)(p[14] * 20.0f / 51.0f); }
+// Accel Pedal Pos #2: N * 20 / 51 [%]
+inline float pid_7e2_2101_ap2(const uint8_t* p) { return (float)(p[15] * 20.0f / 51.0f); }
+// DTC Clear Warm Up: O [Number]
+inline float pid_7e2_2101_dtc_warm(const uint8_t* p) { return (float)(p[16]); }
+// DTC Clear Run Distance: (P * 256 + Q) * 15625 / 25146 [mile]
+inline float pid_7e2_2101_dtc_dist(const uint8_t* p) { return (float)((p[17] * 256.0f + p[18]) * 15625.0f / 25146.0f); }
+// DTC Clear Min: R * 256 + S [minutes]
+inline float pid_7e2_2101_dtc_time(const uint8_t* p) { return (float)(p[19] * 256.0f + p[20]); }
+// +B: (T * 256 + U) / 1000 [V]
+inline float pid_7e2_2101_b(const uint8_t* p) { return (float)((p[21] * 256.0f + p[22]) / 1000.0f); }
+// State of Charge (All Bat): V * 20 / 51 [%]
+inline float pid_7e2_2101_soc_all(const uint8_t* p) { return (float)(p[23] * 20.0f / 51.0f); }
+// Shift Sensor Main: A * 4.98 / 255 [V]
+inline float pid_7e2_2141_shift_m(const uint8_t* p) { return (float)(p[2] * 4.98f / 255.0f); }
+// Shift Sensor Sub: B * 4.98 / 255 [V]
+inline float pid_7e2_2141_shift_s(const uint8_t* p) { return (float)(p[3] * 4.98f / 255.0f); }
+// Shift Sensor Select Main: C * 4.98 / 255 [V]
+inline float pid_7e2_2141_shift_sel_m(const uint8_t* p) { return (float)(p[4] * 4.98f / 255.0f); }
+// Shift Sensor Select Sub: D * 4.98 / 255 [V]
+inline float pid_7e2_2141_shift_sel_s(const uint8_t* p) { return (float)(p[5] * 4.98f / 255.0f); }
+// Auxiliary Battery Temperature: E * 9 / 5 - 40 [F]
+inline float pid_7e2_2141_aux_b_t(const uint8_t* p) { return (float)(p[6] * 9.0f / 5.0f - 40.0f); }
+// Engine Rev (Sensor): (F * 256 + G) / 4 [RPM]
+inline float pid_7e2_2141_rpm_sensor(const uint8_t* p) { return (float)((p[7] * 256.0f + p[8]) / 4.0f); }
+// P Pos SW Terminal Vol: H * 79.9987793 / 255 [V]
+inline float pid_7e2_2141_p_pos_volt(const uint8_t* p) { return (float)(p[9] * 79.9987793f / 255.0f); }
+// MG1 temperature: A * 9 / 5 - 40 [F]
+inline float pid_7e2_2161_mg1t(const uint8_t* p) { return (float)(p[2] * 9.0f / 5.0f - 40.0f); }
+// MG1 temperature after IG-ON: B * 9 / 5 - 40 [F]
+inline float pid_7e2_2161_mg1t_ign(const uint8_t* p) { return (float)(p[3] * 9.0f / 5.0f - 40.0f); }
+// MG1 temperature Max: C * 9 / 5 - 40 [F]
+inline float pid_7e2_2161_mg1t_max(const uint8_t* p) { return (float)(p[4] * 9.0f / 5.0f - 40.0f); }
+// MG1 revolution: D * 256 + E - 32768 [RPM]
+inline float pid_7e2_2161_mg1_rpm(const uint8_t* p) { return (float)(p[5] * 256.0f + p[6] - 32768.0f); }
+// MG2 temperature: A * 9 / 5 - 40 [F]
+inline float pid_7e2_2162_mg2t(const uint8_t* p) { return (float)(p[2] * 9.0f / 5.0f - 40.0f); }
+// MG2 temperature after IG-ON: B * 9 / 5 - 40 [F]
+inline float pid_7e2_2162_mg2t_ign(const uint8_t* p) { return (float)(p[3] * 9.0f / 5.0f - 40.0f); }
+// MG2 temperature Max: C * 9 / 5 - 40 [F]
+inline float pid_7e2_2162_mg2t_max(const uint8_t* p) { return (float)(p[4] * 9.0f / 5.0f - 40.0f); }
+// MG2 revolution: D * 256 + E - 32768 [RPM]
+inline float pid_7e2_2162_mg2_rpm(const uint8_t* p) { return (float)(p[5] * 256.0f + p[6] - 32768.0f); }
+// MG1 torque: ((A * 256 + B) / 8 - 4096) * 0.7375621 [ft�lb]
+inline float pid_7e2_2167_mg1_torq(const uint8_t* p) { return (float)(((p[2] * 256.0f + p[3]) / 8.0f - 4096.0f) * 0.7375621f); }
+// MG1 torque execution value: ((C * 256 + D) / 8 - 4096) * 0.7375621 [ft�lb]
+inline float pid_7e2_2167_mg1_e_torq(const uint8_t* p) { return (float)(((p[4] * 256.0f + p[5]) / 8.0f - 4096.0f) * 0.7375621f); }
+// MG1 Control Mode (PWM=0,Variable PWM=1,Rectangular wave=2): E [Number]
+inline float pid_7e2_2167_mg1_mode(const uint8_t* p) { return (float)(p[6]); }
+// MG2 torque: ((A * 256 + B) / 8 - 4096) * 0.7375621 [ft�lb]
+inline float pid_7e2_2168_mg2_torq(const uint8_t* p) { return (float)(((p[2] * 256.0f + p[3]) / 8.0f - 4096.0f) * 0.7375621f); }
+// MG2 torque execution value: ((C * 256 + D) / 8 - 4096) * 0.7375621 [ft�lb]
+inline float pid_7e2_2168_mg2_e_torq(const uint8_t* p) { return (float)(((p[4] * 256.0f + p[5]) / 8.0f - 4096.0f) * 0.7375621f); }
+// MG2 Control Mode (PWM=0,Variable PWM=1,Rectangular wave=2): E [Number]
+inline float pid_7e2_2168_mg2_mode(const uint8_t* p) { return (float)(p[6]); }
+// Inverter MG1 Temp: A * 9 / 5 - 40 [F]
+inline float pid_7e2_2170_inv1t(const uint8_t* p) { return (float)(p[2] * 9.0f / 5.0f - 40.0f); }
+// Inverter MG1 Temp after IG-ON: B * 9 / 5 - 40 [F]
+inline float pid_7e2_2170_inv1t_ign(const uint8_t* p) { return (float)(p[3] * 9.0f / 5.0f - 40.0f); }
+// Inverter MG1 Temp Max: C * 9 / 5 - 40 [F]
+inline float pid_7e2_2170_inv1t_max(const uint8_t* p) { return (float)(p[4] * 9.0f / 5.0f - 40.0f); }
+// MG1 Gate Status: {D:7} [Off/On]
+inline float pid_7e2_2170_mg1_gate(const uint8_t* p) { return (float)(((p[5] >> 7) & 1)); }
+// Inverter MG2 Temp: A * 9 / 5 - 40 [F]
+inline float pid_7e2_2171_inv2t(const uint8_t* p) { return (float)(p[2] * 9.0f / 5.0f - 40.0f); }
+// Inverter MG2 Temp after IG-ON: B * 9 / 5 - 40 [F]
+inline float pid_7e2_2171_inv2t_ign(const uint8_t* p) { return (float)(p[3] * 9.0f / 5.0f - 40.0f); }
+// Inverter MG2 Temp Max: C * 9 / 5 - 40 [F]
+inline float pid_7e2_2171_inv2t_max(const uint8_t* p) { return (float)(p[4] * 9.0f / 5.0f - 40.0f); }
+// MG2 Gate Status: {D:7} [Off/On]
+inline float pid_7e2_2171_mg2_gate(const uint8_t* p) { return (float)(((p[5] >> 7) & 1)); }
+// Boost converter temperature (upper): A * 9 / 5 - 40 [F]
+inline float pid_7e2_2174_bc_u(const uint8_t* p) { return (float)(p[2] * 9.0f / 5.0f - 40.0f); }
+// Boost converter temperature (lower): B * 9 / 5 - 40 [F]
+inline float pid_7e2_2174_bc_l(const uint8_t* p) { return (float)(p[3] * 9.0f / 5.0f - 40.0f); }
+// Boost converter temperature after IG-ON: C * 9 / 5 - 40 [F]
+inline float pid_7e2_2174_bc_ign(const uint8_t* p) { return (float)(p[4] * 9.0f / 5.0f - 40.0f); }
+// Boost converter temperature Max: D * 9 / 5 - 40 [F]
+inline float pid_7e2_2174_bc_max(const uint8_t* p) { return (float)(p[5] * 9.0f / 5.0f - 40.0f); }
+// Converter Gate Status: {E:7} [Off/On]
+inline float pid_7e2_2174_cnv_gate(const uint8_t* p) { return (float)(((p[6] >> 7) & 1)); }
+// Overvoltage Input to Converter: {E:6} [Off/On]
+inline float pid_7e2_2174_o_v_i_p_cnv(const uint8_t* p) { return (float)(((p[6] >> 6) & 1)); }
+// Overvoltage Input to Inverter: {E:5} [Off/On]
+inline float pid_7e2_2174_o_v_i_p_inv(const uint8_t* p) { return (float)(((p[6] >> 5) & 1)); }
+// VL-Voltage before Boosting: (F * 256 + G) / 2 [V]
+inline float pid_7e2_2174_vlb(const uint8_t* p) { return (float)((p[7] * 256.0f + p[8]) / 2.0f); }
+// VH-Voltage after Boosting: (H * 256 + I) / 2 [V]
+inline float pid_7e2_2174_vhb(const uint8_t* p) { return (float)((p[9] * 256.0f + p[10]) / 2.0f); }
+// Prohibit DC/DC converter signal: {A:6} [Off/On]
+inline float pid_7e2_2175_p_dcdc(const uint8_t* p) { return (float)(((p[2] >> 6) & 1)); }
+// Aircon Gate Status: {A:5} [Off/On]
+inline float pid_7e2_2175_a_c_gate(const uint8_t* p) { return (float)(((p[2] >> 5) & 1)); }
+// Water Pump Running: {A:4} [Off/On]
+inline float pid_7e2_2175_wp_run(const uint8_t* p) { return (float)(((p[2] >> 4) & 1)); }
+// Inverter Water Pump Revolution: B * 256 + C [RPM]
+inline float pid_7e2_2175_inv_wp(const uint8_t* p) { return (float)(p[3] * 256.0f + p[4]); }
+// Inverter Coolant Temp: D * 9 / 5 - 40 [F]
+inline float pid_7e2_2175_inv_coolant(const uint8_t* p) { return (float)(p[5] * 9.0f / 5.0f - 40.0f); }
+// MG1 Inverter Shutdown: {A:7} [Off/On]
+inline float pid_7e2_2178_inv1_s_d(const uint8_t* p) { return (float)(((p[2] >> 7) & 1)); }
+// MG1 Inverter Fail: {A:6} [Off/On]
+inline float pid_7e2_2178_inv1_fail(const uint8_t* p) { return (float)(((p[2] >> 6) & 1)); }
+// MG2 Inverter Shutdown: {B:7} [Off/On]
+inline float pid_7e2_2178_inv2_s_d(const uint8_t* p) { return (float)(((p[3] >> 7) & 1)); }
+// MG2 Inverter Fail: {B:6} [Off/On]
+inline float pid_7e2_2178_inv2_fail(const uint8_t* p) { return (float)(((p[3] >> 6) & 1)); }
+// DCDC Cnv Target Pulse Duty: (A * 256 + B) * 399.9 / 65535 [%]
+inline float pid_7e2_2179_dctpd(const uint8_t* p) { return (float)((p[2] * 256.0f + p[3]) * 399.9f / 65535.0f); }
+// Water Pump Run Control Duty: C * 6.25 [%]
+inline float pid_7e2_2179_wp_duty(const uint8_t* p) { return (float)(p[4] * 6.25f); }
+// Converter Shutdown: {D:7} [Off/On]
+inline float pid_7e2_2179_cnv_s_d(const uint8_t* p) { return (float)(((p[5] >> 7) & 1)); }
+// Converter Fail: {D:6} [Off/On]
+inline float pid_7e2_2179_cnv_fail(const uint8_t* p) { return (float)(((p[5] >> 6) & 1)); }
+// MG1 Carrier Frequency: A / 20 [kHz]
+inline float pid_7e2_217c_mg1_cf(const uint8_t* p) { return (float)(p[2] / 20.0f); }
+// MG2 Carrier Frequency: B / 20 [kHz]
+inline float pid_7e2_217c_mg2_cf(const uint8_t* p) { return (float)(p[3] / 20.0f); }
+// Boost Ratio: A / 2 [%]
+inline float pid_7e2_217d_b_ratio(const uint8_t* p) { return (float)(p[2] / 2.0f); }
+// Converter Carrier Frequency (9.55kHz=0,9.13kHz=1,8.71kHz=2,8.29kHz=3,7.87kHz=4,7.45kHz=5,4.8kHz=6): B [Number]
+inline float pid_7e2_217d_cnv_cf(const uint8_t* p) { return (float)(p[3]); }
+// A/C consumption power: C * 50 * 0.001341022089595 [HP]
+inline float pid_7e2_217d_a_c_pwr(const uint8_t* p) { return (float)(p[4] * 50.0f * 0.001341022089595f); }
+// Battery Block Voltage -V01: (A * 256 + B) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v01(const uint8_t* p) { return (float)((p[2] * 256.0f + p[3]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V02: (C * 256 + D) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v02(const uint8_t* p) { return (float)((p[4] * 256.0f + p[5]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V03: (E * 256 + F) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v03(const uint8_t* p) { return (float)((p[6] * 256.0f + p[7]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V04: (G * 256 + H) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v04(const uint8_t* p) { return (float)((p[8] * 256.0f + p[9]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V05: (I * 256 + J) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v05(const uint8_t* p) { return (float)((p[10] * 256.0f + p[11]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V06: (K * 256 + L) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v06(const uint8_t* p) { return (float)((p[12] * 256.0f + p[13]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V07: (M * 256 + N) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v07(const uint8_t* p) { return (float)((p[14] * 256.0f + p[15]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V08: (O * 256 + P) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v08(const uint8_t* p) { return (float)((p[16] * 256.0f + p[17]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V09: (Q * 256 + R) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v09(const uint8_t* p) { return (float)((p[18] * 256.0f + p[19]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V10: (S * 256 + T) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v10(const uint8_t* p) { return (float)((p[20] * 256.0f + p[21]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V11: (U * 256 + V) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v11(const uint8_t* p) { return (float)((p[22] * 256.0f + p[23]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V12: (W * 256 + X) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v12(const uint8_t* p) { return (float)((p[24] * 256.0f + p[25]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V13: (Y * 256 + Z) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v13(const uint8_t* p) { return (float)((p[26] * 256.0f + p[27]) * 79.99f / 65535.0f); }
+// Battery Block Voltage -V14: (AA * 256 + AB) * 79.99 / 65535 [V]
+inline float pid_7e2_2181_v14(const uint8_t* p) { return (float)((p[28] * 256.0f + p[29]) * 79.99f / 65535.0f); }
+// Auxiliary Battery Voltage: (AC * 256 + AD) * 79.9 / 65535 - 40 [V]
+inline float pid_7e2_2181_aux_bty(const uint8_t* p) { return (float)((p[30] * 256.0f + p[31]) * 79.9f / 65535.0f - 40.0f); }
+// Power Resource VB: (AE * 256 + AF) / 10 [V]
+inline float pid_7e2_2181_vb(const uint8_t* p) { return (float)((p[32] * 256.0f + p[33]) / 10.0f); }
+// VMF Fan Motor Voltage1: AG / 10 [V]
+inline float pid_7e2_2181_vmf(const uint8_t* p) { return (float)(p[34] / 10.0f); }
+// HV battery intake air temperature: (A * 256 + B) * 255.9 / 65535 * 9 / 5 - 58 [F]
+inline float pid_7e2_2187_tb_intake(const uint8_t* p) { return (float)((p[2] * 256.0f + p[3]) * 255.9f / 65535.0f * 9.0f / 5.0f - 58.0f); }
+// Temp of Batt TB1: (C * 256 + D) * 255.9 / 65535 * 9 / 5 - 58 [F]
+inline float pid_7e2_2187_tb_1(const uint8_t* p) { return (float)((p[4] * 256.0f + p[5]) * 255.9f / 65535.0f * 9.0f / 5.0f - 58.0f); }
+// Temp of Batt TB2: (E * 256 + F) * 255.9 / 65535 * 9 / 5 - 58 [F]
+inline float pid_7e2_2187_tb_2(const uint8_t* p) { return (float)((p[6] * 256.0f + p[7]) * 255.9f / 65535.0f * 9.0f / 5.0f - 58.0f); }
+// Temp of Batt TB3: (G * 256 + H) * 255.9 / 65535 * 9 / 5 - 58 [F]
+inline float pid_7e2_2187_tb_3(const uint8_t* p) { return (float)((p[8] * 256.0f + p[9]) * 255.9f / 65535.0f * 9.0f / 5.0f - 58.0f); }
+// Power Resource IB: (A * 256 + B) / 100 - 327.68 [Amperes]
+inline float pid_7e2_218a_ib(const uint8_t* p) { return (float)((p[2] * 256.0f + p[3]) / 100.0f - 327.68f); }
+// Cooling Fan 0: A / 2 [%]
+inline float pid_7e2_218e_c_fan_0(const uint8_t* p) { return (float)(p[2] / 2.0f); }
+// Cooling Fan Relay Status: {B:7} [Off/On]
+inline float pid_7e2_218e_c_fan_rly(const uint8_t* p) { return (float)(((p[3] >> 7) & 1)); }
+// Battery block minimum voltage: (A * 256 + B) * 79.99 / 65535 [V]
+inline float pid_7e2_2192_vmin(const uint8_t* p) { return (float)((p[2] * 256.0f + p[3]) * 79.99f / 65535.0f); }
+// Battery block number with minimum voltage: C [Number]
+inline float pid_7e2_2192_blk_min(const uint8_t* p) { return (float)(p[4]); }
+// Battery block maximum voltage: (D * 256 + E) * 79.99 / 65535 [V]
+inline float pid_7e2_2192_vmax(const uint8_t* p) { return (float)((p[5] * 256.0f + p[6]) * 79.99f / 65535.0f); }
+// Battery block number with maximum voltage: F [Number]
+inline float pid_7e2_2192_blk_max(const uint8_t* p) { return (float)(p[7]); }
+// Difference between maximum & minimum voltage: ((D - A) * 256 + E - B) * 79.99 / 65535 [V]
+inline float pid_7e2_2192_vmax_vmin(const uint8_t* p) { return (float)(((p[5] - p[2]) * 256.0f + p[6] - p[3]) * 79.99f / 65535.0f); }
+// Number of battery blocks: G [Number]
+inline float pid_7e2_2192_bty_blk(const uint8_t* p) { return (float)(p[8]); }
+// Accumulated Time of Battery Low: H * 256 + I [Number]
+inline float pid_7e2_2192_low_count(const uint8_t* p) { return (float)(p[9] * 256.0f + p[10]); }
+// Accumulated Time of DC Inhibit: J * 256 + K [Number]
+inline float pid_7e2_2192_dci_count(const uint8_t* p) { return (float)(p[11] * 256.0f + p[12]); }
+// Accumulated Time of Battery too High: L * 256 + M [Number]
+inline float pid_7e2_2192_high_count(const uint8_t* p) { return (float)(p[13] * 256.0f + p[14]); }
+// Accumulated Time of Hot Temperature: N * 256 + O [Number]
+inline float pid_7e2_2192_hot_count(const uint8_t* p) { return (float)(p[15] * 256.0f + p[16]); }
+// Internal Resistance R01: A / 1000 [ohm]
+inline float pid_7e2_2195_r01(const uint8_t* p) { return (float)(p[2] / 1000.0f); }
+// Internal Resistance R02: B / 1000 [ohm]
+inline float pid_7e2_2195_r02(const uint8_t* p) { return (float)(p[3] / 1000.0f); }
+// Internal Resistance R03: C / 1000 [ohm]
+inline float pid_7e2_2195_r03(const uint8_t* p) { return (float)(p[4] / 1000.0f); }
+// Internal Resistance R04: D / 1000 [ohm]
+inline float pid_7e2_2195_r04(const uint8_t* p) { return (float)(p[5] / 1000.0f); }
+// Internal Resistance R05: E / 1000 [ohm]
+inline float pid_7e2_2195_r05(const uint8_t* p) { return (float)(p[6] / 1000.0f); }
+// Internal Resistance R06: F / 1000 [ohm]
+inline float pid_7e2_2195_r06(const uint8_t* p) { return (float)(p[7] / 1000.0f); }
+// Internal Resistance R07: G / 1000 [ohm]
+inline float pid_7e2_2195_r07(const uint8_t* p) { return (float)(p[8] / 1000.0f); }
+// Internal Resistance R08: H / 1000 [ohm]
+inline float pid_7e2_2195_r08(const uint8_t* p) { return (float)(p[9] / 1000.0f); }
+// Internal Resistance R09: I / 1000 [ohm]
+inline float pid_7e2_2195_r09(const uint8_t* p) { return (float)(p[10] / 1000.0f); }
+// Internal Resistance R10: J / 1000 [ohm]
+inline float pid_7e2_2195_r10(const uint8_t* p) { return (float)(p[11] / 1000.0f); }
+// Internal Resistance R11: K / 1000 [ohm]
+inline float pid_7e2_2195_r11(const uint8_t* p) { return (float)(p[12] / 1000.0f); }
+// Internal Resistance R12: L / 1000 [ohm]
+inline float pid_7e2_2195_r12(const uint8_t* p) { return (float)(p[13] / 1000.0f); }
+// Internal Resistance R13: M / 1000 [ohm]
+inline float pid_7e2_2195_r13(const uint8_t* p) { return (float)(p[14] / 1000.0f); }
+// Internal Resistance R14: N / 1000 [ohm]
+inline float pid_7e2_2195_r14(const uint8_t* p) { return (float)(p[15] / 1000.0f); }
+// Batt Pack Current Val: (A * 256 + B) / 100 - 327.68 [Amperes]
+inline float pid_7e2_2198_bty_curr(const uint8_t* p) { return (float)((p[2] * 256.0f + p[3]) / 100.0f - 327.68f); }
+// HV battery discharge control: (C / 2 - 64) * 1.341022089595028 [HP]
+inline float pid_7e2_2198_dischg_ctrl(const uint8_t* p) { return (float)((p[4] / 2.0f - 64.0f) * 1.341022089595028f); }
+// HV battery charge control: (D / 2 - 64) * 1.341022089595028 [HP]
+inline float pid_7e2_2198_chg_ctrl(const uint8_t* p) { return (float)((p[5] / 2.0f - 64.0f) * 1.341022089595028f); }
+// Delta SOC: E / 2 [%]
+inline float pid_7e2_2198_delta_soc(const uint8_t* p) { return (float)(p[6] / 2.0f); }
+// SOC after IG-ON: F / 2 [%]
+inline float pid_7e2_2198_soc_ig_on(const uint8_t* p) { return (float)(p[7] / 2.0f); }
+// SOC Max: G / 2 [%]
+inline float pid_7e2_2198_soc_max(const uint8_t* p) { return (float)(p[8] / 2.0f); }
+// SOC Min: H / 2 [%]
+inline float pid_7e2_2198_soc_min(const uint8_t* p) { return (float)(p[9] / 2.0f); }
+// ECU Control Mode (Driving control mode=1,Current sensor offset mode=2,External charge control mode=3,Power supply end mode=4): A [Number]
+inline float pid_7e2_219b_ecu_mode(const uint8_t* p) { return (float)(p[2]); }
+// Battery Cooling Fan Mode: B [Number]
+inline float pid_7e2_219b_fan_mode(const uint8_t* p) { return (float)(p[3]); }
+// Standby Blower Request Status: {C:7} [Off/On]
+inline float pid_7e2_219b_sbrs(const uint8_t* p) { return (float)(((p[4] >> 7) & 1)); }
+// Short Circuit Wave Highest Value: D * 4.98 / 255 [V]
+inline float pid_7e2_219b_s_c_wave_hi(const uint8_t* p) { return (float)(p[5] * 4.98f / 255.0f); }
+// Destination (America=A=65): P [Number]
+inline float pid_7e2_21c1_dest(const uint8_t* p) { return (float)(p[17]); }
+// Number of Current Code: A [Number]
+inline float pid_7e2_21e1_curr_code(const uint8_t* p) { return (float)(p[2]); }
+// Number of History Code: B [Number]
+inline float pid_7e2_21e1_hist_code(const uint8_t* p) { return (float)(p[3]); }
+// Engine Coolant Temp (Mode 01): A - 40 [C]
+inline float pid_7e2_0105_ect(const uint8_t* p) { return (float)(p[2] - 40.0f); }
+// HV battery intake air temperature (C): (A * 256 + B) * 255.9 / 65535 - 50 [C]
+inline float pid_7e2_2187_tb_intake_c(const uint8_t* p) { return (float)((p[2] * 256.0f + p[3]) * 255.9f / 65535.0f - 50.0f); }
+// Temp of Batt TB1 (C): (C * 256 + D) * 255.9 / 65535 - 50 [C]
+inline float pid_7e2_2187_tb_1_c(const uint8_t* p) { return (float)((p[4] * 256.0f + p[5]) * 255.9f / 65535.0f - 50.0f); }
+// Temp of Batt TB2 (C): (E * 256 + F) * 255.9 / 65535 - 50 [C]
+inline float pid_7e2_2187_tb_2_c(const uint8_t* p) { return (float)((p[6] * 256.0f + p[7]) * 255.9f / 65535.0f - 50.0f); }
+// Temp of Batt TB3 (C): (G * 256 + H) * 255.9 / 65535 - 50 [C]
+inline float pid_7e2_2187_tb_3_c(const uint8_t* p) { return (float)((p[8] * 256.0f + p[9]) * 255.9f / 65535.0f - 50.0f); }
+} // namespace pid_decode
+
+// Scaled-integer forms of the linear equations above.
+namespace pid_fixed {
+namespace pid_7b0_2103_fr_ws {
+using scale = FixedScale<uint8_t, 10000, 12573>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7b0_2103_fl_ws {
+using scale = FixedScale<uint8_t, 10000, 12573>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7b0_2103_rr_ws {
+using scale = FixedScale<uint8_t, 10000, 12573>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7b0_2103_rl_ws {
+using scale = FixedScale<uint8_t, 10000, 12573>;
+inline int32_t raw(const uint8_t* p) { return p[5]; }
+}
+namespace pid_7b0_2106_yr1 {
+using scale = FixedScale<int8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2] - 128; }
+}
+namespace pid_7b0_2106_yr2 {
+using scale = FixedScale<int8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3] - 128; }
+}
+namespace pid_7b0_2107_wc_pres {
+using scale = FixedScale<uint8_t, 1, 51>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7b0_2147_lateral_g {
+using scale = FixedScale<uint8_t, 2501, 12750, -2511, 100>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7b0_2147_fwd_rwd_g {
+using scale = FixedScale<uint8_t, 2501, 12750, -2511, 100>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7b0_2147_yr_val {
+using scale = FixedScale<int8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[4] - 128; }
+}
+namespace pid_7b0_2147_steerangle {
+using scale = FixedScale<int16_t, 1, 10>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[5] + p[6] - 32768; }
+}
+namespace pid_7b0_2158_regencoop {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 7) & 1); }
+}
+namespace pid_7b0_21a3_sla_curr {
+using scale = FixedScale<uint8_t, 1, 85>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7b0_21a3_slr_curr {
+using scale = FixedScale<uint8_t, 1, 85>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7b0_21a3_ssc_curr {
+using scale = FixedScale<uint8_t, 1, 85>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7b0_21a3_scc_curr {
+using scale = FixedScale<uint8_t, 1, 85>;
+inline int32_t raw(const uint8_t* p) { return p[5]; }
+}
+namespace pid_7b0_21a3_smc_curr {
+using scale = FixedScale<uint8_t, 1, 85>;
+inline int32_t raw(const uint8_t* p) { return p[6]; }
+}
+namespace pid_7b0_21a3_src_curr {
+using scale = FixedScale<uint8_t, 1, 85>;
+inline int32_t raw(const uint8_t* p) { return p[7]; }
+}
+namespace pid_7b0_21a6_insp_mode {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 7) & 1); }
+}
+namespace pid_7b0_21bc_haz_hist {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 5) & 1); }
+}
+namespace pid_7b0_21be_frs_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 7) & 1); }
+}
+namespace pid_7b0_21be_fls_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 6) & 1); }
+}
+namespace pid_7b0_21be_rrs_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 5) & 1); }
+}
+namespace pid_7b0_21be_rls_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 4) & 1); }
+}
+namespace pid_7b0_21be_yr_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 2) & 1); }
+}
+namespace pid_7b0_21be_decel_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 1) & 1); }
+}
+namespace pid_7b0_21be_steer_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 0) & 1); }
+}
+namespace pid_7b0_21be_mc_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[3] >> 7) & 1); }
+}
+namespace pid_7b0_21be_stroke_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[3] >> 5) & 1); }
+}
+namespace pid_7b0_21be_frwc_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[3] >> 3) & 1); }
+}
+namespace pid_7b0_21be_acc_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[4] >> 7) & 1); }
+}
+namespace pid_7b0_21be_hvc_open {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[4] >> 6) & 1); }
+}
+namespace pid_7c0_2112_tail_cancel {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 5) & 1); }
+}
+namespace pid_7c0_2113_aux_b_volt {
+using scale = FixedScale<uint8_t, 1, 10>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c0_2129_fuel_level {
+using scale = FixedScale<uint8_t, 100, 757>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c0_2141_oil_chg_dist {
+using scale = FixedScale<uint8_t, 100, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c0_2168_rheostat {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c0_21a7_sbb_query {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c0_21ac_rb_query {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_2121_room {
+using scale = FixedScale<uint8_t, 9, 20, 203, 10>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_2122_ambient {
+using scale = FixedScale<uint8_t, 63, 100, -497, 50>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_2124_solar_d {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_2126_coolant {
+using scale = FixedScale<uint8_t, 63, 100, 1717, 50>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_2129_set_t_d {
+using scale = FixedScale<uint8_t, 9, 85, 127, 2>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_213c_blower_level {
+using scale = FixedScale<uint8_t, 31, 255>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_213d_adjambient {
+using scale = FixedScale<uint8_t, 72, 125, -586, 25>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_2141_a_m_stp_d {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_2141_a_m_sap_d {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7c4_2143_a_o_sp_d {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_2143_a_o_sap_d {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7c4_2144_a_i_dtp {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_2144_a_i_dap {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7c4_2149_comp_spd {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3]; }
+}
+namespace pid_7c4_214a_comp_t_spd {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3]; }
+}
+namespace pid_7c4_214b_evap_fin {
+using scale = FixedScale<uint8_t, 63, 100, -1073, 50>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7c4_214c_evap_tgt {
+using scale = FixedScale<int32_t, 9, 500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3] - 30990; }
+}
+namespace pid_7e0_2101_cal_d_load {
+using scale = FixedScale<uint8_t, 20, 51>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e0_2101_veh_load {
+using scale = FixedScale<uint16_t, 20, 51>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[3] + p[4]; }
+}
+namespace pid_7e0_2101_maf {
+using scale = FixedScale<uint16_t, 1, 100>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[5] + p[6]; }
+}
+namespace pid_7e0_2101_map {
+using scale = FixedScale<uint8_t, 1913, 255>;
+inline int32_t raw(const uint8_t* p) { return p[7]; }
+}
+namespace pid_7e0_2101_iat {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[8]; }
+}
+namespace pid_7e0_2101_atmpres {
+using scale = FixedScale<uint8_t, 1913, 255>;
+inline int32_t raw(const uint8_t* p) { return p[9]; }
+}
+namespace pid_7e0_2101_coolant {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[10]; }
+}
+namespace pid_7e0_2101_rpm {
+using scale = FixedScale<uint16_t, 1, 4>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[11] + p[12]; }
+}
+namespace pid_7e0_2101_mph {
+using scale = FixedScale<uint8_t, 15625, 25146>;
+inline int32_t raw(const uint8_t* p) { return p[13]; }
+}
+namespace pid_7e0_2101_ign_time {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[14] + p[15]; }
+}
+namespace pid_7e0_213c_inj_dur {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[4] + p[5]; }
+}
+namespace pid_7e0_2149_actengtorq {
+using scale = FixedScale<int16_t, 7375621, 10000000>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[5] + p[6] - 32768; }
+}
+namespace pid_7e2_015b_soc {
+using scale = FixedScale<uint8_t, 20, 51>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_2101_cal_d_load {
+using scale = FixedScale<uint8_t, 20, 51>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_2101_map {
+using scale = FixedScale<uint8_t, 1913, 255>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_2101_iat {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7e2_2101_ambient {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[5]; }
+}
+namespace pid_7e2_2101_atmpres {
+using scale = FixedScale<uint8_t, 1913, 255>;
+inline int32_t raw(const uint8_t* p) { return p[6]; }
+}
+namespace pid_7e2_2101_coolant {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[7]; }
+}
+namespace pid_7e2_2101_rpm {
+using scale = FixedScale<uint16_t, 1, 4>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[8] + p[9]; }
+}
+namespace pid_7e2_2101_mph {
+using scale = FixedScale<uint8_t, 15625, 25146>;
+inline int32_t raw(const uint8_t* p) { return p[10]; }
+}
+namespace pid_7e2_2101_ign_time {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[11] + p[12]; }
+}
+namespace pid_7e2_2101_throttle {
+using scale = FixedScale<uint8_t, 20, 51>;
+inline int32_t raw(const uint8_t* p) { return p[13]; }
+}
+namespace pid_7e2_2101_ap1 {
+using scale = FixedScale<uint8_t, 20, 51>;
+inline int32_t raw(const uint8_t* p) { return p[14]; }
+}
+namespace pid_7e2_2101_ap2 {
+using scale = FixedScale<uint8_t, 20, 51>;
+inline int32_t raw(const uint8_t* p) { return p[15]; }
+}
+namespace pid_7e2_2101_dtc_warm {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[16]; }
+}
+namespace pid_7e2_2101_dtc_dist {
+using scale = FixedScale<uint16_t, 15625, 25146>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[17] + p[18]; }
+}
+namespace pid_7e2_2101_dtc_time {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[19] + p[20]; }
+}
+namespace pid_7e2_2101_b {
+using scale = FixedScale<uint16_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[21] + p[22]; }
+}
+namespace pid_7e2_2101_soc_all {
+using scale = FixedScale<uint8_t, 20, 51>;
+inline int32_t raw(const uint8_t* p) { return p[23]; }
+}
+namespace pid_7e2_2141_shift_m {
+using scale = FixedScale<uint8_t, 83, 4250>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_2141_shift_s {
+using scale = FixedScale<uint8_t, 83, 4250>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_2141_shift_sel_m {
+using scale = FixedScale<uint8_t, 83, 4250>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7e2_2141_shift_sel_s {
+using scale = FixedScale<uint8_t, 83, 4250>;
+inline int32_t raw(const uint8_t* p) { return p[5]; }
+}
+namespace pid_7e2_2141_aux_b_t {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[6]; }
+}
+namespace pid_7e2_2141_rpm_sensor {
+using scale = FixedScale<uint16_t, 1, 4>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[7] + p[8]; }
+}
+namespace pid_7e2_2161_mg1t {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_2161_mg1t_ign {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_2161_mg1t_max {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7e2_2161_mg1_rpm {
+using scale = FixedScale<int16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[5] + p[6] - 32768; }
+}
+namespace pid_7e2_2162_mg2t {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_2162_mg2t_ign {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_2162_mg2t_max {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7e2_2162_mg2_rpm {
+using scale = FixedScale<int16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[5] + p[6] - 32768; }
+}
+namespace pid_7e2_2167_mg1_torq {
+using scale = FixedScale<int16_t, 7375621, 80000000>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3] - 32768; }
+}
+namespace pid_7e2_2167_mg1_e_torq {
+using scale = FixedScale<int16_t, 7375621, 80000000>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[4] + p[5] - 32768; }
+}
+namespace pid_7e2_2167_mg1_mode {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[6]; }
+}
+namespace pid_7e2_2168_mg2_torq {
+using scale = FixedScale<int16_t, 7375621, 80000000>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3] - 32768; }
+}
+namespace pid_7e2_2168_mg2_e_torq {
+using scale = FixedScale<int16_t, 7375621, 80000000>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[4] + p[5] - 32768; }
+}
+namespace pid_7e2_2168_mg2_mode {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[6]; }
+}
+namespace pid_7e2_2170_inv1t {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_2170_inv1t_ign {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_2170_inv1t_max {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7e2_2170_mg1_gate {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[5] >> 7) & 1); }
+}
+namespace pid_7e2_2171_inv2t {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_2171_inv2t_ign {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_2171_inv2t_max {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7e2_2171_mg2_gate {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[5] >> 7) & 1); }
+}
+namespace pid_7e2_2174_bc_u {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_2174_bc_l {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_2174_bc_ign {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7e2_2174_bc_max {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[5]; }
+}
+namespace pid_7e2_2174_cnv_gate {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[6] >> 7) & 1); }
+}
+namespace pid_7e2_2174_o_v_i_p_cnv {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[6] >> 6) & 1); }
+}
+namespace pid_7e2_2174_o_v_i_p_inv {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[6] >> 5) & 1); }
+}
+namespace pid_7e2_2174_vlb {
+using scale = FixedScale<uint16_t, 1, 2>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[7] + p[8]; }
+}
+namespace pid_7e2_2174_vhb {
+using scale = FixedScale<uint16_t, 1, 2>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[9] + p[10]; }
+}
+namespace pid_7e2_2175_p_dcdc {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 6) & 1); }
+}
+namespace pid_7e2_2175_a_c_gate {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 5) & 1); }
+}
+namespace pid_7e2_2175_wp_run {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 4) & 1); }
+}
+namespace pid_7e2_2175_inv_wp {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[3] + p[4]; }
+}
+namespace pid_7e2_2175_inv_coolant {
+using scale = FixedScale<uint8_t, 9, 5, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return p[5]; }
+}
+namespace pid_7e2_2178_inv1_s_d {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 7) & 1); }
+}
+namespace pid_7e2_2178_inv1_fail {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[2] >> 6) & 1); }
+}
+namespace pid_7e2_2178_inv2_s_d {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[3] >> 7) & 1); }
+}
+namespace pid_7e2_2178_inv2_fail {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[3] >> 6) & 1); }
+}
+namespace pid_7e2_2179_dctpd {
+using scale = FixedScale<uint16_t, 1333, 218450>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3]; }
+}
+namespace pid_7e2_2179_wp_duty {
+using scale = FixedScale<uint8_t, 25, 4>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7e2_2179_cnv_s_d {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[5] >> 7) & 1); }
+}
+namespace pid_7e2_2179_cnv_fail {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[5] >> 6) & 1); }
+}
+namespace pid_7e2_217c_mg1_cf {
+using scale = FixedScale<uint8_t, 1, 20>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_217c_mg2_cf {
+using scale = FixedScale<uint8_t, 1, 20>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_217d_b_ratio {
+using scale = FixedScale<uint8_t, 1, 2>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_217d_cnv_cf {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_2181_v01 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3]; }
+}
+namespace pid_7e2_2181_v02 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[4] + p[5]; }
+}
+namespace pid_7e2_2181_v03 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[6] + p[7]; }
+}
+namespace pid_7e2_2181_v04 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[8] + p[9]; }
+}
+namespace pid_7e2_2181_v05 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[10] + p[11]; }
+}
+namespace pid_7e2_2181_v06 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[12] + p[13]; }
+}
+namespace pid_7e2_2181_v07 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[14] + p[15]; }
+}
+namespace pid_7e2_2181_v08 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[16] + p[17]; }
+}
+namespace pid_7e2_2181_v09 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[18] + p[19]; }
+}
+namespace pid_7e2_2181_v10 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[20] + p[21]; }
+}
+namespace pid_7e2_2181_v11 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[22] + p[23]; }
+}
+namespace pid_7e2_2181_v12 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[24] + p[25]; }
+}
+namespace pid_7e2_2181_v13 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[26] + p[27]; }
+}
+namespace pid_7e2_2181_v14 {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[28] + p[29]; }
+}
+namespace pid_7e2_2181_aux_bty {
+using scale = FixedScale<uint16_t, 47, 38550, -40, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[30] + p[31]; }
+}
+namespace pid_7e2_2181_vb {
+using scale = FixedScale<uint16_t, 1, 10>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[32] + p[33]; }
+}
+namespace pid_7e2_2181_vmf {
+using scale = FixedScale<uint8_t, 1, 10>;
+inline int32_t raw(const uint8_t* p) { return p[34]; }
+}
+namespace pid_7e2_2187_tb_intake {
+using scale = FixedScale<uint16_t, 7677, 1092250, -58, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3]; }
+}
+namespace pid_7e2_2187_tb_1 {
+using scale = FixedScale<uint16_t, 7677, 1092250, -58, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[4] + p[5]; }
+}
+namespace pid_7e2_2187_tb_2 {
+using scale = FixedScale<uint16_t, 7677, 1092250, -58, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[6] + p[7]; }
+}
+namespace pid_7e2_2187_tb_3 {
+using scale = FixedScale<uint16_t, 7677, 1092250, -58, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[8] + p[9]; }
+}
+namespace pid_7e2_218a_ib {
+using scale = FixedScale<int16_t, 1, 100>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3] - 32768; }
+}
+namespace pid_7e2_218e_c_fan_0 {
+using scale = FixedScale<uint8_t, 1, 2>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_218e_c_fan_rly {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[3] >> 7) & 1); }
+}
+namespace pid_7e2_2192_vmin {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3]; }
+}
+namespace pid_7e2_2192_blk_min {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7e2_2192_vmax {
+using scale = FixedScale<uint16_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[5] + p[6]; }
+}
+namespace pid_7e2_2192_blk_max {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[7]; }
+}
+namespace pid_7e2_2192_vmax_vmin {
+using scale = FixedScale<int32_t, 7999, 6553500>;
+inline int32_t raw(const uint8_t* p) { return -256 * p[2] - p[3] + 256 * p[5] + p[6]; }
+}
+namespace pid_7e2_2192_bty_blk {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[8]; }
+}
+namespace pid_7e2_2192_low_count {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[9] + p[10]; }
+}
+namespace pid_7e2_2192_dci_count {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[11] + p[12]; }
+}
+namespace pid_7e2_2192_high_count {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[13] + p[14]; }
+}
+namespace pid_7e2_2192_hot_count {
+using scale = FixedScale<uint16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[15] + p[16]; }
+}
+namespace pid_7e2_2195_r01 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_2195_r02 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_2195_r03 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[4]; }
+}
+namespace pid_7e2_2195_r04 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[5]; }
+}
+namespace pid_7e2_2195_r05 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[6]; }
+}
+namespace pid_7e2_2195_r06 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[7]; }
+}
+namespace pid_7e2_2195_r07 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[8]; }
+}
+namespace pid_7e2_2195_r08 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[9]; }
+}
+namespace pid_7e2_2195_r09 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[10]; }
+}
+namespace pid_7e2_2195_r10 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[11]; }
+}
+namespace pid_7e2_2195_r11 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[12]; }
+}
+namespace pid_7e2_2195_r12 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[13]; }
+}
+namespace pid_7e2_2195_r13 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[14]; }
+}
+namespace pid_7e2_2195_r14 {
+using scale = FixedScale<uint8_t, 1, 1000>;
+inline int32_t raw(const uint8_t* p) { return p[15]; }
+}
+namespace pid_7e2_2198_bty_curr {
+using scale = FixedScale<int16_t, 1, 100>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3] - 32768; }
+}
+namespace pid_7e2_2198_delta_soc {
+using scale = FixedScale<uint8_t, 1, 2>;
+inline int32_t raw(const uint8_t* p) { return p[6]; }
+}
+namespace pid_7e2_2198_soc_ig_on {
+using scale = FixedScale<uint8_t, 1, 2>;
+inline int32_t raw(const uint8_t* p) { return p[7]; }
+}
+namespace pid_7e2_2198_soc_max {
+using scale = FixedScale<uint8_t, 1, 2>;
+inline int32_t raw(const uint8_t* p) { return p[8]; }
+}
+namespace pid_7e2_2198_soc_min {
+using scale = FixedScale<uint8_t, 1, 2>;
+inline int32_t raw(const uint8_t* p) { return p[9]; }
+}
+namespace pid_7e2_219b_ecu_mode {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_219b_fan_mode {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_219b_sbrs {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return ((p[4] >> 7) & 1); }
+}
+namespace pid_7e2_219b_s_c_wave_hi {
+using scale = FixedScale<uint8_t, 83, 4250>;
+inline int32_t raw(const uint8_t* p) { return p[5]; }
+}
+namespace pid_7e2_21c1_dest {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[17]; }
+}
+namespace pid_7e2_21e1_curr_code {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2]; }
+}
+namespace pid_7e2_21e1_hist_code {
+using scale = FixedScale<uint8_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[3]; }
+}
+namespace pid_7e2_0105_ect {
+using scale = FixedScale<int16_t, 1, 1>;
+inline int32_t raw(const uint8_t* p) { return p[2] - 40; }
+}
+namespace pid_7e2_2187_tb_intake_c {
+using scale = FixedScale<uint16_t, 853, 218450, -50, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[2] + p[3]; }
+}
+namespace pid_7e2_2187_tb_1_c {
+using scale = FixedScale<uint16_t, 853, 218450, -50, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[4] + p[5]; }
+}
+namespace pid_7e2_2187_tb_2_c {
+using scale = FixedScale<uint16_t, 853, 218450, -50, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[6] + p[7]; }
+}
+namespace pid_7e2_2187_tb_3_c {
+using scale = FixedScale<uint16_t, 853, 218450, -50, 1>;
+inline int32_t raw(const uint8_t* p) { return 256 * p[8] + p[9]; }
+}
+} // namespace pid_fixed
+
+// The same by catalog index, for code that knows the PID at compile time:
+// PidFixed<PID>::raw(p) inlines to the byte arithmetic where
+// pidCatalog[PID].decodeRaw(p) is a call through the table.
+template <uint16_t PID>
+struct PidFixed;
+template <> struct PidFixed<PID_7B0_2103_FR_WS> {
+    using scale = pid_fixed::pid_7b0_2103_fr_ws::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2103_fr_ws::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2103_FL_WS> {
+    using scale = pid_fixed::pid_7b0_2103_fl_ws::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2103_fl_ws::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2103_RR_WS> {
+    using scale = pid_fixed::pid_7b0_2103_rr_ws::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2103_rr_ws::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2103_RL_WS> {
+    using scale = pid_fixed::pid_7b0_2103_rl_ws::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2103_rl_ws::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2106_YR1> {
+    using scale = pid_fixed::pid_7b0_2106_yr1::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2106_yr1::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2106_YR2> {
+    using scale = pid_fixed::pid_7b0_2106_yr2::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2106_yr2::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2107_WC_PRES> {
+    using scale = pid_fixed::pid_7b0_2107_wc_pres::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2107_wc_pres::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2147_LATERAL_G> {
+    using scale = pid_fixed::pid_7b0_2147_lateral_g::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2147_lateral_g::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2147_FWD_RWD_G> {
+    using scale = pid_fixed::pid_7b0_2147_fwd_rwd_g::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2147_fwd_rwd_g::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2147_YR_VAL> {
+    using scale = pid_fixed::pid_7b0_2147_yr_val::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2147_yr_val::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2147_STEERANGLE> {
+    using scale = pid_fixed::pid_7b0_2147_steerangle::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2147_steerangle::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_2158_REGENCOOP> {
+    using scale = pid_fixed::pid_7b0_2158_regencoop::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_2158_regencoop::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21A3_SLA_CURR> {
+    using scale = pid_fixed::pid_7b0_21a3_sla_curr::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21a3_sla_curr::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21A3_SLR_CURR> {
+    using scale = pid_fixed::pid_7b0_21a3_slr_curr::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21a3_slr_curr::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21A3_SSC_CURR> {
+    using scale = pid_fixed::pid_7b0_21a3_ssc_curr::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21a3_ssc_curr::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21A3_SCC_CURR> {
+    using scale = pid_fixed::pid_7b0_21a3_scc_curr::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21a3_scc_curr::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21A3_SMC_CURR> {
+    using scale = pid_fixed::pid_7b0_21a3_smc_curr::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21a3_smc_curr::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21A3_SRC_CURR> {
+    using scale = pid_fixed::pid_7b0_21a3_src_curr::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21a3_src_curr::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21A6_INSP_MODE> {
+    using scale = pid_fixed::pid_7b0_21a6_insp_mode::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21a6_insp_mode::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BC_HAZ_HIST> {
+    using scale = pid_fixed::pid_7b0_21bc_haz_hist::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21bc_haz_hist::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_FRS_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_frs_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_frs_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_FLS_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_fls_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_fls_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_RRS_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_rrs_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_rrs_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_RLS_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_rls_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_rls_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_YR_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_yr_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_yr_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_DECEL_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_decel_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_decel_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_STEER_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_steer_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_steer_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_MC_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_mc_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_mc_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_STROKE_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_stroke_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_stroke_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_FRWC_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_frwc_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_frwc_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_ACC_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_acc_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_acc_open::raw(p); }
+};
+template <> struct PidFixed<PID_7B0_21BE_HVC_OPEN> {
+    using scale = pid_fixed::pid_7b0_21be_hvc_open::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7b0_21be_hvc_open::raw(p); }
+};
+template <> struct PidFixed<PID_7C0_2112_TAIL_CANCEL> {
+    using scale = pid_fixed::pid_7c0_2112_tail_cancel::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c0_2112_tail_cancel::raw(p); }
+};
+template <> struct PidFixed<PID_7C0_2113_AUX_B_VOLT> {
+    using scale = pid_fixed::pid_7c0_2113_aux_b_volt::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c0_2113_aux_b_volt::raw(p); }
+};
+template <> struct PidFixed<PID_7C0_2129_FUEL_LEVEL> {
+    using scale = pid_fixed::pid_7c0_2129_fuel_level::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c0_2129_fuel_level::raw(p); }
+};
+template <> struct PidFixed<PID_7C0_2141_OIL_CHG_DIST> {
+    using scale = pid_fixed::pid_7c0_2141_oil_chg_dist::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c0_2141_oil_chg_dist::raw(p); }
+};
+template <> struct PidFixed<PID_7C0_2168_RHEOSTAT> {
+    using scale = pid_fixed::pid_7c0_2168_rheostat::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c0_2168_rheostat::raw(p); }
+};
+template <> struct PidFixed<PID_7C0_21A7_SBB_QUERY> {
+    using scale = pid_fixed::pid_7c0_21a7_sbb_query::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c0_21a7_sbb_query::raw(p); }
+};
+template <> struct PidFixed<PID_7C0_21AC_RB_QUERY> {
+    using scale = pid_fixed::pid_7c0_21ac_rb_query::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c0_21ac_rb_query::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2121_ROOM> {
+    using scale = pid_fixed::pid_7c4_2121_room::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2121_room::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2122_AMBIENT> {
+    using scale = pid_fixed::pid_7c4_2122_ambient::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2122_ambient::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2124_SOLAR_D> {
+    using scale = pid_fixed::pid_7c4_2124_solar_d::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2124_solar_d::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2126_COOLANT> {
+    using scale = pid_fixed::pid_7c4_2126_coolant::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2126_coolant::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2129_SET_T_D> {
+    using scale = pid_fixed::pid_7c4_2129_set_t_d::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2129_set_t_d::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_213C_BLOWER_LEVEL> {
+    using scale = pid_fixed::pid_7c4_213c_blower_level::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_213c_blower_level::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_213D_ADJAMBIENT> {
+    using scale = pid_fixed::pid_7c4_213d_adjambient::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_213d_adjambient::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2141_A_M_STP_D> {
+    using scale = pid_fixed::pid_7c4_2141_a_m_stp_d::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2141_a_m_stp_d::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2141_A_M_SAP_D> {
+    using scale = pid_fixed::pid_7c4_2141_a_m_sap_d::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2141_a_m_sap_d::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2143_A_O_SP_D> {
+    using scale = pid_fixed::pid_7c4_2143_a_o_sp_d::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2143_a_o_sp_d::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2143_A_O_SAP_D> {
+    using scale = pid_fixed::pid_7c4_2143_a_o_sap_d::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2143_a_o_sap_d::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2144_A_I_DTP> {
+    using scale = pid_fixed::pid_7c4_2144_a_i_dtp::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2144_a_i_dtp::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2144_A_I_DAP> {
+    using scale = pid_fixed::pid_7c4_2144_a_i_dap::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2144_a_i_dap::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_2149_COMP_SPD> {
+    using scale = pid_fixed::pid_7c4_2149_comp_spd::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_2149_comp_spd::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_214A_COMP_T_SPD> {
+    using scale = pid_fixed::pid_7c4_214a_comp_t_spd::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_214a_comp_t_spd::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_214B_EVAP_FIN> {
+    using scale = pid_fixed::pid_7c4_214b_evap_fin::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_214b_evap_fin::raw(p); }
+};
+template <> struct PidFixed<PID_7C4_214C_EVAP_TGT> {
+    using scale = pid_fixed::pid_7c4_214c_evap_tgt::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7c4_214c_evap_tgt::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2101_CAL_D_LOAD> {
+    using scale = pid_fixed::pid_7e0_2101_cal_d_load::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2101_cal_d_load::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2101_VEH_LOAD> {
+    using scale = pid_fixed::pid_7e0_2101_veh_load::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2101_veh_load::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2101_MAF> {
+    using scale = pid_fixed::pid_7e0_2101_maf::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2101_maf::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2101_MAP> {
+    using scale = pid_fixed::pid_7e0_2101_map::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2101_map::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2101_IAT> {
+    using scale = pid_fixed::pid_7e0_2101_iat::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2101_iat::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2101_ATMPRES> {
+    using scale = pid_fixed::pid_7e0_2101_atmpres::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2101_atmpres::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2101_COOLANT> {
+    using scale = pid_fixed::pid_7e0_2101_coolant::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2101_coolant::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2101_RPM> {
+    using scale = pid_fixed::pid_7e0_2101_rpm::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2101_rpm::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2101_MPH> {
+    using scale = pid_fixed::pid_7e0_2101_mph::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2101_mph::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2101_IGN_TIME> {
+    using scale = pid_fixed::pid_7e0_2101_ign_time::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2101_ign_time::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_213C_INJ_DUR> {
+    using scale = pid_fixed::pid_7e0_213c_inj_dur::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_213c_inj_dur::raw(p); }
+};
+template <> struct PidFixed<PID_7E0_2149_ACTENGTORQ> {
+    using scale = pid_fixed::pid_7e0_2149_actengtorq::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e0_2149_actengtorq::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_015B_SOC> {
+    using scale = pid_fixed::pid_7e2_015b_soc::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_015b_soc::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_CAL_D_LOAD> {
+    using scale = pid_fixed::pid_7e2_2101_cal_d_load::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_cal_d_load::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_MAP> {
+    using scale = pid_fixed::pid_7e2_2101_map::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_map::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_IAT> {
+    using scale = pid_fixed::pid_7e2_2101_iat::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_iat::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_AMBIENT> {
+    using scale = pid_fixed::pid_7e2_2101_ambient::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_ambient::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_ATMPRES> {
+    using scale = pid_fixed::pid_7e2_2101_atmpres::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_atmpres::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_COOLANT> {
+    using scale = pid_fixed::pid_7e2_2101_coolant::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_coolant::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_RPM> {
+    using scale = pid_fixed::pid_7e2_2101_rpm::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_rpm::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_MPH> {
+    using scale = pid_fixed::pid_7e2_2101_mph::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_mph::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_IGN_TIME> {
+    using scale = pid_fixed::pid_7e2_2101_ign_time::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_ign_time::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_THROTTLE> {
+    using scale = pid_fixed::pid_7e2_2101_throttle::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_throttle::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_AP1> {
+    using scale = pid_fixed::pid_7e2_2101_ap1::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_ap1::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_AP2> {
+    using scale = pid_fixed::pid_7e2_2101_ap2::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_ap2::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_DTC_WARM> {
+    using scale = pid_fixed::pid_7e2_2101_dtc_warm::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_dtc_warm::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_DTC_DIST> {
+    using scale = pid_fixed::pid_7e2_2101_dtc_dist::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_dtc_dist::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_DTC_TIME> {
+    using scale = pid_fixed::pid_7e2_2101_dtc_time::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_dtc_time::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_B> {
+    using scale = pid_fixed::pid_7e2_2101_b::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_b::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2101_SOC_ALL> {
+    using scale = pid_fixed::pid_7e2_2101_soc_all::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2101_soc_all::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2141_SHIFT_M> {
+    using scale = pid_fixed::pid_7e2_2141_shift_m::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2141_shift_m::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2141_SHIFT_S> {
+    using scale = pid_fixed::pid_7e2_2141_shift_s::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2141_shift_s::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2141_SHIFT_SEL_M> {
+    using scale = pid_fixed::pid_7e2_2141_shift_sel_m::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2141_shift_sel_m::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2141_SHIFT_SEL_S> {
+    using scale = pid_fixed::pid_7e2_2141_shift_sel_s::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2141_shift_sel_s::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2141_AUX_B_T> {
+    using scale = pid_fixed::pid_7e2_2141_aux_b_t::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2141_aux_b_t::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2141_RPM_SENSOR> {
+    using scale = pid_fixed::pid_7e2_2141_rpm_sensor::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2141_rpm_sensor::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2161_MG1T> {
+    using scale = pid_fixed::pid_7e2_2161_mg1t::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2161_mg1t::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2161_MG1T_IGN> {
+    using scale = pid_fixed::pid_7e2_2161_mg1t_ign::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2161_mg1t_ign::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2161_MG1T_MAX> {
+    using scale = pid_fixed::pid_7e2_2161_mg1t_max::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2161_mg1t_max::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2161_MG1_RPM> {
+    using scale = pid_fixed::pid_7e2_2161_mg1_rpm::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2161_mg1_rpm::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2162_MG2T> {
+    using scale = pid_fixed::pid_7e2_2162_mg2t::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2162_mg2t::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2162_MG2T_IGN> {
+    using scale = pid_fixed::pid_7e2_2162_mg2t_ign::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2162_mg2t_ign::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2162_MG2T_MAX> {
+    using scale = pid_fixed::pid_7e2_2162_mg2t_max::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2162_mg2t_max::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2162_MG2_RPM> {
+    using scale = pid_fixed::pid_7e2_2162_mg2_rpm::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2162_mg2_rpm::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2167_MG1_TORQ> {
+    using scale = pid_fixed::pid_7e2_2167_mg1_torq::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2167_mg1_torq::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2167_MG1_E_TORQ> {
+    using scale = pid_fixed::pid_7e2_2167_mg1_e_torq::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2167_mg1_e_torq::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2167_MG1_MODE> {
+    using scale = pid_fixed::pid_7e2_2167_mg1_mode::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2167_mg1_mode::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2168_MG2_TORQ> {
+    using scale = pid_fixed::pid_7e2_2168_mg2_torq::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2168_mg2_torq::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2168_MG2_E_TORQ> {
+    using scale = pid_fixed::pid_7e2_2168_mg2_e_torq::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2168_mg2_e_torq::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2168_MG2_MODE> {
+    using scale = pid_fixed::pid_7e2_2168_mg2_mode::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2168_mg2_mode::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2170_INV1T> {
+    using scale = pid_fixed::pid_7e2_2170_inv1t::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2170_inv1t::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2170_INV1T_IGN> {
+    using scale = pid_fixed::pid_7e2_2170_inv1t_ign::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2170_inv1t_ign::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2170_INV1T_MAX> {
+    using scale = pid_fixed::pid_7e2_2170_inv1t_max::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2170_inv1t_max::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2170_MG1_GATE> {
+    using scale = pid_fixed::pid_7e2_2170_mg1_gate::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2170_mg1_gate::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2171_INV2T> {
+    using scale = pid_fixed::pid_7e2_2171_inv2t::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2171_inv2t::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2171_INV2T_IGN> {
+    using scale = pid_fixed::pid_7e2_2171_inv2t_ign::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2171_inv2t_ign::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2171_INV2T_MAX> {
+    using scale = pid_fixed::pid_7e2_2171_inv2t_max::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2171_inv2t_max::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2171_MG2_GATE> {
+    using scale = pid_fixed::pid_7e2_2171_mg2_gate::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2171_mg2_gate::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2174_BC_U> {
+    using scale = pid_fixed::pid_7e2_2174_bc_u::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2174_bc_u::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2174_BC_L> {
+    using scale = pid_fixed::pid_7e2_2174_bc_l::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2174_bc_l::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2174_BC_IGN> {
+    using scale = pid_fixed::pid_7e2_2174_bc_ign::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2174_bc_ign::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2174_BC_MAX> {
+    using scale = pid_fixed::pid_7e2_2174_bc_max::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2174_bc_max::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2174_CNV_GATE> {
+    using scale = pid_fixed::pid_7e2_2174_cnv_gate::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2174_cnv_gate::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2174_O_V_I_P_CNV> {
+    using scale = pid_fixed::pid_7e2_2174_o_v_i_p_cnv::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2174_o_v_i_p_cnv::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2174_O_V_I_P_INV> {
+    using scale = pid_fixed::pid_7e2_2174_o_v_i_p_inv::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2174_o_v_i_p_inv::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2174_VLB> {
+    using scale = pid_fixed::pid_7e2_2174_vlb::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2174_vlb::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2174_VHB> {
+    using scale = pid_fixed::pid_7e2_2174_vhb::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2174_vhb::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2175_P_DCDC> {
+    using scale = pid_fixed::pid_7e2_2175_p_dcdc::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2175_p_dcdc::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2175_A_C_GATE> {
+    using scale = pid_fixed::pid_7e2_2175_a_c_gate::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2175_a_c_gate::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2175_WP_RUN> {
+    using scale = pid_fixed::pid_7e2_2175_wp_run::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2175_wp_run::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2175_INV_WP> {
+    using scale = pid_fixed::pid_7e2_2175_inv_wp::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2175_inv_wp::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2175_INV_COOLANT> {
+    using scale = pid_fixed::pid_7e2_2175_inv_coolant::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2175_inv_coolant::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2178_INV1_S_D> {
+    using scale = pid_fixed::pid_7e2_2178_inv1_s_d::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2178_inv1_s_d::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2178_INV1_FAIL> {
+    using scale = pid_fixed::pid_7e2_2178_inv1_fail::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2178_inv1_fail::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2178_INV2_S_D> {
+    using scale = pid_fixed::pid_7e2_2178_inv2_s_d::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2178_inv2_s_d::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2178_INV2_FAIL> {
+    using scale = pid_fixed::pid_7e2_2178_inv2_fail::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2178_inv2_fail::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2179_DCTPD> {
+    using scale = pid_fixed::pid_7e2_2179_dctpd::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2179_dctpd::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2179_WP_DUTY> {
+    using scale = pid_fixed::pid_7e2_2179_wp_duty::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2179_wp_duty::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2179_CNV_S_D> {
+    using scale = pid_fixed::pid_7e2_2179_cnv_s_d::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2179_cnv_s_d::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2179_CNV_FAIL> {
+    using scale = pid_fixed::pid_7e2_2179_cnv_fail::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2179_cnv_fail::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_217C_MG1_CF> {
+    using scale = pid_fixed::pid_7e2_217c_mg1_cf::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_217c_mg1_cf::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_217C_MG2_CF> {
+    using scale = pid_fixed::pid_7e2_217c_mg2_cf::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_217c_mg2_cf::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_217D_B_RATIO> {
+    using scale = pid_fixed::pid_7e2_217d_b_ratio::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_217d_b_ratio::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_217D_CNV_CF> {
+    using scale = pid_fixed::pid_7e2_217d_cnv_cf::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_217d_cnv_cf::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V01> {
+    using scale = pid_fixed::pid_7e2_2181_v01::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v01::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V02> {
+    using scale = pid_fixed::pid_7e2_2181_v02::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v02::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V03> {
+    using scale = pid_fixed::pid_7e2_2181_v03::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v03::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V04> {
+    using scale = pid_fixed::pid_7e2_2181_v04::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v04::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V05> {
+    using scale = pid_fixed::pid_7e2_2181_v05::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v05::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V06> {
+    using scale = pid_fixed::pid_7e2_2181_v06::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v06::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V07> {
+    using scale = pid_fixed::pid_7e2_2181_v07::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v07::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V08> {
+    using scale = pid_fixed::pid_7e2_2181_v08::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v08::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V09> {
+    using scale = pid_fixed::pid_7e2_2181_v09::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v09::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V10> {
+    using scale = pid_fixed::pid_7e2_2181_v10::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v10::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V11> {
+    using scale = pid_fixed::pid_7e2_2181_v11::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v11::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V12> {
+    using scale = pid_fixed::pid_7e2_2181_v12::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v12::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V13> {
+    using scale = pid_fixed::pid_7e2_2181_v13::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v13::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_V14> {
+    using scale = pid_fixed::pid_7e2_2181_v14::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_v14::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_AUX_BTY> {
+    using scale = pid_fixed::pid_7e2_2181_aux_bty::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_aux_bty::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_VB> {
+    using scale = pid_fixed::pid_7e2_2181_vb::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_vb::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2181_VMF> {
+    using scale = pid_fixed::pid_7e2_2181_vmf::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2181_vmf::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2187_TB_INTAKE> {
+    using scale = pid_fixed::pid_7e2_2187_tb_intake::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2187_tb_intake::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2187_TB_1> {
+    using scale = pid_fixed::pid_7e2_2187_tb_1::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2187_tb_1::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2187_TB_2> {
+    using scale = pid_fixed::pid_7e2_2187_tb_2::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2187_tb_2::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2187_TB_3> {
+    using scale = pid_fixed::pid_7e2_2187_tb_3::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2187_tb_3::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_218A_IB> {
+    using scale = pid_fixed::pid_7e2_218a_ib::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_218a_ib::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_218E_C_FAN_0> {
+    using scale = pid_fixed::pid_7e2_218e_c_fan_0::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_218e_c_fan_0::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_218E_C_FAN_RLY> {
+    using scale = pid_fixed::pid_7e2_218e_c_fan_rly::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_218e_c_fan_rly::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2192_VMIN> {
+    using scale = pid_fixed::pid_7e2_2192_vmin::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2192_vmin::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2192_BLK_MIN> {
+    using scale = pid_fixed::pid_7e2_2192_blk_min::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2192_blk_min::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2192_VMAX> {
+    using scale = pid_fixed::pid_7e2_2192_vmax::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2192_vmax::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2192_BLK_MAX> {
+    using scale = pid_fixed::pid_7e2_2192_blk_max::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2192_blk_max::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2192_VMAX_VMIN> {
+    using scale = pid_fixed::pid_7e2_2192_vmax_vmin::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2192_vmax_vmin::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2192_BTY_BLK> {
+    using scale = pid_fixed::pid_7e2_2192_bty_blk::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2192_bty_blk::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2192_LOW_COUNT> {
+    using scale = pid_fixed::pid_7e2_2192_low_count::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2192_low_count::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2192_DCI_COUNT> {
+    using scale = pid_fixed::pid_7e2_2192_dci_count::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2192_dci_count::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2192_HIGH_COUNT> {
+    using scale = pid_fixed::pid_7e2_2192_high_count::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2192_high_count::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2192_HOT_COUNT> {
+    using scale = pid_fixed::pid_7e2_2192_hot_count::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2192_hot_count::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R01> {
+    using scale = pid_fixed::pid_7e2_2195_r01::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r01::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R02> {
+    using scale = pid_fixed::pid_7e2_2195_r02::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r02::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R03> {
+    using scale = pid_fixed::pid_7e2_2195_r03::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r03::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R04> {
+    using scale = pid_fixed::pid_7e2_2195_r04::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r04::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R05> {
+    using scale = pid_fixed::pid_7e2_2195_r05::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r05::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R06> {
+    using scale = pid_fixed::pid_7e2_2195_r06::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r06::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R07> {
+    using scale = pid_fixed::pid_7e2_2195_r07::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r07::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R08> {
+    using scale = pid_fixed::pid_7e2_2195_r08::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r08::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R09> {
+    using scale = pid_fixed::pid_7e2_2195_r09::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r09::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R10> {
+    using scale = pid_fixed::pid_7e2_2195_r10::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r10::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R11> {
+    using scale = pid_fixed::pid_7e2_2195_r11::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r11::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R12> {
+    using scale = pid_fixed::pid_7e2_2195_r12::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r12::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R13> {
+    using scale = pid_fixed::pid_7e2_2195_r13::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r13::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2195_R14> {
+    using scale = pid_fixed::pid_7e2_2195_r14::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2195_r14::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2198_BTY_CURR> {
+    using scale = pid_fixed::pid_7e2_2198_bty_curr::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2198_bty_curr::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2198_DELTA_SOC> {
+    using scale = pid_fixed::pid_7e2_2198_delta_soc::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2198_delta_soc::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2198_SOC_IG_ON> {
+    using scale = pid_fixed::pid_7e2_2198_soc_ig_on::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2198_soc_ig_on::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2198_SOC_MAX> {
+    using scale = pid_fixed::pid_7e2_2198_soc_max::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2198_soc_max::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2198_SOC_MIN> {
+    using scale = pid_fixed::pid_7e2_2198_soc_min::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2198_soc_min::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_219B_ECU_MODE> {
+    using scale = pid_fixed::pid_7e2_219b_ecu_mode::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_219b_ecu_mode::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_219B_FAN_MODE> {
+    using scale = pid_fixed::pid_7e2_219b_fan_mode::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_219b_fan_mode::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_219B_SBRS> {
+    using scale = pid_fixed::pid_7e2_219b_sbrs::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_219b_sbrs::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_219B_S_C_WAVE_HI> {
+    using scale = pid_fixed::pid_7e2_219b_s_c_wave_hi::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_219b_s_c_wave_hi::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_21C1_DEST> {
+    using scale = pid_fixed::pid_7e2_21c1_dest::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_21c1_dest::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_21E1_CURR_CODE> {
+    using scale = pid_fixed::pid_7e2_21e1_curr_code::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_21e1_curr_code::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_21E1_HIST_CODE> {
+    using scale = pid_fixed::pid_7e2_21e1_hist_code::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_21e1_hist_code::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_0105_ECT> {
+    using scale = pid_fixed::pid_7e2_0105_ect::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_0105_ect::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2187_TB_INTAKE_C> {
+    using scale = pid_fixed::pid_7e2_2187_tb_intake_c::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2187_tb_intake_c::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2187_TB_1_C> {
+    using scale = pid_fixed::pid_7e2_2187_tb_1_c::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2187_tb_1_c::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2187_TB_2_C> {
+    using scale = pid_fixed::pid_7e2_2187_tb_2_c::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2187_tb_2_c::raw(p); }
+};
+template <> struct PidFixed<PID_7E2_2187_TB_3_C> {
+    using scale = pid_fixed::pid_7e2_2187_tb_3_c::scale;
+    static int32_t raw(const uint8_t* p) { return pid_fixed::pid_7e2_2187_tb_3_c::raw(p); }
+};
+
+constexpr PidRequest pidRequests[PID_REQUEST_COUNT] = {
+    {0x7B0, 0x7B8, 0x21, 0x03, 6},
+    {0x7B0, 0x7B8, 0x21, 0x06, 4},
+    {0x7B0, 0x7B8, 0x21, 0x07, 3},
+    {0x7B0, 0x7B8, 0x21, 0x47, 7},
+    {0x7B0, 0x7B8, 0x21, 0x58, 3},
+    {0x7B0, 0x7B8, 0x21, 0xA3, 8},
+    {0x7B0, 0x7B8, 0x21, 0xA6, 3},
+    {0x7B0, 0x7B8, 0x21, 0xBC, 3},
+    {0x7B0, 0x7B8, 0x21, 0xBE, 5},
+    {0x7C0, 0x7C8, 0x21, 0x12, 3},
+    {0x7C0, 0x7C8, 0x21, 0x13, 3},
+    {0x7C0, 0x7C8, 0x21, 0x29, 3},
+    {0x7C0, 0x7C8, 0x21, 0x41, 3},
+    {0x7C0, 0x7C8, 0x21, 0x68, 3},
+    {0x7C0, 0x7C8, 0x21, 0xA7, 3},
+    {0x7C0, 0x7C8, 0x21, 0xAC, 3},
+    {0x7C4, 0x7CC, 0x21, 0x21, 3},
+    {0x7C4, 0x7CC, 0x21, 0x22, 3},
+    {0x7C4, 0x7CC, 0x21, 0x24, 3},
+    {0x7C4, 0x7CC, 0x21, 0x26, 3},
+    {0x7C4, 0x7CC, 0x21, 0x29, 3},
+    {0x7C4, 0x7CC, 0x21, 0x3C, 3},
+    {0x7C4, 0x7CC, 0x21, 0x3D, 3},
+    {0x7C4, 0x7CC, 0x21, 0x41, 4},
+    {0x7C4, 0x7CC, 0x21, 0x43, 4},
+    {0x7C4, 0x7CC, 0x21, 0x44, 4},
+    {0x7C4, 0x7CC, 0x21, 0x49, 4},
+    {0x7C4, 0x7CC, 0x21, 0x4A, 4},
+    {0x7C4, 0x7CC, 0x21, 0x4B, 3},
+    {0x7C4, 0x7CC, 0x21, 0x4C, 4},
+    {0x7C4, 0x7CC, 0x21, 0x53, 3},
+    {0x7E0, 0x7E8, 0x21, 0x01, 16},
+    {0x7E0, 0x7E8, 0x21, 0x3C, 6},
+    {0x7E0, 0x7E8, 0x21, 0x49, 7},
+    {0x7E2, 0x7EA, 0x01, 0x05, 3},
+    {0x7E2, 0x7EA, 0x01, 0x5B, 3},
+    {0x7E2, 0x7EA, 0x21, 0x01, 24},
+    {0x7E2, 0x7EA, 0x21, 0x41, 10},
+    {0x7E2, 0x7EA, 0x21, 0x61, 7},
+    {0x7E2, 0x7EA, 0x21, 0x62, 7},
+    {0x7E2, 0x7EA, 0x21, 0x67, 7},
+    {0x7E2, 0x7EA, 0x21, 0x68, 7},
+    {0x7E2, 0x7EA, 0x21, 0x70, 6},
+    {0x7E2, 0x7EA, 0x21, 0x71, 6},
+    {0x7E2, 0x7EA, 0x21, 0x74, 11},
+    {0x7E2, 0x7EA, 0x21, 0x75, 6},
+    {0x7E2, 0x7EA, 0x21, 0x78, 4},
+    {0x7E2, 0x7EA, 0x21, 0x79, 6},
+    {0x7E2, 0x7EA, 0x21, 0x7C, 4},
+    {0x7E2, 0x7EA, 0x21, 0x7D, 5},
+    {0x7E2, 0x7EA, 0x21, 0x81, 35},
+    {0x7E2, 0x7EA, 0x21, 0x87, 10},
+    {0x7E2, 0x7EA, 0x21, 0x8A, 4},
+    {0x7E2, 0x7EA, 0x21, 0x8E, 4},
+    {0x7E2, 0x7EA, 0x21, 0x92, 17},
+    {0x7E2, 0x7EA, 0x21, 0x95, 16},
+    {0x7E2, 0x7EA, 0x21, 0x98, 10},
+    {0x7E2, 0x7EA, 0x21, 0x9B, 6},
+    {0x7E2, 0x7EA, 0x21, 0xC1, 18},
+    {0x7E2, 0x7EA, 0x21, 0xE1, 4},
+};
+
+constexpr PidDef pidCatalog[PID_CATALOG_COUNT] = {
+    {PIDREQ_7B0_2103, pid_decode::pid_7b0_2103_fr_ws, "FR WS", "mph", pid_fixed::pid_7b0_2103_fr_ws::raw, pid_fixed::pid_7b0_2103_fr_ws::scale::info()},
+    {PIDREQ_7B0_2103, pid_decode::pid_7b0_2103_fl_ws, "FL WS", "mph", pid_fixed::pid_7b0_2103_fl_ws::raw, pid_fixed::pid_7b0_2103_fl_ws::scale::info()},
+    {PIDREQ_7B0_2103, pid_decode::pid_7b0_2103_rr_ws, "RR WS", "mph", pid_fixed::pid_7b0_2103_rr_ws::raw, pid_fixed::pid_7b0_2103_rr_ws::scale::info()},
+    {PIDREQ_7B0_2103, pid_decode::pid_7b0_2103_rl_ws, "RL WS", "mph", pid_fixed::pid_7b0_2103_rl_ws::raw, pid_fixed::pid_7b0_2103_rl_ws::scale::info()},
+    {PIDREQ_7B0_2106, pid_decode::pid_7b0_2106_yr1, "YR1", "degrees/s", pid_fixed::pid_7b0_2106_yr1::raw, pid_fixed::pid_7b0_2106_yr1::scale::info()},
+    {PIDREQ_7B0_2106, pid_decode::pid_7b0_2106_yr2, "YR2", "degrees/s", pid_fixed::pid_7b0_2106_yr2::raw, pid_fixed::pid_7b0_2106_yr2::scale::info()},
+    {PIDREQ_7B0_2107, pid_decode::pid_7b0_2107_wc_pres, "WC Pres", "V", pid_fixed::pid_7b0_2107_wc_pres::raw, pid_fixed::pid_7b0_2107_wc_pres::scale::info()},
+    {PIDREQ_7B0_2147, pid_decode::pid_7b0_2147_lateral_g, "Lateral G", "m/s2", pid_fixed::pid_7b0_2147_lateral_g::raw, pid_fixed::pid_7b0_2147_lateral_g::scale::info()},
+    {PIDREQ_7B0_2147, pid_decode::pid_7b0_2147_fwd_rwd_g, "Fwd/Rwd G", "m/s2", pid_fixed::pid_7b0_2147_fwd_rwd_g::raw, pid_fixed::pid_7b0_2147_fwd_rwd_g::scale::info()},
+    {PIDREQ_7B0_2147, pid_decode::pid_7b0_2147_yr_val, "YR Val", "degrees/s", pid_fixed::pid_7b0_2147_yr_val::raw, pid_fixed::pid_7b0_2147_yr_val::scale::info()},
+    {PIDREQ_7B0_2147, pid_decode::pid_7b0_2147_steerangle, "SteerAngle", "degrees", pid_fixed::pid_7b0_2147_steerangle::raw, pid_fixed::pid_7b0_2147_steerangle::scale::info()},
+    {PIDREQ_7B0_2158, pid_decode::pid_7b0_2158_regencoop, "RegenCoop", "Off/On", pid_fixed::pid_7b0_2158_regencoop::raw, pid_fixed::pid_7b0_2158_regencoop::scale::info()},
+    {PIDREQ_7B0_21A3, pid_decode::pid_7b0_21a3_sla_curr, "SLA curr", "A", pid_fixed::pid_7b0_21a3_sla_curr::raw, pid_fixed::pid_7b0_21a3_sla_curr::scale::info()},
+    {PIDREQ_7B0_21A3, pid_decode::pid_7b0_21a3_slr_curr, "SLR curr", "A", pid_fixed::pid_7b0_21a3_slr_curr::raw, pid_fixed::pid_7b0_21a3_slr_curr::scale::info()},
+    {PIDREQ_7B0_21A3, pid_decode::pid_7b0_21a3_ssc_curr, "SSC curr", "A", pid_fixed::pid_7b0_21a3_ssc_curr::raw, pid_fixed::pid_7b0_21a3_ssc_curr::scale::info()},
+    {PIDREQ_7B0_21A3, pid_decode::pid_7b0_21a3_scc_curr, "SCC curr", "A", pid_fixed::pid_7b0_21a3_scc_curr::raw, pid_fixed::pid_7b0_21a3_scc_curr::scale::info()},
+    {PIDREQ_7B0_21A3, pid_decode::pid_7b0_21a3_smc_curr, "SMC curr", "A", pid_fixed::pid_7b0_21a3_smc_curr::raw, pid_fixed::pid_7b0_21a3_smc_curr::scale::info()},
+    {PIDREQ_7B0_21A3, pid_decode::pid_7b0_21a3_src_curr, "SRC curr", "A", pid_fixed::pid_7b0_21a3_src_curr::raw, pid_fixed::pid_7b0_21a3_src_curr::scale::info()},
+    {PIDREQ_7B0_21A6, pid_decode::pid_7b0_21a6_insp_mode, "Insp Mode", "Off/On", pid_fixed::pid_7b0_21a6_insp_mode::raw, pid_fixed::pid_7b0_21a6_insp_mode::scale::info()},
+    {PIDREQ_7B0_21BC, pid_decode::pid_7b0_21bc_haz_hist, "Haz Hist", "Off/On", pid_fixed::pid_7b0_21bc_haz_hist::raw, pid_fixed::pid_7b0_21bc_haz_hist::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_frs_open, "FRS Open", "Off/On", pid_fixed::pid_7b0_21be_frs_open::raw, pid_fixed::pid_7b0_21be_frs_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_fls_open, "FLS Open", "Off/On", pid_fixed::pid_7b0_21be_fls_open::raw, pid_fixed::pid_7b0_21be_fls_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_rrs_open, "RRS Open", "Off/On", pid_fixed::pid_7b0_21be_rrs_open::raw, pid_fixed::pid_7b0_21be_rrs_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_rls_open, "RLS Open", "Off/On", pid_fixed::pid_7b0_21be_rls_open::raw, pid_fixed::pid_7b0_21be_rls_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_yr_open, "YR Open", "Off/On", pid_fixed::pid_7b0_21be_yr_open::raw, pid_fixed::pid_7b0_21be_yr_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_decel_open, "Decel Open", "Off/On", pid_fixed::pid_7b0_21be_decel_open::raw, pid_fixed::pid_7b0_21be_decel_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_steer_open, "Steer Open", "Off/On", pid_fixed::pid_7b0_21be_steer_open::raw, pid_fixed::pid_7b0_21be_steer_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_mc_open, "MC Open", "Off/On", pid_fixed::pid_7b0_21be_mc_open::raw, pid_fixed::pid_7b0_21be_mc_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_stroke_open, "Stroke Open", "Off/On", pid_fixed::pid_7b0_21be_stroke_open::raw, pid_fixed::pid_7b0_21be_stroke_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_frwc_open, "FRWC Open", "Off/On", pid_fixed::pid_7b0_21be_frwc_open::raw, pid_fixed::pid_7b0_21be_frwc_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_acc_open, "Acc Open", "Off/On", pid_fixed::pid_7b0_21be_acc_open::raw, pid_fixed::pid_7b0_21be_acc_open::scale::info()},
+    {PIDREQ_7B0_21BE, pid_decode::pid_7b0_21be_hvc_open, "HVC Open", "Off/On", pid_fixed::pid_7b0_21be_hvc_open::raw, pid_fixed::pid_7b0_21be_hvc_open::scale::info()},
+    {PIDREQ_7C0_2112, pid_decode::pid_7c0_2112_tail_cancel, "Tail Cancel", "Off/On", pid_fixed::pid_7c0_2112_tail_cancel::raw, pid_fixed::pid_7c0_2112_tail_cancel::scale::info()},
+    {PIDREQ_7C0_2113, pid_decode::pid_7c0_2113_aux_b_volt, "Aux B Volt", "V", pid_fixed::pid_7c0_2113_aux_b_volt::raw, pid_fixed::pid_7c0_2113_aux_b_volt::scale::info()},
+    {PIDREQ_7C0_2129, pid_decode::pid_7c0_2129_fuel_level, "Fuel Level", "US Gallons", pid_fixed::pid_7c0_2129_fuel_level::raw, pid_fixed::pid_7c0_2129_fuel_level::scale::info()},
+    {PIDREQ_7C0_2141, pid_decode::pid_7c0_2141_oil_chg_dist, "Oil Chg Dist", "mile", pid_fixed::pid_7c0_2141_oil_chg_dist::raw, pid_fixed::pid_7c0_2141_oil_chg_dist::scale::info()},
+    {PIDREQ_7C0_2168, pid_decode::pid_7c0_2168_rheostat, "Rheostat", "Number", pid_fixed::pid_7c0_2168_rheostat::raw, pid_fixed::pid_7c0_2168_rheostat::scale::info()},
+    {PIDREQ_7C0_21A7, pid_decode::pid_7c0_21a7_sbb_query, "SBB Query", "Number", pid_fixed::pid_7c0_21a7_sbb_query::raw, pid_fixed::pid_7c0_21a7_sbb_query::scale::info()},
+    {PIDREQ_7C0_21AC, pid_decode::pid_7c0_21ac_rb_query, "RB Query", "Number", pid_fixed::pid_7c0_21ac_rb_query::raw, pid_fixed::pid_7c0_21ac_rb_query::scale::info()},
+    {PIDREQ_7C4_2121, pid_decode::pid_7c4_2121_room, "Room", "F", pid_fixed::pid_7c4_2121_room::raw, pid_fixed::pid_7c4_2121_room::scale::info()},
+    {PIDREQ_7C4_2122, pid_decode::pid_7c4_2122_ambient, "Ambient", "F", pid_fixed::pid_7c4_2122_ambient::raw, pid_fixed::pid_7c4_2122_ambient::scale::info()},
+    {PIDREQ_7C4_2124, pid_decode::pid_7c4_2124_solar_d, "Solar D", "Number", pid_fixed::pid_7c4_2124_solar_d::raw, pid_fixed::pid_7c4_2124_solar_d::scale::info()},
+    {PIDREQ_7C4_2126, pid_decode::pid_7c4_2126_coolant, "coolant", "F", pid_fixed::pid_7c4_2126_coolant::raw, pid_fixed::pid_7c4_2126_coolant::scale::info()},
+    {PIDREQ_7C4_2129, pid_decode::pid_7c4_2129_set_t_d, "Set t D", "F", pid_fixed::pid_7c4_2129_set_t_d::raw, pid_fixed::pid_7c4_2129_set_t_d::scale::info()},
+    {PIDREQ_7C4_213C, pid_decode::pid_7c4_213c_blower_level, "Blower Level", "Number", pid_fixed::pid_7c4_213c_blower_level::raw, pid_fixed::pid_7c4_213c_blower_level::scale::info()},
+    {PIDREQ_7C4_213D, pid_decode::pid_7c4_213d_adjambient, "AdjAmbient", "F", pid_fixed::pid_7c4_213d_adjambient::raw, pid_fixed::pid_7c4_213d_adjambient::scale::info()},
+    {PIDREQ_7C4_2141, pid_decode::pid_7c4_2141_a_m_stp_d, "A/M STP D", "Number", pid_fixed::pid_7c4_2141_a_m_stp_d::raw, pid_fixed::pid_7c4_2141_a_m_stp_d::scale::info()},
+    {PIDREQ_7C4_2141, pid_decode::pid_7c4_2141_a_m_sap_d, "A/M SAP D", "Number", pid_fixed::pid_7c4_2141_a_m_sap_d::raw, pid_fixed::pid_7c4_2141_a_m_sap_d::scale::info()},
+    {PIDREQ_7C4_2143, pid_decode::pid_7c4_2143_a_o_sp_d, "A/O SP D", "Number", pid_fixed::pid_7c4_2143_a_o_sp_d::raw, pid_fixed::pid_7c4_2143_a_o_sp_d::scale::info()},
+    {PIDREQ_7C4_2143, pid_decode::pid_7c4_2143_a_o_sap_d, "A/O SAP D", "Number", pid_fixed::pid_7c4_2143_a_o_sap_d::raw, pid_fixed::pid_7c4_2143_a_o_sap_d::scale::info()},
+    {PIDREQ_7C4_2144, pid_decode::pid_7c4_2144_a_i_dtp, "A/I DTP", "Number", pid_fixed::pid_7c4_2144_a_i_dtp::raw, pid_fixed::pid_7c4_2144_a_i_dtp::scale::info()},
+    {PIDREQ_7C4_2144, pid_decode::pid_7c4_2144_a_i_dap, "A/I DAP", "Number", pid_fixed::pid_7c4_2144_a_i_dap::raw, pid_fixed::pid_7c4_2144_a_i_dap::scale::info()},
+    {PIDREQ_7C4_2149, pid_decode::pid_7c4_2149_comp_spd, "Comp Spd", "RPM", pid_fixed::pid_7c4_2149_comp_spd::raw, pid_fixed::pid_7c4_2149_comp_spd::scale::info()},
+    {PIDREQ_7C4_214A, pid_decode::pid_7c4_214a_comp_t_spd, "Comp T Spd", "RPM", pid_fixed::pid_7c4_214a_comp_t_spd::raw, pid_fixed::pid_7c4_214a_comp_t_spd::scale::info()},
+    {PIDREQ_7C4_214B, pid_decode::pid_7c4_214b_evap_fin, "Evap Fin", "F", pid_fixed::pid_7c4_214b_evap_fin::raw, pid_fixed::pid_7c4_214b_evap_fin::scale::info()},
+    {PIDREQ_7C4_214C, pid_decode::pid_7c4_214c_evap_tgt, "Evap Tgt", "F", pid_fixed::pid_7c4_214c_evap_tgt::raw, pid_fixed::pid_7c4_214c_evap_tgt::scale::info()},
+    {PIDREQ_7C4_2153, pid_decode::pid_7c4_2153_reg_pres, "Reg Pres", "PSIG", nullptr, {1, 1, 0, 1}},
+    {PIDREQ_7E0_2101, pid_decode::pid_7e0_2101_cal_d_load, "Cal'd Load", "%", pid_fixed::pid_7e0_2101_cal_d_load::raw, pid_fixed::pid_7e0_2101_cal_d_load::scale::info()},
+    {PIDREQ_7E0_2101, pid_decode::pid_7e0_2101_veh_load, "Veh Load", "%", pid_fixed::pid_7e0_2101_veh_load::raw, pid_fixed::pid_7e0_2101_veh_load::scale::info()},
+    {PIDREQ_7E0_2101, pid_decode::pid_7e0_2101_maf, "MAF", "gm/sec", pid_fixed::pid_7e0_2101_maf::raw, pid_fixed::pid_7e0_2101_maf::scale::info()},
+    {PIDREQ_7E0_2101, pid_decode::pid_7e0_2101_map, "MAP", "mmHg", pid_fixed::pid_7e0_2101_map::raw, pid_fixed::pid_7e0_2101_map::scale::info()},
+    {PIDREQ_7E0_2101, pid_decode::pid_7e0_2101_iat, "IAT", "F", pid_fixed::pid_7e0_2101_iat::raw, pid_fixed::pid_7e0_2101_iat::scale::info()},
+    {PIDREQ_7E0_2101, pid_decode::pid_7e0_2101_atmpres, "AtmPres", "mmHg", pid_fixed::pid_7e0_2101_atmpres::raw, pid_fixed::pid_7e0_2101_atmpres::scale::info()},
+    {PIDREQ_7E0_2101, pid_decode::pid_7e0_2101_coolant, "Coolant", "F", pid_fixed::pid_7e0_2101_coolant::raw, pid_fixed::pid_7e0_2101_coolant::scale::info()},
+    {PIDREQ_7E0_2101, pid_decode::pid_7e0_2101_rpm, "RPM", "RPM", pid_fixed::pid_7e0_2101_rpm::raw, pid_fixed::pid_7e0_2101_rpm::scale::info()},
+    {PIDREQ_7E0_2101, pid_decode::pid_7e0_2101_mph, "MPH", "mph", pid_fixed::pid_7e0_2101_mph::raw, pid_fixed::pid_7e0_2101_mph::scale::info()},
+    {PIDREQ_7E0_2101, pid_decode::pid_7e0_2101_ign_time, "Ign Time", "sec.", pid_fixed::pid_7e0_2101_ign_time::raw, pid_fixed::pid_7e0_2101_ign_time::scale::info()},
+    {PIDREQ_7E0_213C, pid_decode::pid_7e0_213c_inj_vol, "Inj Vol", "fl oz", nullptr, {1, 1, 0, 1}},
+    {PIDREQ_7E0_213C, pid_decode::pid_7e0_213c_inj_dur, "Inj Dur", "micro sec.", pid_fixed::pid_7e0_213c_inj_dur::raw, pid_fixed::pid_7e0_213c_inj_dur::scale::info()},
+    {PIDREQ_7E0_2149, pid_decode::pid_7e0_2149_actengtorq, "ActEngTorq", "ft?lb", pid_fixed::pid_7e0_2149_actengtorq::raw, pid_fixed::pid_7e0_2149_actengtorq::scale::info()},
+    {PIDREQ_7E2_015B, pid_decode::pid_7e2_015b_soc, "SoC", "%", pid_fixed::pid_7e2_015b_soc::raw, pid_fixed::pid_7e2_015b_soc::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_cal_d_load, "cal'd load", "%", pid_fixed::pid_7e2_2101_cal_d_load::raw, pid_fixed::pid_7e2_2101_cal_d_load::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_map, "map", "mmHg", pid_fixed::pid_7e2_2101_map::raw, pid_fixed::pid_7e2_2101_map::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_iat, "iat", "F", pid_fixed::pid_7e2_2101_iat::raw, pid_fixed::pid_7e2_2101_iat::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_ambient, "ambient", "F", pid_fixed::pid_7e2_2101_ambient::raw, pid_fixed::pid_7e2_2101_ambient::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_atmpres, "atmpres", "mmHg", pid_fixed::pid_7e2_2101_atmpres::raw, pid_fixed::pid_7e2_2101_atmpres::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_coolant, "coolant", "F", pid_fixed::pid_7e2_2101_coolant::raw, pid_fixed::pid_7e2_2101_coolant::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_rpm, "rpm", "RPM", pid_fixed::pid_7e2_2101_rpm::raw, pid_fixed::pid_7e2_2101_rpm::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_mph, "mph", "mph", pid_fixed::pid_7e2_2101_mph::raw, pid_fixed::pid_7e2_2101_mph::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_ign_time, "ign time", "sec.", pid_fixed::pid_7e2_2101_ign_time::raw, pid_fixed::pid_7e2_2101_ign_time::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_throttle, "Throttle", "%", pid_fixed::pid_7e2_2101_throttle::raw, pid_fixed::pid_7e2_2101_throttle::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_ap1, "AP1", "%", pid_fixed::pid_7e2_2101_ap1::raw, pid_fixed::pid_7e2_2101_ap1::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_ap2, "AP2", "%", pid_fixed::pid_7e2_2101_ap2::raw, pid_fixed::pid_7e2_2101_ap2::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_dtc_warm, "DTC warm", "Number", pid_fixed::pid_7e2_2101_dtc_warm::raw, pid_fixed::pid_7e2_2101_dtc_warm::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_dtc_dist, "DTC dist", "mile", pid_fixed::pid_7e2_2101_dtc_dist::raw, pid_fixed::pid_7e2_2101_dtc_dist::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_dtc_time, "DTC time", "minutes", pid_fixed::pid_7e2_2101_dtc_time::raw, pid_fixed::pid_7e2_2101_dtc_time::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_b, "+B", "V", pid_fixed::pid_7e2_2101_b::raw, pid_fixed::pid_7e2_2101_b::scale::info()},
+    {PIDREQ_7E2_2101, pid_decode::pid_7e2_2101_soc_all, "SOC (All)", "%", pid_fixed::pid_7e2_2101_soc_all::raw, pid_fixed::pid_7e2_2101_soc_all::scale::info()},
+    {PIDREQ_7E2_2141, pid_decode::pid_7e2_2141_shift_m, "Shift M", "V", pid_fixed::pid_7e2_2141_shift_m::raw, pid_fixed::pid_7e2_2141_shift_m::scale::info()},
+    {PIDREQ_7E2_2141, pid_decode::pid_7e2_2141_shift_s, "Shift S", "V", pid_fixed::pid_7e2_2141_shift_s::raw, pid_fixed::pid_7e2_2141_shift_s::scale::info()},
+    {PIDREQ_7E2_2141, pid_decode::pid_7e2_2141_shift_sel_m, "Shift Sel M", "V", pid_fixed::pid_7e2_2141_shift_sel_m::raw, pid_fixed::pid_7e2_2141_shift_sel_m::scale::info()},
+    {PIDREQ_7E2_2141, pid_decode::pid_7e2_2141_shift_sel_s, "Shift Sel S", "V", pid_fixed::pid_7e2_2141_shift_sel_s::raw, pid_fixed::pid_7e2_2141_shift_sel_s::scale::info()},
+    {PIDREQ_7E2_2141, pid_decode::pid_7e2_2141_aux_b_t, "Aux. B t", "F", pid_fixed::pid_7e2_2141_aux_b_t::raw, pid_fixed::pid_7e2_2141_aux_b_t::scale::info()},
+    {PIDREQ_7E2_2141, pid_decode::pid_7e2_2141_rpm_sensor, "RPM sensor", "RPM", pid_fixed::pid_7e2_2141_rpm_sensor::raw, pid_fixed::pid_7e2_2141_rpm_sensor::scale::info()},
+    {PIDREQ_7E2_2141, pid_decode::pid_7e2_2141_p_pos_volt, "P Pos Volt", "V", nullptr, {1, 1, 0, 1}},
+    {PIDREQ_7E2_2161, pid_decode::pid_7e2_2161_mg1t, "MG1t", "F", pid_fixed::pid_7e2_2161_mg1t::raw, pid_fixed::pid_7e2_2161_mg1t::scale::info()},
+    {PIDREQ_7E2_2161, pid_decode::pid_7e2_2161_mg1t_ign, "MG1t Ign", "F", pid_fixed::pid_7e2_2161_mg1t_ign::raw, pid_fixed::pid_7e2_2161_mg1t_ign::scale::info()},
+    {PIDREQ_7E2_2161, pid_decode::pid_7e2_2161_mg1t_max, "MG1t max", "F", pid_fixed::pid_7e2_2161_mg1t_max::raw, pid_fixed::pid_7e2_2161_mg1t_max::scale::info()},
+    {PIDREQ_7E2_2161, pid_decode::pid_7e2_2161_mg1_rpm, "MG1 rpm", "RPM", pid_fixed::pid_7e2_2161_mg1_rpm::raw, pid_fixed::pid_7e2_2161_mg1_rpm::scale::info()},
+    {PIDREQ_7E2_2162, pid_decode::pid_7e2_2162_mg2t, "MG2t", "F", pid_fixed::pid_7e2_2162_mg2t::raw, pid_fixed::pid_7e2_2162_mg2t::scale::info()},
+    {PIDREQ_7E2_2162, pid_decode::pid_7e2_2162_mg2t_ign, "MG2t Ign", "F", pid_fixed::pid_7e2_2162_mg2t_ign::raw, pid_fixed::pid_7e2_2162_mg2t_ign::scale::info()},
+    {PIDREQ_7E2_2162, pid_decode::pid_7e2_2162_mg2t_max, "MG2t max", "F", pid_fixed::pid_7e2_2162_mg2t_max::raw, pid_fixed::pid_7e2_2162_mg2t_max::scale::info()},
+    {PIDREQ_7E2_2162, pid_decode::pid_7e2_2162_mg2_rpm, "MG2 rpm", "RPM", pid_fixed::pid_7e2_2162_mg2_rpm::raw, pid_fixed::pid_7e2_2162_mg2_rpm::scale::info()},
+    {PIDREQ_7E2_2167, pid_decode::pid_7e2_2167_mg1_torq, "MG1 Torq", "ft?lb", pid_fixed::pid_7e2_2167_mg1_torq::raw, pid_fixed::pid_7e2_2167_mg1_torq::scale::info()},
+    {PIDREQ_7E2_2167, pid_decode::pid_7e2_2167_mg1_e_torq, "MG1 E Torq", "ft?lb", pid_fixed::pid_7e2_2167_mg1_e_torq::raw, pid_fixed::pid_7e2_2167_mg1_e_torq::scale::info()},
+    {PIDREQ_7E2_2167, pid_decode::pid_7e2_2167_mg1_mode, "MG1 mode", "Number", pid_fixed::pid_7e2_2167_mg1_mode::raw, pid_fixed::pid_7e2_2167_mg1_mode::scale::info()},
+    {PIDREQ_7E2_2168, pid_decode::pid_7e2_2168_mg2_torq, "MG2 Torq", "ft?lb", pid_fixed::pid_7e2_2168_mg2_torq::raw, pid_fixed::pid_7e2_2168_mg2_torq::scale::info()},
+    {PIDREQ_7E2_2168, pid_decode::pid_7e2_2168_mg2_e_torq, "MG2 E Torq", "ft?lb", pid_fixed::pid_7e2_2168_mg2_e_torq::raw, pid_fixed::pid_7e2_2168_mg2_e_torq::scale::info()},
+    {PIDREQ_7E2_2168, pid_decode::pid_7e2_2168_mg2_mode, "MG2 mode", "Number", pid_fixed::pid_7e2_2168_mg2_mode::raw, pid_fixed::pid_7e2_2168_mg2_mode::scale::info()},
+    {PIDREQ_7E2_2170, pid_decode::pid_7e2_2170_inv1t, "Inv1t", "F", pid_fixed::pid_7e2_2170_inv1t::raw, pid_fixed::pid_7e2_2170_inv1t::scale::info()},
+    {PIDREQ_7E2_2170, pid_decode::pid_7e2_2170_inv1t_ign, "Inv1t Ign", "F", pid_fixed::pid_7e2_2170_inv1t_ign::raw, pid_fixed::pid_7e2_2170_inv1t_ign::scale::info()},
+    {PIDREQ_7E2_2170, pid_decode::pid_7e2_2170_inv1t_max, "Inv1t max", "F", pid_fixed::pid_7e2_2170_inv1t_max::raw, pid_fixed::pid_7e2_2170_inv1t_max::scale::info()},
+    {PIDREQ_7E2_2170, pid_decode::pid_7e2_2170_mg1_gate, "MG1 Gate", "Off/On", pid_fixed::pid_7e2_2170_mg1_gate::raw, pid_fixed::pid_7e2_2170_mg1_gate::scale::info()},
+    {PIDREQ_7E2_2171, pid_decode::pid_7e2_2171_inv2t, "Inv2t", "F", pid_fixed::pid_7e2_2171_inv2t::raw, pid_fixed::pid_7e2_2171_inv2t::scale::info()},
+    {PIDREQ_7E2_2171, pid_decode::pid_7e2_2171_inv2t_ign, "Inv2t Ign", "F", pid_fixed::pid_7e2_2171_inv2t_ign::raw, pid_fixed::pid_7e2_2171_inv2t_ign::scale::info()},
+    {PIDREQ_7E2_2171, pid_decode::pid_7e2_2171_inv2t_max, "Inv2t max", "F", pid_fixed::pid_7e2_2171_inv2t_max::raw, pid_fixed::pid_7e2_2171_inv2t_max::scale::info()},
+    {PIDREQ_7E2_2171, pid_decode::pid_7e2_2171_mg2_gate, "MG2 Gate", "Off/On", pid_fixed::pid_7e2_2171_mg2_gate::raw, pid_fixed::pid_7e2_2171_mg2_gate::scale::info()},
+    {PIDREQ_7E2_2174, pid_decode::pid_7e2_2174_bc_u, "BC U", "F", pid_fixed::pid_7e2_2174_bc_u::raw, pid_fixed::pid_7e2_2174_bc_u::scale::info()},
+    {PIDREQ_7E2_2174, pid_decode::pid_7e2_2174_bc_l, "BC L", "F", pid_fixed::pid_7e2_2174_bc_l::raw, pid_fixed::pid_7e2_2174_bc_l::scale::info()},
+    {PIDREQ_7E2_2174, pid_decode::pid_7e2_2174_bc_ign, "BC Ign", "F", pid_fixed::pid_7e2_2174_bc_ign::raw, pid_fixed::pid_7e2_2174_bc_ign::scale::info()},
+    {PIDREQ_7E2_2174, pid_decode::pid_7e2_2174_bc_max, "BC max", "F", pid_fixed::pid_7e2_2174_bc_max::raw, pid_fixed::pid_7e2_2174_bc_max::scale::info()},
+    {PIDREQ_7E2_2174, pid_decode::pid_7e2_2174_cnv_gate, "Cnv Gate", "Off/On", pid_fixed::pid_7e2_2174_cnv_gate::raw, pid_fixed::pid_7e2_2174_cnv_gate::scale::info()},
+    {PIDREQ_7E2_2174, pid_decode::pid_7e2_2174_o_v_i_p_cnv, "O/V I/P Cnv", "Off/On", pid_fixed::pid_7e2_2174_o_v_i_p_cnv::raw, pid_fixed::pid_7e2_2174_o_v_i_p_cnv::scale::info()},
+    {PIDREQ_7E2_2174, pid_decode::pid_7e2_2174_o_v_i_p_inv, "O/V I/P Inv", "Off/On", pid_fixed::pid_7e2_2174_o_v_i_p_inv::raw, pid_fixed::pid_7e2_2174_o_v_i_p_inv::scale::info()},
+    {PIDREQ_7E2_2174, pid_decode::pid_7e2_2174_vlb, "VLB", "V", pid_fixed::pid_7e2_2174_vlb::raw, pid_fixed::pid_7e2_2174_vlb::scale::info()},
+    {PIDREQ_7E2_2174, pid_decode::pid_7e2_2174_vhb, "VHB", "V", pid_fixed::pid_7e2_2174_vhb::raw, pid_fixed::pid_7e2_2174_vhb::scale::info()},
+    {PIDREQ_7E2_2175, pid_decode::pid_7e2_2175_p_dcdc, "P DCDC", "Off/On", pid_fixed::pid_7e2_2175_p_dcdc::raw, pid_fixed::pid_7e2_2175_p_dcdc::scale::info()},
+    {PIDREQ_7E2_2175, pid_decode::pid_7e2_2175_a_c_gate, "A/C Gate", "Off/On", pid_fixed::pid_7e2_2175_a_c_gate::raw, pid_fixed::pid_7e2_2175_a_c_gate::scale::info()},
+    {PIDREQ_7E2_2175, pid_decode::pid_7e2_2175_wp_run, "WP run", "Off/On", pid_fixed::pid_7e2_2175_wp_run::raw, pid_fixed::pid_7e2_2175_wp_run::scale::info()},
+    {PIDREQ_7E2_2175, pid_decode::pid_7e2_2175_inv_wp, "Inv WP", "RPM", pid_fixed::pid_7e2_2175_inv_wp::raw, pid_fixed::pid_7e2_2175_inv_wp::scale::info()},
+    {PIDREQ_7E2_2175, pid_decode::pid_7e2_2175_inv_coolant, "Inv Coolant", "F", pid_fixed::pid_7e2_2175_inv_coolant::raw, pid_fixed::pid_7e2_2175_inv_coolant::scale::info()},
+    {PIDREQ_7E2_2178, pid_decode::pid_7e2_2178_inv1_s_d, "Inv1 S/D", "Off/On", pid_fixed::pid_7e2_2178_inv1_s_d::raw, pid_fixed::pid_7e2_2178_inv1_s_d::scale::info()},
+    {PIDREQ_7E2_2178, pid_decode::pid_7e2_2178_inv1_fail, "Inv1 fail", "Off/On", pid_fixed::pid_7e2_2178_inv1_fail::raw, pid_fixed::pid_7e2_2178_inv1_fail::scale::info()},
+    {PIDREQ_7E2_2178, pid_decode::pid_7e2_2178_inv2_s_d, "Inv2 S/D", "Off/On", pid_fixed::pid_7e2_2178_inv2_s_d::raw, pid_fixed::pid_7e2_2178_inv2_s_d::scale::info()},
+    {PIDREQ_7E2_2178, pid_decode::pid_7e2_2178_inv2_fail, "Inv2 fail", "Off/On", pid_fixed::pid_7e2_2178_inv2_fail::raw, pid_fixed::pid_7e2_2178_inv2_fail::scale::info()},
+    {PIDREQ_7E2_2179, pid_decode::pid_7e2_2179_dctpd, "DCTPD", "%", pid_fixed::pid_7e2_2179_dctpd::raw, pid_fixed::pid_7e2_2179_dctpd::scale::info()},
+    {PIDREQ_7E2_2179, pid_decode::pid_7e2_2179_wp_duty, "WP Duty", "%", pid_fixed::pid_7e2_2179_wp_duty::raw, pid_fixed::pid_7e2_2179_wp_duty::scale::info()},
+    {PIDREQ_7E2_2179, pid_decode::pid_7e2_2179_cnv_s_d, "Cnv S/D", "Off/On", pid_fixed::pid_7e2_2179_cnv_s_d::raw, pid_fixed::pid_7e2_2179_cnv_s_d::scale::info()},
+    {PIDREQ_7E2_2179, pid_decode::pid_7e2_2179_cnv_fail, "Cnv fail", "Off/On", pid_fixed::pid_7e2_2179_cnv_fail::raw, pid_fixed::pid_7e2_2179_cnv_fail::scale::info()},
+    {PIDREQ_7E2_217C, pid_decode::pid_7e2_217c_mg1_cf, "MG1 CF", "kHz", pid_fixed::pid_7e2_217c_mg1_cf::raw, pid_fixed::pid_7e2_217c_mg1_cf::scale::info()},
+    {PIDREQ_7E2_217C, pid_decode::pid_7e2_217c_mg2_cf, "MG2 CF", "kHz", pid_fixed::pid_7e2_217c_mg2_cf::raw, pid_fixed::pid_7e2_217c_mg2_cf::scale::info()},
+    {PIDREQ_7E2_217D, pid_decode::pid_7e2_217d_b_ratio, "B Ratio", "%", pid_fixed::pid_7e2_217d_b_ratio::raw, pid_fixed::pid_7e2_217d_b_ratio::scale::info()},
+    {PIDREQ_7E2_217D, pid_decode::pid_7e2_217d_cnv_cf, "Cnv CF", "Number", pid_fixed::pid_7e2_217d_cnv_cf::raw, pid_fixed::pid_7e2_217d_cnv_cf::scale::info()},
+    {PIDREQ_7E2_217D, pid_decode::pid_7e2_217d_a_c_pwr, "A/C pwr", "HP", nullptr, {1, 1, 0, 1}},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v01, "V01", "V", pid_fixed::pid_7e2_2181_v01::raw, pid_fixed::pid_7e2_2181_v01::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v02, "V02", "V", pid_fixed::pid_7e2_2181_v02::raw, pid_fixed::pid_7e2_2181_v02::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v03, "V03", "V", pid_fixed::pid_7e2_2181_v03::raw, pid_fixed::pid_7e2_2181_v03::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v04, "V04", "V", pid_fixed::pid_7e2_2181_v04::raw, pid_fixed::pid_7e2_2181_v04::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v05, "V05", "V", pid_fixed::pid_7e2_2181_v05::raw, pid_fixed::pid_7e2_2181_v05::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v06, "V06", "V", pid_fixed::pid_7e2_2181_v06::raw, pid_fixed::pid_7e2_2181_v06::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v07, "V07", "V", pid_fixed::pid_7e2_2181_v07::raw, pid_fixed::pid_7e2_2181_v07::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v08, "V08", "V", pid_fixed::pid_7e2_2181_v08::raw, pid_fixed::pid_7e2_2181_v08::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v09, "V09", "V", pid_fixed::pid_7e2_2181_v09::raw, pid_fixed::pid_7e2_2181_v09::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v10, "V10", "V", pid_fixed::pid_7e2_2181_v10::raw, pid_fixed::pid_7e2_2181_v10::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v11, "V11", "V", pid_fixed::pid_7e2_2181_v11::raw, pid_fixed::pid_7e2_2181_v11::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v12, "V12", "V", pid_fixed::pid_7e2_2181_v12::raw, pid_fixed::pid_7e2_2181_v12::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v13, "V13", "V", pid_fixed::pid_7e2_2181_v13::raw, pid_fixed::pid_7e2_2181_v13::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_v14, "V14", "V", pid_fixed::pid_7e2_2181_v14::raw, pid_fixed::pid_7e2_2181_v14::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_aux_bty, "Aux Bty", "V", pid_fixed::pid_7e2_2181_aux_bty::raw, pid_fixed::pid_7e2_2181_aux_bty::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_vb, "VB", "V", pid_fixed::pid_7e2_2181_vb::raw, pid_fixed::pid_7e2_2181_vb::scale::info()},
+    {PIDREQ_7E2_2181, pid_decode::pid_7e2_2181_vmf, "VMF", "V", pid_fixed::pid_7e2_2181_vmf::raw, pid_fixed::pid_7e2_2181_vmf::scale::info()},
+    {PIDREQ_7E2_2187, pid_decode::pid_7e2_2187_tb_intake, "TB Intake", "F", pid_fixed::pid_7e2_2187_tb_intake::raw, pid_fixed::pid_7e2_2187_tb_intake::scale::info()},
+    {PIDREQ_7E2_2187, pid_decode::pid_7e2_2187_tb_1, "TB 1", "F", pid_fixed::pid_7e2_2187_tb_1::raw, pid_fixed::pid_7e2_2187_tb_1::scale::info()},
+    {PIDREQ_7E2_2187, pid_decode::pid_7e2_2187_tb_2, "TB 2", "F", pid_fixed::pid_7e2_2187_tb_2::raw, pid_fixed::pid_7e2_2187_tb_2::scale::info()},
+    {PIDREQ_7E2_2187, pid_decode::pid_7e2_2187_tb_3, "TB 3", "F", pid_fixed::pid_7e2_2187_tb_3::raw, pid_fixed::pid_7e2_2187_tb_3::scale::info()},
+    {PIDREQ_7E2_218A, pid_decode::pid_7e2_218a_ib, "IB", "Amperes", pid_fixed::pid_7e2_218a_ib::raw, pid_fixed::pid_7e2_218a_ib::scale::info()},
+    {PIDREQ_7E2_218E, pid_decode::pid_7e2_218e_c_fan_0, "C Fan 0", "%", pid_fixed::pid_7e2_218e_c_fan_0::raw, pid_fixed::pid_7e2_218e_c_fan_0::scale::info()},
+    {PIDREQ_7E2_218E, pid_decode::pid_7e2_218e_c_fan_rly, "C Fan Rly", "Off/On", pid_fixed::pid_7e2_218e_c_fan_rly::raw, pid_fixed::pid_7e2_218e_c_fan_rly::scale::info()},
+    {PIDREQ_7E2_2192, pid_decode::pid_7e2_2192_vmin, "Vmin", "V", pid_fixed::pid_7e2_2192_vmin::raw, pid_fixed::pid_7e2_2192_vmin::scale::info()},
+    {PIDREQ_7E2_2192, pid_decode::pid_7e2_2192_blk_min, "Blk# min", "Number", pid_fixed::pid_7e2_2192_blk_min::raw, pid_fixed::pid_7e2_2192_blk_min::scale::info()},
+    {PIDREQ_7E2_2192, pid_decode::pid_7e2_2192_vmax, "Vmax", "V", pid_fixed::pid_7e2_2192_vmax::raw, pid_fixed::pid_7e2_2192_vmax::scale::info()},
+    {PIDREQ_7E2_2192, pid_decode::pid_7e2_2192_blk_max, "Blk# max", "Number", pid_fixed::pid_7e2_2192_blk_max::raw, pid_fixed::pid_7e2_2192_blk_max::scale::info()},
+    {PIDREQ_7E2_2192, pid_decode::pid_7e2_2192_vmax_vmin, "Vmax-Vmin", "V", pid_fixed::pid_7e2_2192_vmax_vmin::raw, pid_fixed::pid_7e2_2192_vmax_vmin::scale::info()},
+    {PIDREQ_7E2_2192, pid_decode::pid_7e2_2192_bty_blk, "#Bty Blk", "Number", pid_fixed::pid_7e2_2192_bty_blk::raw, pid_fixed::pid_7e2_2192_bty_blk::scale::info()},
+    {PIDREQ_7E2_2192, pid_decode::pid_7e2_2192_low_count, "Low count", "Number", pid_fixed::pid_7e2_2192_low_count::raw, pid_fixed::pid_7e2_2192_low_count::scale::info()},
+    {PIDREQ_7E2_2192, pid_decode::pid_7e2_2192_dci_count, "DCI count", "Number", pid_fixed::pid_7e2_2192_dci_count::raw, pid_fixed::pid_7e2_2192_dci_count::scale::info()},
+    {PIDREQ_7E2_2192, pid_decode::pid_7e2_2192_high_count, "High count", "Number", pid_fixed::pid_7e2_2192_high_count::raw, pid_fixed::pid_7e2_2192_high_count::scale::info()},
+    {PIDREQ_7E2_2192, pid_decode::pid_7e2_2192_hot_count, "Hot count", "Number", pid_fixed::pid_7e2_2192_hot_count::raw, pid_fixed::pid_7e2_2192_hot_count::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r01, "R01", "ohm", pid_fixed::pid_7e2_2195_r01::raw, pid_fixed::pid_7e2_2195_r01::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r02, "R02", "ohm", pid_fixed::pid_7e2_2195_r02::raw, pid_fixed::pid_7e2_2195_r02::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r03, "R03", "ohm", pid_fixed::pid_7e2_2195_r03::raw, pid_fixed::pid_7e2_2195_r03::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r04, "R04", "ohm", pid_fixed::pid_7e2_2195_r04::raw, pid_fixed::pid_7e2_2195_r04::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r05, "R05", "ohm", pid_fixed::pid_7e2_2195_r05::raw, pid_fixed::pid_7e2_2195_r05::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r06, "R06", "ohm", pid_fixed::pid_7e2_2195_r06::raw, pid_fixed::pid_7e2_2195_r06::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r07, "R07", "ohm", pid_fixed::pid_7e2_2195_r07::raw, pid_fixed::pid_7e2_2195_r07::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r08, "R08", "ohm", pid_fixed::pid_7e2_2195_r08::raw, pid_fixed::pid_7e2_2195_r08::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r09, "R09", "ohm", pid_fixed::pid_7e2_2195_r09::raw, pid_fixed::pid_7e2_2195_r09::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r10, "R10", "ohm", pid_fixed::pid_7e2_2195_r10::raw, pid_fixed::pid_7e2_2195_r10::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r11, "R11", "ohm", pid_fixed::pid_7e2_2195_r11::raw, pid_fixed::pid_7e2_2195_r11::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r12, "R12", "ohm", pid_fixed::pid_7e2_2195_r12::raw, pid_fixed::pid_7e2_2195_r12::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r13, "R13", "ohm", pid_fixed::pid_7e2_2195_r13::raw, pid_fixed::pid_7e2_2195_r13::scale::info()},
+    {PIDREQ_7E2_2195, pid_decode::pid_7e2_2195_r14, "R14", "ohm", pid_fixed::pid_7e2_2195_r14::raw, pid_fixed::pid_7e2_2195_r14::scale::info()},
+    {PIDREQ_7E2_2198, pid_decode::pid_7e2_2198_bty_curr, "Bty Curr", "Amperes", pid_fixed::pid_7e2_2198_bty_curr::raw, pid_fixed::pid_7e2_2198_bty_curr::scale::info()},
+    {PIDREQ_7E2_2198, pid_decode::pid_7e2_2198_dischg_ctrl, "Dischg ctrl", "HP", nullptr, {1, 1, 0, 1}},
+    {PIDREQ_7E2_2198, pid_decode::pid_7e2_2198_chg_ctrl, "Chg ctrl", "HP", nullptr, {1, 1, 0, 1}},
+    {PIDREQ_7E2_2198, pid_decode::pid_7e2_2198_delta_soc, "Delta SOC", "%", pid_fixed::pid_7e2_2198_delta_soc::raw, pid_fixed::pid_7e2_2198_delta_soc::scale::info()},
+    {PIDREQ_7E2_2198, pid_decode::pid_7e2_2198_soc_ig_on, "SOC ig-on", "%", pid_fixed::pid_7e2_2198_soc_ig_on::raw, pid_fixed::pid_7e2_2198_soc_ig_on::scale::info()},
+    {PIDREQ_7E2_2198, pid_decode::pid_7e2_2198_soc_max, "SOC max", "%", pid_fixed::pid_7e2_2198_soc_max::raw, pid_fixed::pid_7e2_2198_soc_max::scale::info()},
+    {PIDREQ_7E2_2198, pid_decode::pid_7e2_2198_soc_min, "SOC min", "%", pid_fixed::pid_7e2_2198_soc_min::raw, pid_fixed::pid_7e2_2198_soc_min::scale::info()},
+    {PIDREQ_7E2_219B, pid_decode::pid_7e2_219b_ecu_mode, "ECU mode", "Number", pid_fixed::pid_7e2_219b_ecu_mode::raw, pid_fixed::pid_7e2_219b_ecu_mode::scale::info()},
+    {PIDREQ_7E2_219B, pid_decode::pid_7e2_219b_fan_mode, "Fan Mode", "Number", pid_fixed::pid_7e2_219b_fan_mode::raw, pid_fixed::pid_7e2_219b_fan_mode::scale::info()},
+    {PIDREQ_7E2_219B, pid_decode::pid_7e2_219b_sbrs, "SBRS", "Off/On", pid_fixed::pid_7e2_219b_sbrs::raw, pid_fixed::pid_7e2_219b_sbrs::scale::info()},
+    {PIDREQ_7E2_219B, pid_decode::pid_7e2_219b_s_c_wave_hi, "S/C Wave Hi", "V", pid_fixed::pid_7e2_219b_s_c_wave_hi::raw, pid_fixed::pid_7e2_219b_s_c_wave_hi::scale::info()},
+    {PIDREQ_7E2_21C1, pid_decode::pid_7e2_21c1_dest, "Dest", "Number", pid_fixed::pid_7e2_21c1_dest::raw, pid_fixed::pid_7e2_21c1_dest::scale::info()},
+    {PIDREQ_7E2_21E1, pid_decode::pid_7e2_21e1_curr_code, "#Curr Code", "Number", pid_fixed::pid_7e2_21e1_curr_code::raw, pid_fixed::pid_7e2_21e1_curr_code::scale::info()},
+    {PIDREQ_7E2_21E1, pid_decode::pid_7e2_21e1_hist_code, "#Hist Code", "Number", pid_fixed::pid_7e2_21e1_hist_code::raw, pid_fixed::pid_7e2_21e1_hist_code::scale::info()},
+    {PIDREQ_7E2_0105, pid_decode::pid_7e2_0105_ect, "ECT", "C", pid_fixed::pid_7e2_0105_ect::raw, pid_fixed::pid_7e2_0105_ect::scale::info()},
+    {PIDREQ_7E2_2187, pid_decode::pid_7e2_2187_tb_intake_c, "TB Intake C", "C", pid_fixed::pid_7e2_2187_tb_intake_c::raw, pid_fixed::pid_7e2_2187_tb_intake_c::scale::info()},
+    {PIDREQ_7E2_2187, pid_decode::pid_7e2_2187_tb_1_c, "TB 1 C", "C", pid_fixed::pid_7e2_2187_tb_1_c::raw, pid_fixed::pid_7e2_2187_tb_1_c::scale::info()},
+    {PIDREQ_7E2_2187, pid_decode::pid_7e2_2187_tb_2_c, "TB 2 C", "C", pid_fixed::pid_7e2_2187_tb_2_c::raw, pid_fixed::pid_7e2_2187_tb_2_c::scale::info()},
+    {PIDREQ_7E2_2187, pid_decode::pid_7e2_2187_tb_3_c, "TB 3 C", "C", pid_fixed::pid_7e2_2187_tb_3_c::raw, pid_fixed::pid_7e2_2187_tb_3_c::scale::info()},
+};
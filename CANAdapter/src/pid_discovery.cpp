@@ -0,0 +1,324 @@
+#include "pid_discovery.h"
+
+#include <Preferences.h>
+
+#include "pid_catalog.h"
+
+namespace {
+
+constexpr uint8_t MAX_ECUS = 8;
+constexpr uint8_t CAPS_VERSION = 2;  // 1 could cache timeouts as unsupported
+constexpr const char* NVS_NAMESPACE = "pidcaps";
+
+constexpr uint8_t SVC_MODE01 = 0x01;
+constexpr uint8_t SVC_MODE09 = 0x09;
+constexpr uint8_t SVC_LOCAL_ID = 0x21;
+constexpr uint8_t MODE09_VIN = 0x02;
+constexpr uint8_t MODE01_LAST_BITMAP = 0xE0;
+
+// Stored as one NVS blob per car and ECU.
+struct EcuCaps {
+    uint8_t version;
+    uint8_t mode01Known;   // bitmap chain answered to the end, or 7F to 01 00
+    uint8_t mode01[32];    // supported Mode 01 PIDs, bit per PID
+    uint8_t local21[32];   // 0x21 local IDs that answered positively
+    uint8_t tested21[32];  // 0x21 local IDs that answered at all (positive or 7F)
+};
+
+enum Phase : uint8_t { PHASE_LOAD, PHASE_MODE01, PHASE_LOCAL21, PHASE_DONE };
+
+struct EcuDiscovery {
+    uint32_t requestId;
+    Phase phase;
+    uint8_t mode01Base;    // bitmap PID in flight or next (00, 20, 40...)
+    uint16_t localIndex;   // next pidRequests entry to consider
+    bool inFlight;
+    uint8_t retries;       // timeouts on the probe in flight so far
+    uint8_t probeService;
+    uint8_t probePid;
+    bool answeredAny;
+    bool known;            // caps are final and apply
+    bool fromCache;
+    EcuCaps caps;
+};
+
+EcuDiscovery ecus[MAX_ECUS] = {};
+uint8_t ecuCount = 0;
+uint8_t vinEcuIndex = 0;
+bool vinPending = true;     // no answer to 09 02 yet
+bool vinInFlight = false;
+uint8_t vinTimeouts = 0;    // in the current round
+uint8_t vinRounds = 0;      // rounds that went unanswered
+char vin[18] = {0};
+
+inline void setBit(uint8_t* bits, uint8_t n) { bits[n >> 3] |= (uint8_t)(0x80 >> (n & 7)); }
+inline bool testBit(const uint8_t* bits, uint8_t n) { return bits[n >> 3] & (0x80 >> (n & 7)); }
+
+bool isLocalIdFor(const EcuDiscovery& d, uint16_t i) {
+    return pidRequests[i].requestId == d.requestId && pidRequests[i].service == SVC_LOCAL_ID;
+}
+
+// Key is the VIN serial (last 6) plus the request ID, e.g. "123456_7E2".
+bool cacheKey(const EcuDiscovery& d, char* key, size_t len) {
+    if (vin[0] == 0) return false;
+    snprintf(key, len, "%s_%03lX", &vin[11], (unsigned long)d.requestId);
+    return true;
+}
+
+// A cached entry is only good if it covers every local ID the catalog has now.
+bool loadCaps(EcuDiscovery& d) {
+    char key[16];
+    if (!cacheKey(d, key, sizeof(key))) return false;
+
+    Preferences prefs;
+    prefs.begin(NVS_NAMESPACE, true);
+    EcuCaps caps;
+    const size_t n = prefs.getBytes(key, &caps, sizeof(caps));
+    prefs.end();
+    if (n != sizeof(caps) || caps.version != CAPS_VERSION) return false;
+
+    const size_t count = sizeof(pidRequests) / sizeof(pidRequests[0]);
+    for (uint16_t i = 0; i < count; i++) {
+        if (isLocalIdFor(d, i) && !testBit(caps.tested21, pidRequests[i].pid)) return false;
+    }
+    d.caps = caps;
+    return true;
+}
+
+void saveCaps(const EcuDiscovery& d) {
+    char key[16];
+    if (!cacheKey(d, key, sizeof(key))) return;
+    Preferences prefs;
+    prefs.begin(NVS_NAMESPACE, false);
+    prefs.putBytes(key, &d.caps, sizeof(d.caps));
+    prefs.end();
+}
+
+void printEcu(const EcuDiscovery& d) {
+    uint16_t tested = 0, ok = 0, mode01 = 0;
+    for (uint16_t n = 0; n < 256; n++) {
+        if (testBit(d.caps.tested21, n)) tested++;
+        if (testBit(d.caps.local21, n)) ok++;
+        if (testBit(d.caps.mode01, n)) mode01++;
+    }
+    Serial.printf("[DISC] 0x%03lX %s%s mode01=%u local21=%u/%u\n",
+                  (unsigned long)d.requestId,
+                  d.phase != PHASE_DONE ? "running" : d.known ? "known" : "unknown",
+                  d.fromCache ? " (nvs)" : "",
+                  d.caps.mode01Known ? mode01 : 0, ok, tested);
+}
+
+// Every probe got a real answer: Mode 01 resolved and every local ID the
+// catalog has for this ECU tested. Only that is worth keeping across boots.
+bool resolved(const EcuDiscovery& d) {
+    if (!d.caps.mode01Known) return false;
+    const size_t count = sizeof(pidRequests) / sizeof(pidRequests[0]);
+    for (uint16_t i = 0; i < count; i++) {
+        if (isLocalIdFor(d, i) && !testBit(d.caps.tested21, pidRequests[i].pid)) return false;
+    }
+    return true;
+}
+
+void finish(EcuDiscovery& d) {
+    d.phase = PHASE_DONE;
+    // An ECU that never said anything is probably asleep, not missing every
+    // PID. Leave it unknown (poll everything) and try again next boot.
+    d.known = d.answeredAny || d.fromCache;
+    // Whatever timed out stays untested (polled), and isn't cached, so the
+    // next boot probes it again.
+    if (d.answeredAny && !d.fromCache && resolved(d)) saveCaps(d);
+    printEcu(d);
+}
+
+void advanceLocal(EcuDiscovery& d) {
+    const size_t count = sizeof(pidRequests) / sizeof(pidRequests[0]);
+    while (d.localIndex < count) {
+        const uint16_t i = d.localIndex;
+        if (isLocalIdFor(d, i) && !testBit(d.caps.tested21, pidRequests[i].pid)) return;
+        d.localIndex++;
+    }
+    finish(d);
+}
+
+void onVin(const uint8_t* p, uint16_t len) {
+    vinInFlight = false;
+    if (p == nullptr) {
+        // Still pending; discoveryNext decides whether there is another round.
+        if (++vinTimeouts <= DISCOVERY_RETRIES) return;
+        vinTimeouts = 0;
+        vinRounds++;
+        return;
+    }
+    // A 7F, or any other real answer, settles it for this boot.
+    vinPending = false;
+    // 49 02 [01] <17 chars>; some ECUs leave out the item count byte.
+    if (len < 2 + 17 || p[0] != (SVC_MODE09 | 0x40) || p[1] != MODE09_VIN) return;
+    const uint8_t* v = &p[len - 17];
+    for (uint8_t i = 0; i < 17; i++) {
+        if (v[i] < 0x20 || v[i] > 0x7E) return;
+    }
+    memcpy(vin, v, 17);
+    vin[17] = 0;
+    Serial.printf("[DISC] VIN %s\n", vin);
+    // ECUs that finished before the VIN came in can be cached now.
+    for (uint8_t e = 0; e < ecuCount; e++) {
+        const EcuDiscovery& d = ecus[e];
+        if (d.phase == PHASE_DONE && d.answeredAny && !d.fromCache && resolved(d)) saveCaps(d);
+    }
+}
+
+DiscoveryStep vinProbe(uint8_t* service, uint8_t* pid) {
+    vinInFlight = true;
+    *service = SVC_MODE09;
+    *pid = MODE09_VIN;
+    return DISCOVERY_REQUEST;
+}
+
+void onProbeResult(EcuDiscovery& d, const uint8_t* p, uint16_t len) {
+    d.inFlight = false;
+    if (p == nullptr) {
+        // Send the same probe again; after that many, move on without an answer.
+        if (++d.retries <= DISCOVERY_RETRIES) return;
+        // Nothing from this ECU at all yet: it's asleep, so don't sweep the rest.
+        if (!d.answeredAny) {
+            d.retries = 0;
+            finish(d);
+            return;
+        }
+    }
+    d.retries = 0;
+    const bool positive = p != nullptr && len >= 2 &&
+                          p[0] == (d.probeService | 0x40) && p[1] == d.probePid;
+    const bool negative = p != nullptr && len >= 2 && p[0] == 0x7F && p[1] == d.probeService;
+    if (p != nullptr) d.answeredAny = true;  // a 7F still proves the ECU is awake
+
+    if (d.phase == PHASE_MODE01) {
+        if (!positive || len < 6) {
+            // A 7F ends the chain: no Mode 01 at all, or none past this
+            // bitmap. No answer leaves Mode 01 unknown, so it is polled.
+            if (negative) d.caps.mode01Known = 1;
+            d.phase = PHASE_LOCAL21;
+            advanceLocal(d);
+            return;
+        }
+        // 41 nn A B C D: bit 31 (A7) is PID nn+1, bit 0 (D0) is PID nn+32.
+        // The E0 bitmap's last bit would be PID 0x100; there is none.
+        for (uint8_t b = 0; b < 32 && d.mode01Base + 1 + b <= 0xFF; b++) {
+            if (p[2 + (b >> 3)] & (0x80 >> (b & 7))) setBit(d.caps.mode01, (uint8_t)(d.mode01Base + 1 + b));
+        }
+        const bool more = d.mode01Base < MODE01_LAST_BITMAP && (p[5] & 0x01);
+        if (more) {
+            d.mode01Base += 0x20;
+        } else {
+            d.caps.mode01Known = 1;
+            d.phase = PHASE_LOCAL21;
+            advanceLocal(d);
+        }
+        return;
+    }
+
+    if (d.phase == PHASE_LOCAL21) {
+        if (p != nullptr) setBit(d.caps.tested21, d.probePid);
+        if (positive) setBit(d.caps.local21, d.probePid);
+        d.localIndex++;
+        advanceLocal(d);
+    }
+}
+
+} // namespace
+
+void discoveryInit(const uint32_t* requestIds, uint8_t count, uint8_t vinEcu) {
+    ecuCount = count > MAX_ECUS ? MAX_ECUS : count;
+    vinEcuIndex = vinEcu;
+    vinPending = true;
+    vinInFlight = false;
+    vinTimeouts = 0;
+    vinRounds = 0;
+    vin[0] = 0;
+    for (uint8_t e = 0; e < ecuCount; e++) {
+        EcuDiscovery& d = ecus[e];
+        memset(&d, 0, sizeof(d));
+        d.requestId = requestIds[e];
+        d.phase = PHASE_LOAD;
+        d.caps.version = CAPS_VERSION;
+    }
+}
+
+DiscoveryStep discoveryNext(uint8_t ecu, uint8_t* service, uint8_t* pid) {
+    if (ecu >= ecuCount) return DISCOVERY_DONE;
+
+    // The VIN keys the cache, so everything waits for its first round. If
+    // that goes unanswered the others are probed uncached.
+    if (vinPending && vinRounds == 0) {
+        if (ecu != vinEcuIndex || vinInFlight) return DISCOVERY_WAIT;
+        return vinProbe(service, pid);
+    }
+
+    EcuDiscovery& d = ecus[ecu];
+    if (d.inFlight || (ecu == vinEcuIndex && vinInFlight)) return DISCOVERY_WAIT;
+
+    if (d.phase == PHASE_LOAD) {
+        if (loadCaps(d)) {
+            d.fromCache = true;
+            finish(d);
+        } else {
+            d.phase = PHASE_MODE01;
+            d.mode01Base = 0x00;
+        }
+    }
+
+    switch (d.phase) {
+        case PHASE_MODE01:
+            d.probeService = SVC_MODE01;
+            d.probePid = d.mode01Base;
+            break;
+        case PHASE_LOCAL21:
+            d.probeService = SVC_LOCAL_ID;
+            d.probePid = pidRequests[d.localIndex].pid;
+            break;
+        default:
+            // The VIN ECU answered its own probes but not 09 02: one more
+            // round, and a late VIN still gets everything cached.
+            if (ecu == vinEcuIndex && vinPending && vinRounds == 1 && d.answeredAny) {
+                return vinProbe(service, pid);
+            }
+            return DISCOVERY_DONE;
+    }
+    d.inFlight = true;
+    *service = d.probeService;
+    *pid = d.probePid;
+    return DISCOVERY_REQUEST;
+}
+
+void discoveryOnReply(uint8_t ecu, const uint8_t* p, uint16_t len) {
+    if (ecu >= ecuCount) return;
+    if (ecu == vinEcuIndex && vinInFlight) {
+        onVin(p, len);
+        return;
+    }
+    EcuDiscovery& d = ecus[ecu];
+    if (d.inFlight) onProbeResult(d, p, len);
+}
+
+void discoveryOnTimeout(uint8_t ecu) {
+    discoveryOnReply(ecu, nullptr, 0);
+}
+
+bool discoverySupports(uint8_t ecu, uint8_t service, uint8_t pid) {
+    if (ecu >= ecuCount) return true;
+    const EcuDiscovery& d = ecus[ecu];
+    if (!d.known) return true;
+    switch (service) {
+        case SVC_MODE01:
+            return !d.caps.mode01Known || testBit(d.caps.mode01, pid);
+        case SVC_LOCAL_ID:
+            return !testBit(d.caps.tested21, pid) || testBit(d.caps.local21, pid);
+        default:
+            return true;
+    }
+}
+
+void discoveryPrint() {
+    Serial.printf("[DISC] VIN %s\n", vin[0] ? vin : "(none)");
+    for (uint8_t e = 0; e < ecuCount; e++) printEcu(ecus[e]);
+}
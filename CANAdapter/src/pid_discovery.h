@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Boot-time capability discovery. Reads the VIN, then per ECU asks for the
+// Mode 01 support bitmaps (01 00, 01 20, ... while the chain bit is set) and
+// tries each 0x21 local ID the PID catalog knows for that ECU. Results are
+// kept in NVS under "<last 6 of VIN>_<request id>", so a later boot of the
+// same car skips straight to polling.
+//
+// The caller owns the lanes: it asks for the next request per ECU, sends it,
+// and reports the reply or a timeout back here. Until an ECU is done every
+// PID counts as supported, so the caller can poll in between probes.
+
+// A probe that goes unanswered is sent again DISCOVERY_RETRIES times. If it is
+// still unanswered, it counts as unknown, which means it is polled. Only a 7F
+// marks a PID unsupported, and the NVS entry is only written once every probe
+// has had a real answer. An ECU whose first probe never gets an answer is
+// asleep and is left unknown without sweeping the rest.
+//
+// The VIN gets the same retries. The other ECUs wait for that first round
+// only; the VIN ECU asks once more after its own sweep if it answered that,
+// and only a reply (7F included) ends the VIN for the boot.
+constexpr unsigned long DISCOVERY_TIMEOUT_MS = 200; // per probe
+constexpr uint8_t DISCOVERY_RETRIES = 2;
+
+enum DiscoveryStep : uint8_t {
+    DISCOVERY_REQUEST = 0, // *service / *pid hold the next probe
+    DISCOVERY_WAIT,        // nothing to send yet (VIN or a probe in flight)
+    DISCOVERY_DONE         // capabilities for this ECU are final
+};
+
+// requestIds[i] is ECU i's request ID; vinEcu reads the VIN (09 02).
+void discoveryInit(const uint32_t* requestIds, uint8_t ecuCount, uint8_t vinEcu);
+
+DiscoveryStep discoveryNext(uint8_t ecu, uint8_t* service, uint8_t* pid);
+void discoveryOnReply(uint8_t ecu, const uint8_t* p, uint16_t len); // full payload, 7F included
+void discoveryOnTimeout(uint8_t ecu);
+
+// True unless discovery finished and the ECU said no to this PID (7F, or left
+// out of a Mode 01 bitmap). ECUs that never answered anything (ignition off)
+// stay "unknown" = supported.
+bool discoverySupports(uint8_t ecu, uint8_t service, uint8_t pid);
+
+void discoveryPrint();
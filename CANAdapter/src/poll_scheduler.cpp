@@ -0,0 +1,334 @@
+#include "poll_scheduler.h"
+
+namespace {
+
+constexpr uint16_t DEFAULT_TIMEOUT_MS = 250; // until a sensor has enough samples
+constexpr uint16_t MIN_TIMEOUT_MS = 30;
+constexpr uint16_t MAX_TIMEOUT_MS = 300;
+constexpr uint16_t MIN_RTT_SAMPLES = 8;
+constexpr uint16_t RTT_DECAY_TOTAL = 200;    // halve the histogram past this many samples
+constexpr unsigned long RATE_WINDOW_MS = 10000; // effective Hz is counted over this window
+
+struct SensorSched {
+    bool configured;
+    bool supported;             // cleared by capability discovery
+    uint8_t lane;
+    uint16_t periodMs;
+    uint16_t minPeriodMs;       // adaptive bounds; both equal periodMs when fixed
+    uint16_t maxPeriodMs;
+    uint16_t idleFillMs;        // 0 = never dispatched early
+    uint16_t demandMs;          // from subscriptions, 0 = nobody watching
+    uint16_t jitterMs;
+    uint16_t lanePerMille;      // bulk cap on lane time, 0 = none
+    uint16_t shareFloorMs;      // period the cap allows at the measured RTT
+    unsigned long releaseMs;    // eligible from here
+    unsigned long dispatchMs;
+    unsigned long rateWindowMs;
+    uint16_t rateWindowCount;
+    bool starvedFlagged;        // starvation already counted for this release
+    bool behind;                // values late or stale, from the signal store
+    uint8_t rttBins[POLL_RTT_BINS];
+    uint16_t rttTotal;
+    PollSchedStats stats;
+};
+
+SensorSched sched[POLL_SCHED_MAX_SENSORS] = {};
+uint8_t sensorCount = 0;
+uint16_t busScale = 1000;
+
+// Period actually used between releases while the bus backs us off.
+uint32_t busStretched(uint16_t periodMs) {
+    return busScale >= 1000 ? periodMs : (uint32_t)periodMs * 1000 / busScale;
+}
+
+unsigned long deadlineOf(const SensorSched& s) {
+    return s.releaseMs + s.jitterMs;
+}
+
+// Nothing is polled faster than the fastest subscriber asked for, nor
+// faster than a bulk sensor's lane share allows.
+uint16_t loPeriod(const SensorSched& s) {
+    uint16_t p = s.minPeriodMs > s.demandMs ? s.minPeriodMs : s.demandMs;
+    return p > s.shareFloorMs ? p : s.shareFloorMs;
+}
+
+uint16_t hiPeriod(const SensorSched& s) {
+    return s.maxPeriodMs > s.demandMs ? s.maxPeriodMs : s.demandMs;
+}
+
+uint16_t idleFloor(const SensorSched& s) {
+    return s.idleFillMs > s.demandMs ? s.idleFillMs : s.demandMs;
+}
+
+// Pick order within a lane: behind sensors, then everything due, then bulk
+// sensors still inside their deadline (they only go when nothing else is due).
+// A bulk sensor never jumps the queue for being behind; its cap still holds.
+uint8_t pickRank(const SensorSched& s, long slack) {
+    if (s.behind && s.lanePerMille == 0) return 2;
+    if (s.lanePerMille != 0 && slack >= 0) return 0;
+    return 1;
+}
+
+// Upper edge (ms) of the bin holding the given fraction (per mille) of samples.
+uint16_t rttPercentile(const SensorSched& s, uint16_t perMille) {
+    const uint32_t want = ((uint32_t)s.rttTotal * perMille + 999) / 1000;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < POLL_RTT_BINS; i++) {
+        seen += s.rttBins[i];
+        if (seen >= want) return (uint16_t)(i + 1) * POLL_RTT_BIN_MS;
+    }
+    return POLL_RTT_BINS * POLL_RTT_BIN_MS;
+}
+
+void recomputeTimeout(SensorSched& s) {
+    if (s.rttTotal < MIN_RTT_SAMPLES) {
+        s.stats.timeoutMs = DEFAULT_TIMEOUT_MS;
+        return;
+    }
+    s.stats.rttP50Ms = rttPercentile(s, 500);
+    s.stats.rttP95Ms = rttPercentile(s, 950);
+    // Twice p95: roomy enough for ECU jitter, and the odd lost reply (a
+    // censored sample below) stays out of the percentile.
+    uint32_t t = (uint32_t)s.stats.rttP95Ms * 2;
+    if (t < MIN_TIMEOUT_MS) t = MIN_TIMEOUT_MS;
+    if (t > MAX_TIMEOUT_MS) t = MAX_TIMEOUT_MS;
+    s.stats.timeoutMs = (uint16_t)t;
+}
+
+// Median round trip is the lane time one poll costs.
+void recomputeShareFloor(SensorSched& s) {
+    if (s.lanePerMille == 0) return;
+    const uint32_t busyMs = s.rttTotal < MIN_RTT_SAMPLES ? s.stats.timeoutMs : s.stats.rttP50Ms;
+    uint32_t floor = busyMs * 1000 / s.lanePerMille;
+    if (floor > UINT16_MAX) floor = UINT16_MAX;
+    s.shareFloorMs = (uint16_t)floor;
+    if (s.periodMs < s.shareFloorMs) {
+        s.periodMs = s.shareFloorMs;
+        s.stats.periodMs = s.periodMs;
+    }
+}
+
+void recordRtt(SensorSched& s, unsigned long rttMs) {
+    uint32_t bin = rttMs / POLL_RTT_BIN_MS;
+    if (bin >= POLL_RTT_BINS) bin = POLL_RTT_BINS - 1;
+
+    if (s.rttTotal >= RTT_DECAY_TOTAL) {
+        s.rttTotal = 0;
+        for (uint8_t i = 0; i < POLL_RTT_BINS; i++) {
+            s.rttBins[i] >>= 1;
+            s.rttTotal += s.rttBins[i];
+        }
+    }
+    if (s.rttBins[bin] < 255) {
+        s.rttBins[bin]++;
+        s.rttTotal++;
+    }
+    recomputeTimeout(s);
+}
+
+void countSample(SensorSched& s, unsigned long now) {
+    s.rateWindowCount++;
+    const unsigned long elapsed = now - s.rateWindowMs;
+    if (elapsed >= RATE_WINDOW_MS) {
+        s.stats.effectiveCentiHz = (uint16_t)((uint32_t)s.rateWindowCount * 100000UL / elapsed);
+        s.rateWindowCount = 0;
+        s.rateWindowMs = now;
+    }
+}
+
+} // namespace
+
+void pollSchedConfigure(uint8_t sensor, uint8_t lane, uint16_t periodMs, uint16_t jitterMs) {
+    if (sensor >= POLL_SCHED_MAX_SENSORS) return;
+    SensorSched& s = sched[sensor];
+    memset(&s, 0, sizeof(s));
+    s.configured = true;
+    s.supported = true;
+    s.lane = lane;
+    s.periodMs = periodMs;
+    s.minPeriodMs = periodMs;
+    s.maxPeriodMs = periodMs;
+    s.jitterMs = jitterMs;
+    s.demandMs = periodMs; // until subscriptions say otherwise
+    s.stats.timeoutMs = DEFAULT_TIMEOUT_MS;
+    s.stats.periodMs = periodMs;
+    s.stats.demandMs = periodMs;
+    if (sensor + 1 > sensorCount) sensorCount = sensor + 1;
+}
+
+void pollSchedSetAdaptive(uint8_t sensor, uint16_t minPeriodMs, uint16_t maxPeriodMs) {
+    SensorSched& s = sched[sensor];
+    s.minPeriodMs = minPeriodMs;
+    s.maxPeriodMs = maxPeriodMs;
+}
+
+void pollSchedSetIdleFill(uint8_t sensor, uint16_t minPeriodMs) {
+    sched[sensor].idleFillMs = minPeriodMs;
+}
+
+void pollSchedSetLaneShare(uint8_t sensor, uint16_t perMille) {
+    SensorSched& s = sched[sensor];
+    s.lanePerMille = perMille;
+    s.shareFloorMs = 0;
+    recomputeShareFloor(s);
+}
+
+void pollSchedSetDemand(uint8_t sensor, uint16_t periodMs, unsigned long now) {
+    SensorSched& s = sched[sensor];
+    const bool wasIdle = s.demandMs == 0;
+    s.demandMs = periodMs;
+    s.stats.demandMs = periodMs;
+    if (periodMs == 0) return;
+    if (wasIdle) {
+        // Newly watched: due now, without counting the unwatched stretch as misses.
+        s.releaseMs = now;
+        s.starvedFlagged = false;
+    }
+
+    uint16_t p = s.periodMs;
+    if (p < loPeriod(s)) p = loPeriod(s);
+    if (p > hiPeriod(s)) p = hiPeriod(s);
+    s.periodMs = p;
+    s.stats.periodMs = p;
+}
+
+void pollSchedSetSupported(uint8_t sensor, bool supported, unsigned long now) {
+    SensorSched& s = sched[sensor];
+    s.supported = supported;
+    // Lanes idle during discovery; don't bill that wait as missed deadlines.
+    s.releaseMs = now;
+    s.starvedFlagged = false;
+}
+
+void pollSchedStart(unsigned long now) {
+    for (uint8_t i = 0; i < sensorCount; i++) {
+        sched[i].releaseMs = now;
+        sched[i].rateWindowMs = now;
+        sched[i].starvedFlagged = false;
+    }
+}
+
+int8_t pollSchedPick(uint8_t lane, unsigned long now) {
+    int8_t best = -1;
+    long bestSlack = 0;
+    uint8_t bestRank = 0;
+    int8_t edf = -1;        // plain earliest deadline, to count behind overrides
+    long edfSlack = 0;
+
+    for (uint8_t i = 0; i < sensorCount; i++) {
+        SensorSched& s = sched[i];
+        if (!s.configured || !s.supported || s.lane != lane || s.demandMs == 0) continue;
+        if ((long)(now - s.releaseMs) < 0) continue; // not released yet
+
+        // Signed slack so the comparison survives millis() wrap.
+        const long slack = (long)(deadlineOf(s) - now);
+        if (!s.starvedFlagged && slack < -(long)s.periodMs) {
+            s.stats.starvations++;
+            s.starvedFlagged = true;
+        }
+        if (edf < 0 || slack < edfSlack) {
+            edf = (int8_t)i;
+            edfSlack = slack;
+        }
+        // Highest rank first, earliest deadline first within each rank.
+        const uint8_t rank = pickRank(s, slack);
+        if (best < 0 || (rank != bestRank ? rank > bestRank : slack < bestSlack)) {
+            best = (int8_t)i;
+            bestSlack = slack;
+            bestRank = rank;
+        }
+    }
+    if (best >= 0) {
+        if (best != edf && bestRank == 2) sched[best].stats.behindPicks++;
+        if (best != edf && sched[edf].lanePerMille != 0) sched[edf].stats.shareDeferrals++;
+        return best;
+    }
+
+    // Nothing due: hand the idle lane to an idle-fill sensor, earliest
+    // deadline first, as long as its minimum period has passed. Not while
+    // the bus is busy: that's the first traffic to go.
+    if (busScale < 1000) return best;
+    for (uint8_t i = 0; i < sensorCount; i++) {
+        const SensorSched& s = sched[i];
+        if (!s.configured || !s.supported || s.lane != lane || s.idleFillMs == 0 || s.demandMs == 0) continue;
+        if ((long)(now - (s.dispatchMs + idleFloor(s))) < 0) continue;
+        const long slack = (long)(deadlineOf(s) - now);
+        if (best < 0 || slack < bestSlack) {
+            best = (int8_t)i;
+            bestSlack = slack;
+        }
+    }
+    return best;
+}
+
+bool pollSchedReleased(uint8_t sensor, unsigned long now) {
+    const SensorSched& s = sched[sensor];
+    return s.configured && s.supported && s.demandMs != 0 && (long)(now - s.releaseMs) >= 0;
+}
+
+void pollSchedDispatched(uint8_t sensor, unsigned long now) {
+    SensorSched& s = sched[sensor];
+    s.stats.dispatched++;
+    if ((long)(now - deadlineOf(s)) > 0) s.stats.deadlineMisses++;
+    s.dispatchMs = now;
+    s.starvedFlagged = false;
+    // Next release is one period after this dispatch, so the rate tracks the
+    // target even when a reply is slow.
+    s.releaseMs = now + busStretched(s.periodMs);
+}
+
+void pollSchedCompleted(uint8_t sensor, unsigned long now) {
+    SensorSched& s = sched[sensor];
+    s.stats.completed++;
+    recordRtt(s, now - s.dispatchMs);
+    recomputeShareFloor(s);
+    countSample(s, now);
+}
+
+void pollSchedTimedOut(uint8_t sensor, unsigned long now) {
+    SensorSched& s = sched[sensor];
+    s.stats.timeouts++;
+    // Censored sample at the limit: if the timeout is too tight, this pulls
+    // the percentile up until late replies fit again.
+    recordRtt(s, now - s.dispatchMs);
+    recomputeShareFloor(s);
+}
+
+void pollSchedSignalChanged(uint8_t sensor, bool moving) {
+    SensorSched& s = sched[sensor];
+    if (s.minPeriodMs == s.maxPeriodMs) return;
+
+    // Halve on movement so a warming pack is caught quickly; creep back up
+    // by a quarter per flat sample.
+    uint32_t p = moving ? s.periodMs / 2 : s.periodMs + s.periodMs / 4;
+    if (p < loPeriod(s)) p = loPeriod(s);
+    if (p > hiPeriod(s)) p = hiPeriod(s);
+    s.periodMs = (uint16_t)p;
+    s.stats.periodMs = s.periodMs;
+    s.releaseMs = s.dispatchMs + busStretched(s.periodMs); // applies to the pending release too
+}
+
+void pollSchedSetBehind(uint8_t sensor, bool behind) {
+    if (sensor >= POLL_SCHED_MAX_SENSORS) return;
+    sched[sensor].behind = behind;
+}
+
+void pollSchedSetBusScale(uint16_t perMille) {
+    busScale = perMille == 0 ? 1 : perMille;
+}
+
+uint16_t pollSchedBusScale() {
+    return busScale;
+}
+
+uint16_t pollSchedTimeoutMs(uint8_t sensor) {
+    return sched[sensor].stats.timeoutMs;
+}
+
+const PollSchedStats& pollSchedStats(uint8_t sensor) {
+    return sched[sensor].stats;
+}
+
+uint8_t pollSchedSensorCount() {
+    return sensorCount;
+}
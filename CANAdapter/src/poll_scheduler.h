@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Earliest-deadline-first PID scheduler. Each polled sensor declares a target
+// period and how much lateness it tolerates; each lane (one per ECU) asks for
+// the released sensor with the earliest deadline whenever it goes idle.
+// Per-sensor timeouts are learned from measured round trips.
+//
+// Adaptive sensors stretch their period while their value sits still and
+// shrink it again once it moves. Idle-fill sensors soak up whatever lane time
+// that frees, down to their own minimum period.
+//
+// Demand comes from consumer subscriptions: a sensor nobody wants is never
+// picked, and a consumer asking for a slower rate raises all the floors.
+// Sensors the ECU turned out not to support are never picked either.
+//
+// A bulk sensor (a long multi-frame reply) can be capped to a share of its
+// lane's time: its period is held at or above measured round trip / share,
+// and until its deadline passes it only goes when no other sensor on the
+// lane is due, so it fills gaps rather than pushing the fast pair back.
+//
+// A sensor whose values have fallen behind (late or stale in the signal
+// store) is picked ahead of every sensor that is merely due, so a lane
+// catches up on what the display is showing as stale first.
+//
+// While the bus is busy (bus_load's TX scale below 1000) every release is
+// pushed out by 1000/scale and idle fill stops, so our request rate drops
+// with the scale instead of piling up behind can_tx's throttle.
+
+constexpr uint8_t POLL_SCHED_MAX_SENSORS = 32;
+constexpr uint8_t POLL_RTT_BINS = 32;
+constexpr uint8_t POLL_RTT_BIN_MS = 8;
+
+struct PollSchedStats {
+    uint32_t dispatched;
+    uint32_t completed;
+    uint32_t timeouts;
+    uint32_t deadlineMisses;   // dispatched after release + jitter
+    uint32_t starvations;      // still waiting a full period past the deadline
+    uint16_t rttP50Ms;
+    uint16_t rttP95Ms;
+    uint16_t timeoutMs;        // current learned timeout
+    uint16_t periodMs;         // current period (moves for adaptive sensors)
+    uint16_t effectiveCentiHz; // completed samples per second x100, last window
+    uint16_t demandMs;         // fastest subscribed period, 0 = not polled
+    uint32_t behindPicks;      // picked ahead of the EDF order because it was behind
+    uint32_t shareDeferrals;   // held back for its lane share while first in EDF order
+};
+
+void pollSchedConfigure(uint8_t sensor, uint8_t lane, uint16_t periodMs, uint16_t jitterMs);
+void pollSchedSetAdaptive(uint8_t sensor, uint16_t minPeriodMs, uint16_t maxPeriodMs);
+void pollSchedSetIdleFill(uint8_t sensor, uint16_t minPeriodMs);
+void pollSchedSetLaneShare(uint8_t sensor, uint16_t perMille);  // 0 = uncapped
+void pollSchedSetDemand(uint8_t sensor, uint16_t periodMs, unsigned long now); // 0 = unwatched
+void pollSchedSetSupported(uint8_t sensor, bool supported, unsigned long now);  // from discovery
+void pollSchedStart(unsigned long now);
+
+int8_t pollSchedPick(uint8_t lane, unsigned long now);
+bool pollSchedReleased(uint8_t sensor, unsigned long now); // due, may ride along with a pick
+void pollSchedDispatched(uint8_t sensor, unsigned long now);
+void pollSchedCompleted(uint8_t sensor, unsigned long now);
+void pollSchedTimedOut(uint8_t sensor, unsigned long now);
+void pollSchedSignalChanged(uint8_t sensor, bool moving); // after each decoded sample
+void pollSchedSetBehind(uint8_t sensor, bool behind);     // its values are late or stale
+void pollSchedSetBusScale(uint16_t perMille);             // from bus_load, 1000 = no backoff
+uint16_t pollSchedBusScale();
+
+uint16_t pollSchedTimeoutMs(uint8_t sensor);
+const PollSchedStats& pollSchedStats(uint8_t sensor);
+uint8_t pollSchedSensorCount();
@@ -0,0 +1,287 @@
+#include "signal_store.h"
+
+#include <atomic>
+#include <math.h>
+
+#include "bus_load.h"
+#include "dash_wire.h"
+#include "kinematics.h"
+#include "pid_catalog.h"
+
+namespace {
+
+constexpr FixedScaleInfo UNSCALED = {1, 1, 0, 1};
+constexpr uint8_t LATE_GAPS = 2;
+constexpr uint8_t STALE_GAPS = 5;
+
+// Broadcast gaps are generous bounds on the bus rates; the body messages are
+// sent on change, so they never age. Polled gaps come from the scheduler.
+// Display values use the dash_wire scales; the chassis values never leave
+// the adapter, so they keep the catalog's (polled) or kinematics.h's
+// (broadcast). Peaks only change when exceeded, so they never age.
+const SignalInfo INFO[SIG_COUNT] = {
+    {"engine_rpm",   SIGNAL_U16,  "rpm", dash_wire::Rpm::info(),         100},
+    {"hv_current",   SIGNAL_I16,  "A",   dash_wire::HvCurrent::info(),   0},
+    {"hv_voltage",   SIGNAL_U16,  "V",   dash_wire::HvVoltage::info(),   0},
+    {"coolant",      SIGNAL_I16,  "C",   dash_wire::Coolant::info(),     0},
+    {"hv_intake",    SIGNAL_U16,  "C",   dash_wire::HvTemp::info(),      0},
+    {"hv_tb1",       SIGNAL_U16,  "C",   dash_wire::HvTemp::info(),      0},
+    {"hv_tb2",       SIGNAL_U16,  "C",   dash_wire::HvTemp::info(),      0},
+    {"hv_tb3",       SIGNAL_U16,  "C",   dash_wire::HvTemp::info(),      0},
+    {"soc",          SIGNAL_U8,   "%",   dash_wire::Soc::info(),         0},
+    {"ebar",         SIGNAL_I8,   "",    UNSCALED,                       200},
+    {"energy_state", SIGNAL_U8,   "",    UNSCALED,                       200},
+    {"fan_mode",     SIGNAL_U8,   "",    dash_wire::FanMode::info(),     0},
+    {"dash_bright",  SIGNAL_U8,   "%",   UNSCALED,                       0},
+    {"car_dim",      SIGNAL_BOOL, "",    UNSCALED,                       0},
+    {"display_off",  SIGNAL_BOOL, "",    UNSCALED,                       0},
+    {"mode_ev",      SIGNAL_BOOL, "",    UNSCALED,                       0},
+    {"mode_eco",     SIGNAL_BOOL, "",    UNSCALED,                       0},
+    {"mode_pwr",     SIGNAL_BOOL, "",    UNSCALED,                       0},
+    {"mg1_temp",     SIGNAL_U8,   "F",   dash_wire::MgTemp::info(),      0},
+    {"mg1_rpm",      SIGNAL_I16,  "rpm", dash_wire::MgRpm::info(),       0},
+    {"mg2_temp",     SIGNAL_U8,   "F",   dash_wire::MgTemp::info(),      0},
+    {"mg2_rpm",      SIGNAL_I16,  "rpm", dash_wire::MgRpm::info(),       0},
+    {"hv_block_01",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_02",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_03",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_04",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_05",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_06",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_07",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_08",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_09",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_10",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_11",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_12",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_13",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_14",  SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_min", SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_max", SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"hv_block_spr", SIGNAL_U16,  "V",   dash_wire::HvBlock::info(),     0},
+    {"wheel_fr",     SIGNAL_U8,   "mph",  pid_fixed::pid_7b0_2103_fr_ws::scale::info(),  0},
+    {"wheel_fl",     SIGNAL_U8,   "mph",  pid_fixed::pid_7b0_2103_fl_ws::scale::info(),  0},
+    {"wheel_rr",     SIGNAL_U8,   "mph",  pid_fixed::pid_7b0_2103_rr_ws::scale::info(),  0},
+    {"wheel_rl",     SIGNAL_U8,   "mph",  pid_fixed::pid_7b0_2103_rl_ws::scale::info(),  0},
+    {"yaw_rate",     SIGNAL_I8,   "deg/s", pid_fixed::pid_7b0_2106_yr1::scale::info(),    0},
+    {"lateral_g",    SIGNAL_U8,   "m/s2", pid_fixed::pid_7b0_2147_lateral_g::scale::info(), 0},
+    {"long_g",       SIGNAL_U8,   "m/s2", pid_fixed::pid_7b0_2147_fwd_rwd_g::scale::info(), 0},
+    {"steer_angle",  SIGNAL_I16,  "deg",  pid_fixed::pid_7b0_2147_steerangle::scale::info(), 0},
+    {"regen_coop",   SIGNAL_BOOL, "",     UNSCALED,                                      0},
+    {"bus_speed",    SIGNAL_U16,  "mph",  kin::Speed::info(),                            250},
+    {"bus_long_acc", SIGNAL_I32,  "m/s2", kin::LongAccel::info(),                        250},
+    {"peak_yaw",     SIGNAL_I16,  "deg/s", kin::YawRate::info(),                         0},
+    {"peak_accel_y", SIGNAL_I16,  "m/s2", kin::AccelY::info(),                           0},
+    {"peak_lon_acc", SIGNAL_I32,  "m/s2", kin::LongAccel::info(),                        0},
+    {"bus_load",     SIGNAL_U16,  "%",    BusLoadPercent::info(),                        250},
+    {"bus_peak",     SIGNAL_U16,  "%",    BusLoadPercent::info(),                        250},
+    {"bus_ours",     SIGNAL_U16,  "%",    BusLoadPercent::info(),                        250},
+    {"bus_tx_scale", SIGNAL_U16,  "%",    BusLoadPercent::info(),                        250},
+    {"loop_max",     SIGNAL_U32,  "us",   UNSCALED,                                      2500},
+    {"loop_p99",     SIGNAL_U32,  "us",   UNSCALED,                                      2500},
+    {"loop_overrun", SIGNAL_U32,  "",     UNSCALED,                                      2500},
+};
+
+// Relaxed atomics so a reader racing the writer is defined behaviour; the
+// fences around seq give the ordering.
+struct Slot {
+    std::atomic<uint32_t> raw;
+    std::atomic<uint32_t> updatedMs;
+    std::atomic<uint32_t> samples;
+    std::atomic<uint8_t> quality;
+    std::atomic<uint16_t> expectedMs;  // 0 = INFO's; not covered by seq
+};
+
+Slot slots[SIG_COUNT] = {};
+std::atomic<uint32_t> seq{0};  // odd while a write is in progress
+
+inline void beginWrite() {
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+inline void endWrite() {
+    seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+inline void readSlot(SignalId id, SignalSample& out) {
+    const Slot& s = slots[id];
+    out.raw = s.raw.load(std::memory_order_relaxed);
+    out.updatedMs = s.updatedMs.load(std::memory_order_relaxed);
+    out.samples = s.samples.load(std::memory_order_relaxed);
+    out.quality = (SignalQuality)s.quality.load(std::memory_order_relaxed);
+    const uint16_t expected = s.expectedMs.load(std::memory_order_relaxed);
+    out.expectedMs = expected ? expected : INFO[id].expectedMs;
+    out.id = id;
+    out.type = INFO[id].type;
+}
+
+int32_t clampTo(SignalType type, int64_t v) {
+    int64_t lo = INT32_MIN, hi = INT32_MAX;
+    switch (type) {
+        case SIGNAL_I8: lo = INT8_MIN; hi = INT8_MAX; break;
+        case SIGNAL_U8: lo = 0; hi = UINT8_MAX; break;
+        case SIGNAL_I16: lo = INT16_MIN; hi = INT16_MAX; break;
+        case SIGNAL_U16: lo = 0; hi = UINT16_MAX; break;
+        case SIGNAL_U32: lo = 0; hi = UINT32_MAX; break;
+        case SIGNAL_BOOL: return v != 0;
+        default: break;
+    }
+    return (int32_t)(v < lo ? lo : v > hi ? hi : v);
+}
+
+void store(SignalId id, uint32_t raw, uint32_t nowMs) {
+    if (id >= SIG_COUNT) return;
+    Slot& s = slots[id];
+    beginWrite();
+    s.raw.store(raw, std::memory_order_relaxed);
+    s.updatedMs.store(nowMs, std::memory_order_relaxed);
+    s.samples.store(s.samples.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    s.quality.store(SIGNAL_GOOD, std::memory_order_relaxed);
+    endWrite();
+}
+
+const char* freshnessName(SignalFreshness f) {
+    switch (f) {
+        case SIGNAL_FRESH: return "fresh";
+        case SIGNAL_LATE: return "late";
+        case SIGNAL_STALE: return "stale";
+        default: return "no-data";
+    }
+}
+
+const char* qualityName(SignalQuality q) {
+    switch (q) {
+        case SIGNAL_GOOD: return "good";
+        case SIGNAL_HELD: return "held";
+        case SIGNAL_UNSUPPORTED: return "unsupported";
+        default: return "none";
+    }
+}
+
+} // namespace
+
+float SignalSample::asFloat() const {
+    const FixedScaleInfo& sc = INFO[id].scale;
+    switch (type) {
+        case SIGNAL_F32: {
+            float f;
+            memcpy(&f, &raw, sizeof(f));
+            return f;
+        }
+        case SIGNAL_U32: return (float)raw * sc.num / sc.den + (float)sc.ofsNum / sc.ofsDen;
+        default: return fixedToFloat(sc, (int32_t)raw);
+    }
+}
+
+int32_t SignalSample::asInt() const {
+    if (type == SIGNAL_F32) return (int32_t)lroundf(asFloat());
+    return (int32_t)raw;
+}
+
+const SignalInfo& signalInfo(SignalId id) {
+    return INFO[id < SIG_COUNT ? id : 0];
+}
+
+void signalSetFloat(SignalId id, float value, uint32_t nowMs) {
+    if (id >= SIG_COUNT) return;
+    const SignalType type = INFO[id].type;
+    uint32_t raw;
+    if (type == SIGNAL_F32) {
+        memcpy(&raw, &value, sizeof(raw));
+    } else if (isnan(value)) {
+        return;
+    } else {
+        const FixedScaleInfo& sc = INFO[id].scale;
+        float v = (value - (float)sc.ofsNum / sc.ofsDen) * sc.den / sc.num;
+        // clamp in float first so the int64 conversion can't overflow
+        v = v < -2147483648.0f ? -2147483648.0f : v > 4294967295.0f ? 4294967295.0f : v;
+        raw = (uint32_t)clampTo(type, llroundf(v));
+    }
+    store(id, raw, nowMs);
+}
+
+void signalSetInt(SignalId id, int32_t value, uint32_t nowMs) {
+    if (id >= SIG_COUNT) return;
+    const SignalType type = INFO[id].type;
+    uint32_t raw;
+    if (type == SIGNAL_F32) {
+        const float f = (float)value;
+        memcpy(&raw, &f, sizeof(raw));
+    } else {
+        raw = (uint32_t)clampTo(type, value);
+    }
+    store(id, raw, nowMs);
+}
+
+void signalSetBool(SignalId id, bool value, uint32_t nowMs) {
+    signalSetInt(id, value ? 1 : 0, nowMs);
+}
+
+void signalSetQuality(SignalId id, SignalQuality quality) {
+    if (id >= SIG_COUNT) return;
+    beginWrite();
+    slots[id].quality.store(quality, std::memory_order_relaxed);
+    endWrite();
+}
+
+void signalSetExpectedMs(SignalId id, uint16_t ms) {
+    if (id >= SIG_COUNT) return;
+    slots[id].expectedMs.store(ms, std::memory_order_relaxed);
+}
+
+SignalFreshness signalFreshness(const SignalSample& s, uint32_t nowMs) {
+    if (s.samples == 0 || s.quality == SIGNAL_NONE || s.quality == SIGNAL_UNSUPPORTED) return SIGNAL_NO_DATA;
+    if (s.expectedMs == 0) return s.quality == SIGNAL_HELD ? SIGNAL_LATE : SIGNAL_FRESH;
+    const uint32_t age = nowMs - s.updatedMs;
+    if (age > (uint32_t)s.expectedMs * STALE_GAPS) return SIGNAL_STALE;
+    if (age > (uint32_t)s.expectedMs * LATE_GAPS || s.quality == SIGNAL_HELD) return SIGNAL_LATE;
+    return SIGNAL_FRESH;
+}
+
+SignalSample signalRead(SignalId id) {
+    SignalSample out = {};
+    if (id >= SIG_COUNT) return out;
+    uint32_t before, after;
+    do {
+        before = seq.load(std::memory_order_acquire);
+        readSlot(id, out);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = seq.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+    return out;
+}
+
+void signalStoreSnapshot(SignalSnapshot& out) {
+    uint32_t before, after;
+    do {
+        before = seq.load(std::memory_order_acquire);
+        for (uint8_t i = 0; i < SIG_COUNT; i++) readSlot((SignalId)i, out.s[i]);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = seq.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+    out.seq = before / 2;
+}
+
+void signalStorePrint(unsigned long now) {
+    SignalSnapshot snap;
+    signalStoreSnapshot(snap);
+    Serial.printf("Signals (%lu writes)\n", (unsigned long)snap.seq);
+    for (uint8_t i = 0; i < SIG_COUNT; i++) {
+        const SignalSample& s = snap.s[i];
+        const SignalInfo& info = INFO[i];
+        if (s.samples == 0) {
+            Serial.printf("  %-12s %10s  %s\n", info.name, "-", qualityName(s.quality));
+            continue;
+        }
+        const unsigned long age = (uint32_t)now - s.updatedMs;
+        const char* fresh = freshnessName(signalFreshness(s, (uint32_t)now));
+        if (s.type == SIGNAL_F32 || info.scale.num != info.scale.den || info.scale.ofsNum != 0) {
+            Serial.printf("  %-12s %10.2f %-3s age=%lums/%u n=%lu %s %s\n", info.name, (double)s.asFloat(),
+                          info.units, age, s.expectedMs, (unsigned long)s.samples, qualityName(s.quality), fresh);
+        } else {
+            Serial.printf("  %-12s %10ld %-3s age=%lums/%u n=%lu %s %s\n", info.name, (long)s.asInt(), info.units,
+                          age, s.expectedMs, (unsigned long)s.samples, qualityName(s.quality), fresh);
+        }
+    }
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "fixed_point.h"
+
+// Every decoded value the adapter knows, one typed slot per signal with the
+// time it was last written, how many samples it has taken and a quality flag.
+// Integer slots hold the value as the ECU scaled it (see dash_wire.h); the
+// slot's FixedScaleInfo turns that into physical units for asFloat().
+//
+// One writer: the loop() task (passive decoders and polled replies both run
+// there). Any number of readers on either core. Writes bump a sequence
+// counter around the update (a seqlock), and readers retry until they see the
+// same even count on both sides, so a read never mixes two updates and never
+// takes a lock. signalStoreSnapshot() does the same over the whole store, for
+// packing a display frame from one consistent moment.
+//
+// Not for ISRs: a reader that interrupts the writer on its own core would spin.
+
+enum SignalId : uint8_t {
+    SIG_ENGINE_RPM = 0,
+    SIG_HV_CURRENT,
+    SIG_HV_VOLTAGE,
+    SIG_ECT,
+    SIG_HV_INTAKE_C,
+    SIG_HV_TB1_C,
+    SIG_HV_TB2_C,
+    SIG_HV_TB3_C,
+    SIG_SOC,
+    SIG_EBAR,             // energy bar position, signed
+    SIG_ENERGY_STATE,     // energy flow state nibble
+    SIG_HV_FAN_MODE,      // battery fan speed 0..6
+    SIG_DASH_BRIGHT,      // UI brightness percent from the ambient sensor
+    SIG_CAR_DIM,
+    SIG_DISPLAY_OFF,      // dimmer knob all the way down
+    SIG_MODE_EV,
+    SIG_MODE_ECO,
+    SIG_MODE_PWR,
+    SIG_MG1_TEMP_F,
+    SIG_MG1_RPM,
+    SIG_MG2_TEMP_F,
+    SIG_MG2_RPM,
+    SIG_HV_BLOCK_01,      // 0x2181 block voltages, V01..V14 in order
+    SIG_HV_BLOCK_02,
+    SIG_HV_BLOCK_03,
+    SIG_HV_BLOCK_04,
+    SIG_HV_BLOCK_05,
+    SIG_HV_BLOCK_06,
+    SIG_HV_BLOCK_07,
+    SIG_HV_BLOCK_08,
+    SIG_HV_BLOCK_09,
+    SIG_HV_BLOCK_10,
+    SIG_HV_BLOCK_11,
+    SIG_HV_BLOCK_12,
+    SIG_HV_BLOCK_13,
+    SIG_HV_BLOCK_14,
+    SIG_HV_BLOCK_MIN,     // lowest and highest block in the last reply
+    SIG_HV_BLOCK_MAX,
+    SIG_HV_BLOCK_SPREAD,  // max - min
+    SIG_WHEEL_FR,         // 0x7B0 skid control: wheel speeds
+    SIG_WHEEL_FL,
+    SIG_WHEEL_RR,
+    SIG_WHEEL_RL,
+    SIG_YAW_RATE,
+    SIG_LATERAL_G,
+    SIG_LONG_G,
+    SIG_STEER_ANGLE,
+    SIG_REGEN_COOP,       // brake ECU is blending regen
+    SIG_BUS_SPEED,        // broadcast kinematics, decimated to 100 ms (kinematics.h)
+    SIG_BUS_LONG_ACCEL,
+    SIG_PEAK_YAW,         // largest full-rate magnitudes since boot
+    SIG_PEAK_ACCEL_Y,
+    SIG_PEAK_LONG_ACCEL,
+    SIG_BUS_LOAD,         // bus_load.h, per 100 ms bucket
+    SIG_BUS_PEAK,
+    SIG_BUS_OURS,
+    SIG_BUS_TX_SCALE,
+    SIG_LOOP_MAX_US,      // loop_profile.h: longest loop() period in the last second
+    SIG_LOOP_P99_US,      // since boot, bucket upper bound
+    SIG_LOOP_OVERRUNS,    // periods over the loop budget since boot
+    SIG_COUNT
+};
+
+// Native width of each slot; everything is held in a 32-bit word.
+enum SignalType : uint8_t {
+    SIGNAL_F32 = 0,
+    SIGNAL_I8,
+    SIGNAL_U8,
+    SIGNAL_I16,
+    SIGNAL_U16,
+    SIGNAL_I32,
+    SIGNAL_U32,
+    SIGNAL_BOOL
+};
+
+enum SignalQuality : uint8_t {
+    SIGNAL_NONE = 0,      // never written
+    SIGNAL_GOOD,          // last write was a decoded sample
+    SIGNAL_HELD,          // last poll failed or broadcast went quiet; value is the previous sample
+    SIGNAL_UNSUPPORTED    // the ECU doesn't answer for it
+};
+
+// How far to trust a value right now: its quality plus its age measured
+// against the gap expected between writes. Values match dash_wire::Freshness.
+enum SignalFreshness : uint8_t {
+    SIGNAL_FRESH = 0,
+    SIGNAL_LATE,          // the last poll failed, or more than 2 gaps old
+    SIGNAL_STALE,         // more than 5 gaps old
+    SIGNAL_NO_DATA        // never written, or unsupported
+};
+
+struct SignalInfo {
+    const char* name;
+    SignalType type;
+    const char* units;
+    FixedScaleInfo scale;  // value = raw * scale; {1, 1, 0, 1} for plain ints
+    uint16_t expectedMs;   // usual gap between writes; 0 = never ages (or set at run time)
+};
+
+struct SignalSample {
+    uint32_t raw;          // value bits in the slot's native type
+    uint32_t updatedMs;    // millis() of the last value write
+    uint32_t samples;      // value writes so far
+    uint16_t expectedMs;   // gap between writes the freshness is judged against
+    SignalId id;
+    SignalType type;
+    SignalQuality quality;
+
+    float asFloat() const;  // physical units, scale applied
+    int32_t asInt() const;  // the raw integer; floats round to nearest
+    bool asBool() const { return raw != 0; }
+};
+
+struct SignalSnapshot {
+    uint32_t seq;          // store write count / 2 at the time of the copy
+    SignalSample s[SIG_COUNT];
+};
+
+const SignalInfo& signalInfo(SignalId id);
+
+// Writer side (loop() only). signalSetInt() takes the raw integer and
+// signalSetFloat() a physical value, which integer slots scale back to raw,
+// round and clamp. Each call is one consistent update.
+void signalSetFloat(SignalId id, float value, uint32_t nowMs);
+void signalSetInt(SignalId id, int32_t value, uint32_t nowMs);
+void signalSetBool(SignalId id, bool value, uint32_t nowMs);
+void signalSetQuality(SignalId id, SignalQuality quality);  // value and time untouched
+// Polled signals: the poll period changes, so the poller keeps this current.
+void signalSetExpectedMs(SignalId id, uint16_t ms);
+
+// Reader side, any task.
+SignalSample signalRead(SignalId id);
+void signalStoreSnapshot(SignalSnapshot& out);
+
+inline float signalFloat(SignalId id) { return signalRead(id).asFloat(); }
+inline int32_t signalInt(SignalId id) { return signalRead(id).asInt(); }
+inline bool signalBool(SignalId id) { return signalRead(id).asBool(); }
+
+SignalFreshness signalFreshness(const SignalSample& s, uint32_t nowMs);
+
+void signalStorePrint(unsigned long now);
@@ -42,14 +42,14 @@ void sendWirelessBuzzerCommand(bool on) {
     if (wirelessBuzzerOn == on) return;
     wirelessBuzzerOn = on;
     if (on) {
-        sendCANFrame(0x750, {0x40,0x04,0x30,0x14,0x00,0x80,0x00,0x00});
+        sendCANFrame(CAN_TX_BODY, 0x750, {0x40,0x04,0x30,0x14,0x00,0x80,0x00,0x00});
     } else {
-        sendCANFrame(0x750, {0x40,0x04,0x30,0x14,0x00,0x00,0x00,0x00});
+        sendCANFrame(CAN_TX_BODY, 0x750, {0x40,0x04,0x30,0x14,0x00,0x00,0x00,0x00});
     }
 }
 
 void sendWindowCommand(uint8_t sub, uint8_t cmd) {
-    sendCANFrame(0x750, {sub,0x04,0x30,0x01,0x01,cmd,0x00,0x00});
+    sendCANFrame(CAN_TX_BODY, 0x750, {sub,0x04,0x30,0x01,0x01,cmd,0x00,0x00});
 }
 
 uint8_t buildWindowGroupSubs(uint8_t* outSubs) {
@@ -190,11 +190,11 @@ void processWindowControl(unsigned long now) {
 
 } // namespace
 
-void handleBodyAckFrame(const CAN_FRAME& can_message) {
+void handleBodyAckFrame(const CanDriverFrame& can_message) {
     // Positive response for window command looks like:
     // SS 02 70 01 00 00 00 00
     if (can_message.length < 4) return;
-    const uint8_t* d = can_message.data.byte;
+    const uint8_t* d = can_message.data;
     if (d[2] == 0x70 && d[3] == 0x01) {
         onWindowAck(d[0], millis());
     }
@@ -1,7 +1,8 @@
 #pragma once
 
 #include <Arduino.h>
-#include <esp32_can.h>
+
+#include "can_driver.h"
 
 // Steering-wheel button decode on 0x58E D6.
 enum : uint8_t {
@@ -15,6 +16,6 @@ enum : uint8_t {
 };
 
 void handleSteeringButton(uint8_t code, unsigned long now);
-void handleBodyAckFrame(const CAN_FRAME& can_message);
+void handleBodyAckFrame(const CanDriverFrame& can_message);
 void processSteeringControlState(unsigned long now);
 bool isWindowMotionBusy();
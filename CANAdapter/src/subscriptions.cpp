@@ -0,0 +1,170 @@
+#include "subscriptions.h"
+
+namespace {
+
+struct Consumer {
+    bool live;
+    bool permanent;
+    unsigned long renewedMs;
+    uint8_t count;
+    SubEntryWire entries[SUB_MAX_ENTRIES];
+};
+
+Consumer consumers[SUB_CONSUMER_COUNT] = {};
+uint16_t demandMs[SUB_SIG_POLLED_COUNT] = {0};
+bool demandDirty = true;
+
+uint32_t uplinkFrames = 0;
+uint32_t uplinkBadFrames = 0;
+
+// ESP-NOW mailbox: one pending message, newest wins.
+portMUX_TYPE espNowMux = portMUX_INITIALIZER_UNLOCKED;
+SubscribeMsg espNowPending;
+volatile bool espNowHavePending = false;
+
+// UART uplink parser, same framing as the display downlink.
+enum class RxState : uint8_t { WAIT_START, WAIT_LEN, WAIT_PAYLOAD, WAIT_CSUM };
+RxState rxState = RxState::WAIT_START;
+uint8_t rxLen = 0;
+uint8_t rxIdx = 0;
+uint8_t rxBuf[sizeof(SubscribeMsg)];
+
+constexpr uint8_t MSG_HEADER_LEN = 2; // consumer + count
+
+bool validMessage(const uint8_t* p, uint8_t len) {
+    if (len < MSG_HEADER_LEN) return false;
+    const SubscribeMsg* m = reinterpret_cast<const SubscribeMsg*>(p);
+    return m->consumer < SUB_CONSUMER_COUNT && m->count <= SUB_MAX_ENTRIES &&
+           len == MSG_HEADER_LEN + m->count * sizeof(SubEntryWire);
+}
+
+void recomputeDemand() {
+    for (uint8_t sig = 0; sig < SUB_SIG_POLLED_COUNT; sig++) demandMs[sig] = 0;
+    for (const Consumer& c : consumers) {
+        if (!c.live) continue;
+        for (uint8_t i = 0; i < c.count; i++) {
+            const SubEntryWire& e = c.entries[i];
+            if (e.signal >= SUB_SIG_POLLED_COUNT || e.periodMs == 0) continue;
+            if (demandMs[e.signal] == 0 || e.periodMs < demandMs[e.signal]) {
+                demandMs[e.signal] = e.periodMs;
+            }
+        }
+    }
+}
+
+} // namespace
+
+void subsUpdate(const SubscribeMsg& msg, unsigned long now, bool permanent) {
+    if (msg.consumer >= SUB_CONSUMER_COUNT) return;
+    Consumer& c = consumers[msg.consumer];
+    const uint8_t count = msg.count > SUB_MAX_ENTRIES ? SUB_MAX_ENTRIES : msg.count;
+
+    // Renewals are the common case; only a different set changes demand.
+    if (!c.live || c.count != count ||
+        memcmp(c.entries, msg.entries, count * sizeof(SubEntryWire)) != 0) {
+        memcpy(c.entries, msg.entries, count * sizeof(SubEntryWire));
+        c.count = count;
+        demandDirty = true;
+    }
+    c.live = true;
+    c.permanent = permanent;
+    c.renewedMs = now;
+}
+
+void subsOnEspNow(const uint8_t* data, int len) {
+    if (len <= 0 || len > (int)sizeof(SubscribeMsg) || !validMessage(data, (uint8_t)len)) return;
+    portENTER_CRITICAL(&espNowMux);
+    memcpy(&espNowPending, data, len);
+    espNowHavePending = true;
+    portEXIT_CRITICAL(&espNowMux);
+}
+
+void subsPollUart(Stream& link, unsigned long now) {
+    while (link.available()) {
+        const uint8_t b = (uint8_t)link.read();
+        switch (rxState) {
+            case RxState::WAIT_START:
+                if (b == SUB_UART_START) rxState = RxState::WAIT_LEN;
+                break;
+            case RxState::WAIT_LEN:
+                rxLen = b;
+                if (rxLen == 0 || rxLen > sizeof(rxBuf)) {
+                    uplinkBadFrames++;
+                    rxState = RxState::WAIT_START;
+                } else {
+                    rxIdx = 0;
+                    rxState = RxState::WAIT_PAYLOAD;
+                }
+                break;
+            case RxState::WAIT_PAYLOAD:
+                rxBuf[rxIdx++] = b;
+                if (rxIdx >= rxLen) rxState = RxState::WAIT_CSUM;
+                break;
+            case RxState::WAIT_CSUM: {
+                uint8_t x = 0;
+                for (uint8_t i = 0; i < rxLen; i++) x ^= rxBuf[i];
+                if (x == b && validMessage(rxBuf, rxLen)) {
+                    SubscribeMsg msg = {};
+                    memcpy(&msg, rxBuf, rxLen);
+                    subsUpdate(msg, now);
+                    uplinkFrames++;
+                } else {
+                    uplinkBadFrames++;
+                }
+                rxState = RxState::WAIT_START;
+                break;
+            }
+        }
+    }
+}
+
+bool subsService(unsigned long now) {
+    if (espNowHavePending) {
+        SubscribeMsg msg;
+        portENTER_CRITICAL(&espNowMux);
+        msg = espNowPending;
+        espNowHavePending = false;
+        portEXIT_CRITICAL(&espNowMux);
+        subsUpdate(msg, now);
+    }
+
+    for (Consumer& c : consumers) {
+        if (c.live && !c.permanent && now - c.renewedMs >= SUB_LEASE_MS) {
+            c.live = false;
+            demandDirty = true;
+        }
+    }
+
+    if (!demandDirty) return false;
+    demandDirty = false;
+    recomputeDemand();
+    return true;
+}
+
+uint16_t subsPeriodMs(uint8_t signal) {
+    return signal < SUB_SIG_POLLED_COUNT ? demandMs[signal] : 0;
+}
+
+bool subsConsumerLive(uint8_t consumer, unsigned long now) {
+    if (consumer >= SUB_CONSUMER_COUNT) return false;
+    const Consumer& c = consumers[consumer];
+    return c.live && (c.permanent || now - c.renewedMs < SUB_LEASE_MS);
+}
+
+void subsPrint(unsigned long now) {
+    static const char* const names[SUB_CONSUMER_COUNT] = {"local", "dash", "matrix", "logger"};
+    for (uint8_t i = 0; i < SUB_CONSUMER_COUNT; i++) {
+        const Consumer& c = consumers[i];
+        if (!c.live) {
+            Serial.printf("%-7s -\n", names[i]);
+            continue;
+        }
+        Serial.printf("%-7s age=%lu", names[i], c.permanent ? 0UL : now - c.renewedMs);
+        for (uint8_t j = 0; j < c.count; j++) {
+            Serial.printf(" %02X@%u", c.entries[j].signal, c.entries[j].periodMs);
+        }
+        Serial.println();
+    }
+    Serial.printf("uplink frames=%lu bad=%lu\n",
+                  (unsigned long)uplinkFrames, (unsigned long)uplinkBadFrames);
+}
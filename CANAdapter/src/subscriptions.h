@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Consumer subscriptions. DashDisplay (UART) and MatrixIndicator (ESP-NOW)
+// periodically tell us which signals they use and how often they want them.
+// A subscription is a lease: if it isn't renewed within SUB_LEASE_MS it lapses,
+// and a polled signal nobody subscribes to is not polled at all.
+
+constexpr uint8_t SUB_MAX_ENTRIES = 12;      // per message
+constexpr unsigned long SUB_LEASE_MS = 5000; // consumers renew every ~2 s
+constexpr uint8_t SUB_UART_START = 0xA5;     // uplink frames: 0xA5 | LEN | msg | XOR
+
+// Who is asking. LOCAL is the adapter itself (fan override) and never expires.
+enum : uint8_t {
+    SUB_CONSUMER_LOCAL = 0,
+    SUB_CONSUMER_DASH = 1,
+    SUB_CONSUMER_MATRIX = 2,
+    SUB_CONSUMER_LOGGER = 3,
+    SUB_CONSUMER_COUNT = 4
+};
+
+// Signal IDs on the wire. The polled ones match the adapter's SENSOR_* order.
+enum : uint8_t {
+    SUB_SIG_HV_CURRENT = 0,
+    SUB_SIG_HV_VOLTAGE = 1,
+    SUB_SIG_ECT = 2,
+    SUB_SIG_HV_TEMPS = 3,
+    SUB_SIG_SOC = 4,
+    SUB_SIG_HV_FAN_MODE = 5,
+    SUB_SIG_MG1 = 6,
+    SUB_SIG_MG2 = 7,
+    SUB_SIG_HV_BLOCKS = 8,    // 0x2181 block voltages, streamed as their own frame
+    SUB_SIG_WHEEL_SPEEDS = 9, // 0x7B0 skid control ECU from here on
+    SUB_SIG_YAW = 10,
+    SUB_SIG_CHASSIS_G = 11,   // lateral / longitudinal G and steering angle
+    SUB_SIG_REGEN_COOP = 12,
+    SUB_SIG_POLLED_COUNT = 13,
+    SUB_SIG_FLAGS = 0x40   // ESP-NOW flags byte (passive, never polled)
+};
+
+// Same layout is copied into DashDisplay and MatrixIndicator.
+#pragma pack(push,1)
+struct SubEntryWire {
+    uint8_t signal;
+    uint16_t periodMs;    // wanted interval between fresh samples
+};
+
+struct SubscribeMsg {
+    uint8_t consumer;
+    uint8_t count;
+    SubEntryWire entries[SUB_MAX_ENTRIES];
+};
+#pragma pack(pop)
+
+// Replace a consumer's whole subscription set. permanent = never expires.
+void subsUpdate(const SubscribeMsg& msg, unsigned long now, bool permanent = false);
+
+// ESP-NOW receive callback hook; runs in the WiFi task, only copies.
+void subsOnEspNow(const uint8_t* data, int len);
+
+// Drain uplink bytes from the display UART.
+void subsPollUart(Stream& link, unsigned long now);
+
+// Apply pending ESP-NOW messages and expire stale leases. Returns true when
+// the per-signal demand changed since the last call.
+bool subsService(unsigned long now);
+
+// Shortest requested period over live subscriptions, 0 if nobody watches.
+uint16_t subsPeriodMs(uint8_t signal);
+bool subsConsumerLive(uint8_t consumer, unsigned long now);
+
+void subsPrint(unsigned long now);
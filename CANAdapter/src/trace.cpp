@@ -0,0 +1,140 @@
+#include "trace.h"
+
+namespace {
+
+static_assert((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0, "TRACE_RING_SIZE must be a power of two");
+
+constexpr uint32_t TASK_STACK_BYTES = 3072;
+constexpr uint8_t SYNC0 = 0xA5;
+constexpr uint8_t SYNC1 = 0x5A;
+
+// Drain side, owned by the trace task; loop() only reads the counters.
+uint32_t cursor = 0;
+volatile uint32_t sent = 0;
+volatile uint32_t lapped = 0;
+volatile uint32_t frames = 0;
+
+std::atomic<bool> streaming{false};
+std::atomic<bool> replayRing{false};
+
+inline void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+void traceTask(void*) {
+    TraceRecord batch[TRACE_BATCH_MAX];
+    uint8_t frame[TRACE_FRAME_MAX];
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(TRACE_DRAIN_MS));
+        if (!streaming.load(std::memory_order_relaxed)) continue;
+        if (replayRing.exchange(false)) {
+            // Start from the oldest event still in the ring, not from where
+            // the last stream stopped.
+            const uint32_t h = trace_detail::head.load(std::memory_order_acquire);
+            cursor = h > TRACE_RING_SIZE ? h - TRACE_RING_SIZE : 0;
+        }
+        for (;;) {
+            uint32_t first = 0;
+            const uint8_t n = traceTake(batch, TRACE_BATCH_MAX, &first);
+            if (n == 0) break;
+            // Blocks only this task while the UART buffer is full.
+            Serial.write(frame, traceFrame(batch, n, first, frame));
+            sent += n;
+            frames++;
+            if (n < TRACE_BATCH_MAX) break;
+        }
+    }
+}
+
+} // namespace
+
+namespace trace_detail {
+
+Slot ring[TRACE_RING_SIZE] = {};
+std::atomic<uint32_t> head{0};
+
+} // namespace trace_detail
+
+uint8_t traceTake(TraceRecord* out, uint8_t max, uint32_t* first) {
+    using namespace trace_detail;
+    const uint32_t h = head.load(std::memory_order_acquire);
+    if (h - cursor > TRACE_RING_SIZE) {
+        lapped += h - cursor - TRACE_RING_SIZE;
+        cursor = h - TRACE_RING_SIZE;
+    }
+    *first = cursor;
+    uint8_t n = 0;
+    while (n < max && cursor != h) {
+        const Slot& s = ring[cursor & (TRACE_RING_SIZE - 1)];
+        const uint32_t seq = s.seq.load(std::memory_order_acquire);
+        const uint32_t us = s.us.load(std::memory_order_relaxed);
+        const uint32_t word = s.word.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // Not finished yet, or lapped while we read it; either way the batch
+        // ends here. A lap is skipped at the top of the next call.
+        if (seq != cursor + 1 || s.seq.load(std::memory_order_relaxed) != seq) break;
+        TraceRecord& r = out[n++];
+        r.us = us;
+        r.event = (uint8_t)(word >> 24);
+        r.sensor = (uint8_t)(word >> 16);
+        r.arg = (uint16_t)word;
+        cursor++;
+    }
+    return n;
+}
+
+size_t traceFrame(const TraceRecord* records, uint8_t n, uint32_t first, uint8_t* out) {
+    uint8_t* p = out;
+    *p++ = SYNC0;
+    *p++ = SYNC1;
+    *p++ = n;
+    put32(p, first);
+    p += 4;
+    for (uint8_t i = 0; i < n; i++) {
+        const TraceRecord& r = records[i];
+        put32(p, r.us);
+        p[4] = r.event;
+        p[5] = r.sensor;
+        p[6] = (uint8_t)r.arg;
+        p[7] = (uint8_t)(r.arg >> 8);
+        p += 8;
+    }
+    uint8_t check = 0;
+    for (const uint8_t* q = out; q < p; q++) check ^= *q;
+    *p++ = check;
+    return (size_t)(p - out);
+}
+
+bool traceBegin() {
+    return xTaskCreatePinnedToCore(traceTask, "trace", TASK_STACK_BYTES, nullptr,
+                                   TRACE_TASK_PRIORITY, nullptr, TRACE_TASK_CORE) == pdPASS;
+}
+
+void traceSetStreaming(bool on) {
+    if (on && !streaming.load(std::memory_order_relaxed)) replayRing.store(true);
+    streaming.store(on, std::memory_order_relaxed);
+}
+
+bool traceStreaming() {
+    return streaming.load(std::memory_order_relaxed);
+}
+
+TraceStats traceStats() {
+    TraceStats s;
+    s.written = trace_detail::head.load(std::memory_order_relaxed);
+    s.sent = sent;
+    s.lapped = lapped;
+    s.frames = frames;
+    s.streaming = traceStreaming();
+    return s;
+}
+
+void tracePrintStats() {
+    const TraceStats s = traceStats();
+    Serial.printf("trace written=%lu sent=%lu lapped=%lu frames=%lu ring=%u streaming=%s\n",
+                  (unsigned long)s.written, (unsigned long)s.sent, (unsigned long)s.lapped,
+                  (unsigned long)s.frames, TRACE_RING_SIZE, s.streaming ? "on" : "off");
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <atomic>
+
+// Binary event trace for the poll path, cheap enough to leave on. Each event
+// is one fixed record (esp_timer microseconds, event, sensor, 16-bit arg)
+// claimed with a single atomic add on the ring head and written with plain
+// stores, so it is safe from loop() and the CAN tasks on either core at once
+// and never waits. Nothing is formatted on the device.
+//
+// A low priority task on core 0 drains the ring and, while streaming is on,
+// writes it to Serial as framed binary batches that sit between the console's
+// text lines; analysis/trace_decode.py finds the frames in a serial capture
+// and rebuilds the timeline (names, gaps, round trips). While streaming is off
+// the ring is a flight recorder: turning it on sends the last
+// TRACE_RING_SIZE events first.
+//
+// Each slot has a seqlock like the kinematics ring. A writer that laps the
+// drain costs the drain those events; they are counted, and the batch header
+// carries the index of its first record so the decoder sees the hole too.
+//
+// Frame on the wire, little endian:
+//   A5 5A | count u8 | first index u32 | count x 8 byte record | xor of all before
+// Record: us u32 | event u8 | sensor u8 | arg u16.
+
+constexpr uint16_t TRACE_RING_SIZE = 1024;   // power of two
+constexpr uint8_t TRACE_BATCH_MAX = 32;      // records per frame
+constexpr uint32_t TRACE_DRAIN_MS = 20;
+constexpr uint8_t TRACE_TASK_CORE = 0;
+constexpr UBaseType_t TRACE_TASK_PRIORITY = 1;  // below everything that does work
+constexpr uint8_t TRACE_NO_SENSOR = 0xFF;
+
+// Keep in step with analysis/trace_decode.py, which reads the names from here.
+enum TraceEvent : uint8_t {
+    TRACE_REQ = 1,         // lane request out; sensor = batch[0], arg = batch count
+    TRACE_RX,              // reply frame for the lane; arg = PCI nibble << 12 | CAN ID
+    TRACE_STRAY_RX,        // response ID frame no request matches; arg as RX
+    TRACE_DONE,            // sensor got its value; arg = round trip ms
+    TRACE_TIMEOUT,         // sensor gave up on; arg = ms waited
+    TRACE_VALUE,           // sensor = SignalId, arg = low 16 bits of the raw value
+    TRACE_WAITING,         // lane still out at a WAITING sample; arg = ms so far
+    TRACE_WINDOW_BUSY,     // window motion started (arg 1) or stopped (0) polling
+    TRACE_WINDOW_WAIT,     // polling paused while lanes are out; arg = lanes in flight
+    TRACE_FC,              // flow control queued from the RX task; arg = response ID,
+                           // bit 15 if it was an overflow
+    TRACE_EVENT_COUNT
+};
+
+struct TraceRecord {
+    uint32_t us;
+    uint8_t event;
+    uint8_t sensor;
+    uint16_t arg;
+};
+static_assert(sizeof(TraceRecord) == 8, "trace records go on the wire as they are");
+
+struct TraceStats {
+    uint32_t written;   // events ever recorded
+    uint32_t sent;      // records streamed
+    uint32_t lapped;    // overwritten before the drain got to them
+    uint32_t frames;
+    bool streaming;
+};
+
+namespace trace_detail {
+
+struct Slot {
+    std::atomic<uint32_t> seq;   // index + 1 once written, 0 while being written
+    std::atomic<uint32_t> us;
+    std::atomic<uint32_t> word;  // event << 24 | sensor << 16 | arg
+};
+
+extern Slot ring[TRACE_RING_SIZE];
+extern std::atomic<uint32_t> head;
+
+} // namespace trace_detail
+
+inline void traceEvent(TraceEvent event, uint8_t sensor, uint16_t arg) {
+    using namespace trace_detail;
+    const uint32_t us = (uint32_t)esp_timer_get_time();
+    const uint32_t h = head.fetch_add(1, std::memory_order_relaxed);
+    Slot& s = ring[h & (TRACE_RING_SIZE - 1)];
+    s.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    s.us.store(us, std::memory_order_relaxed);
+    s.word.store((uint32_t)event << 24 | (uint32_t)sensor << 16 | arg, std::memory_order_relaxed);
+    s.seq.store(h + 1, std::memory_order_release);
+}
+
+bool traceBegin();
+void traceSetStreaming(bool on);
+bool traceStreaming();
+
+// Drain side, exposed for the host check. Copies up to max records from the
+// drain cursor into out and returns how many; *first gets the index of
+// out[0]. Stops early at a record still being written.
+uint8_t traceTake(TraceRecord* out, uint8_t max, uint32_t* first);
+
+// Frames n records for the wire; returns the frame length.
+size_t traceFrame(const TraceRecord* records, uint8_t n, uint32_t first, uint8_t* out);
+constexpr size_t TRACE_FRAME_MAX = 2 + 1 + 4 + TRACE_BATCH_MAX * sizeof(TraceRecord) + 1;
+
+TraceStats traceStats();
+void tracePrintStats();
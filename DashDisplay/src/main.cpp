@@ -60,32 +60,20 @@ static const int LINK_RX = 19;
 static const int LINK_TX = 20;
 static const uint32_t LINK_BAUD = 230400;
 
-#pragma pack(push,1)
-struct PayloadF {
-  uint8_t seq;
-  float   rpm;
-  float   hv_current_A;
-  float   hv_voltage_V;
-  float   ect_C;
-  float   hv_intake_C;
-  float   tb1_C;
-  float   tb2_C;
-  float   tb3_C;
-  float   soc_pct;
-  float   mg1_temp_F;
-  float   mg1_rpm;
-  float   mg2_temp_F;
-  float   mg2_rpm;
-  int8_t  ebar;
-  uint8_t est;
-  uint8_t bfs;
-  uint8_t bfor;
-  uint8_t dim;
-  uint8_t off;
-};
-#pragma pack(pop)
-
-// ============ Framed parser (0xAA | LEN | payload | XOR) ============
+// Payload layout and value scales; values arrive as the ECU's integers.
+#include "dash_wire.h"
+using dash_wire::PayloadI;
+using dash_wire::BlocksPayload;
+
+// loop() stage timing from the cycle counter; 'p' on USB serial prints it.
+#include "loop_profile.h"
+enum : uint8_t { STAGE_UART = 0, STAGE_LVGL, STAGE_SUBS, STAGE_UI, STAGE_COUNT };
+static const char* const STAGE_NAMES[STAGE_COUNT] = { "uart", "lvgl", "subs", "ui" };
+static const uint32_t LOOP_BUDGET_US = 30000;  // one sensor frame interval
+static loop_profile::Profile loopProfile;
+
+// ============ Framed parser (START | LEN | payload | XOR) ============
+// 0xAA carries PayloadI every ~30 ms; 0xAB carries the HV block voltages.
 static inline uint8_t xor_checksum(const uint8_t* p, size_t n) {
   uint8_t x = 0; for (size_t i=0;i<n;++i) x ^= p[i]; return x;
 }
@@ -95,14 +83,16 @@ static RxState  rxState = RxState::WAIT_START;
 static uint8_t  rxLen   = 0;
 static uint8_t  rxBuf[128];
 static uint8_t  rxIdx   = 0;
-
-static const uint8_t START_BYTE = 0xAA;
-static const uint8_t EXPECTED_LEN = sizeof(PayloadF);
+static uint8_t  rxStart = 0;
 
 static volatile bool havePacket = false;
-static PayloadF lastPacket{};
+static PayloadI lastPacket{};
 static uint8_t  lastSeq = 0;
 static unsigned long lastRxMs = 0;
+
+static bool haveBlocks = false;
+static BlocksPayload lastBlocks{};
+static unsigned long lastBlocksMs = 0;
 static const uint16_t LINK_RX_BUFFER_SIZE = 2048;
 static const uint16_t UART_BYTES_PER_LOOP = 512;
 static const unsigned long DATA_STALE_MS = 1500;
@@ -114,7 +104,10 @@ static void pollUart() {
     uint8_t b = (uint8_t)LINK.read();
     switch (rxState) {
       case RxState::WAIT_START:
-        if (b == START_BYTE) rxState = RxState::WAIT_LEN;
+        if (b == dash_wire::START_SENSORS || b == dash_wire::START_BLOCKS) {
+          rxStart = b;
+          rxState = RxState::WAIT_LEN;
+        }
         break;
       case RxState::WAIT_LEN:
         rxLen = b;
@@ -127,11 +120,17 @@ static void pollUart() {
         break;
       case RxState::WAIT_CSUM: {
         uint8_t calc = xor_checksum(rxBuf, rxLen);
-        if (calc == b && rxLen == EXPECTED_LEN) {
-          memcpy(&lastPacket, rxBuf, EXPECTED_LEN);
+        if (calc != b) {
+          // dropped
+        } else if (rxStart == dash_wire::START_SENSORS && rxLen == sizeof(PayloadI)) {
+          memcpy(&lastPacket, rxBuf, sizeof(PayloadI));
           havePacket = true;
           lastSeq = lastPacket.seq;
           lastRxMs = millis();
+        } else if (rxStart == dash_wire::START_BLOCKS && rxLen == sizeof(BlocksPayload)) {
+          memcpy(&lastBlocks, rxBuf, sizeof(BlocksPayload));
+          haveBlocks = true;
+          lastBlocksMs = millis();
         }
         rxState = RxState::WAIT_START;
         break;
@@ -140,6 +139,67 @@ static void pollUart() {
   }
 }
 
+// ============ Uplink: subscriptions (0xA5 | LEN | msg | XOR) ============
+// Tells the CANAdapter which polled signals we draw and how often, so it
+// doesn't poll anything we don't show. Layout copied from
+// CANAdapter/src/subscriptions.h; the adapter drops us after 5 s of silence.
+#define SUB_MAX_ENTRIES        12   // per message
+#define SUB_SIG_HV_CURRENT     0
+#define SUB_SIG_HV_VOLTAGE     1
+#define SUB_SIG_ECT            2
+#define SUB_SIG_HV_TEMPS       3
+#define SUB_SIG_SOC            4
+#define SUB_SIG_HV_FAN_MODE    5
+#define SUB_SIG_MG1            6
+#define SUB_SIG_MG2            7
+#define SUB_SIG_HV_BLOCKS      8
+
+#pragma pack(push,1)
+struct SubEntryWire {
+  uint8_t  signal;
+  uint16_t periodMs;
+};
+struct SubscribeMsg {
+  uint8_t consumer;
+  uint8_t count;
+  SubEntryWire entries[SUB_MAX_ENTRIES];
+};
+#pragma pack(pop)
+
+static const uint8_t SUB_START_BYTE = 0xA5;
+static const uint8_t SUB_CONSUMER_DASH = 1;
+static const unsigned long SUB_RENEW_MS = 2000;
+
+static const SubEntryWire DASH_SUBSCRIPTIONS[] = {
+  {SUB_SIG_HV_CURRENT,    20},  // kW bar + amps label
+  {SUB_SIG_HV_VOLTAGE,    20},  // kW bar + volts label
+  {SUB_SIG_ECT,         1000},
+  {SUB_SIG_HV_TEMPS,     500},  // battery + intake temps
+  {SUB_SIG_SOC,          500},  // SoC panel
+  {SUB_SIG_HV_FAN_MODE, 1000},  // battery fan speed
+  {SUB_SIG_MG1,          500},  // MG1 temp/RPM
+  {SUB_SIG_MG2,          500},  // MG2 temp/RPM
+  {SUB_SIG_HV_BLOCKS,   2000}   // heat strip
+};
+static_assert(sizeof(DASH_SUBSCRIPTIONS) / sizeof(DASH_SUBSCRIPTIONS[0]) <= SUB_MAX_ENTRIES,
+              "one SubscribeMsg carries at most SUB_MAX_ENTRIES");
+
+static void sendSubscriptions() {
+  SubscribeMsg msg{};
+  msg.consumer = SUB_CONSUMER_DASH;
+  msg.count = sizeof(DASH_SUBSCRIPTIONS) / sizeof(DASH_SUBSCRIPTIONS[0]);
+  memcpy(msg.entries, DASH_SUBSCRIPTIONS, sizeof(DASH_SUBSCRIPTIONS));
+
+  const uint8_t n = 2 + msg.count * sizeof(SubEntryWire);
+  if (LINK.availableForWrite() < n + 3) return;  // try again next round
+  uint8_t frame[2 + sizeof(SubscribeMsg) + 1];
+  frame[0] = SUB_START_BYTE;
+  frame[1] = n;
+  memcpy(&frame[2], &msg, n);
+  frame[2 + n] = xor_checksum(&frame[2], n);
+  LINK.write(frame, n + 3);
+}
+
 // ──────────────────────────────────────────────────────────────
 // Drive strength on RGB/sync/PCLK pins
 // ──────────────────────────────────────────────────────────────
@@ -290,7 +350,9 @@ static void IRAM_ATTR onLvglTick() { lv_tick_inc(5); }
 // ──────────────────────────────────────────────────────────────
 // Helpers
 // ──────────────────────────────────────────────────────────────
-inline float c_to_f(float c) { return (c * 9.0f / 5.0f) + 32.0f; }
+// Same raw integers as the wire types, shown in F (F = C * 9/5 + 32).
+using CoolantF = FixedScale<int16_t, 9, 5, 32>;
+using HvTempF  = FixedScale<uint16_t, 853 * 9, 218450 * 5, -58>;
 
 // Change guards
 template<typename T>
@@ -319,7 +381,7 @@ static inline void label_set_centi(lv_obj_t* lbl, int centi, const char* suffix)
 #define ENGINE_INDICATOR_COLOR  RGB(255,100,0)
 
 // LED strip logic (no .show() inside; uses led_mark_dirty())
-void updateShiftStrip(int8_t ebar_raw, float rpm) {
+void updateShiftStrip(int8_t ebar_raw, int rpm) {
   static bool     wasInWarn = false;
   static uint8_t  blinksRemaining = 0;
   static bool     blinkOn = true;
@@ -432,6 +494,8 @@ void backlightInit() {
 // ──────────────────────────────────────────────────────────────
 // SETUP / LOOP
 // ──────────────────────────────────────────────────────────────
+static void create_block_strip();  // HV block heat strip, with the UI updates below
+
 void setup() {
   Serial.begin(115200);
 
@@ -474,11 +538,14 @@ void setup() {
   timerAlarmEnable(lv_tick_timer);
 
   ui_init();
+  create_block_strip();
 
   shiftStrip.begin();
   shiftStrip.setBrightness(255);
   shiftStrip.clear();
   shiftStrip.show();
+
+  loop_profile::init(loopProfile, getCpuFrequencyMhz(), STAGE_NAMES, STAGE_COUNT, LOOP_BUDGET_US);
 }
 
 // define colors ahead of time
@@ -538,6 +605,133 @@ static uint8_t      prev_off = INT_MIN;
 static const int KW_BAR_MAX_W = 20000;
 static const int MG_BAR_MAX_RPM = 10000;
 
+// ===== Per-widget freshness =====
+// Each widget fades by the worst freshness of the values it is drawn from, so
+// one dead poll greys its own number instead of freezing it. Late is still
+// full strength; the adapter already retries those first.
+#define FIELD_BIT(f) (1u << dash_wire::f)
+struct FreshWidget {
+  lv_obj_t** obj;
+  uint16_t fields;   // FIELD_BITs it shows
+  bool bar;          // fade the indicator rather than the text
+  uint8_t shown;     // Freshness last applied, 255 = not yet
+};
+
+static FreshWidget freshWidgets[] = {
+  {&objects.rpm_label,           FIELD_BIT(FIELD_RPM),                                        false, 255},
+  {&objects.rpm_bar,             FIELD_BIT(FIELD_RPM),                                        true,  255},
+  {&objects.kw_label,            FIELD_BIT(FIELD_HV_CURRENT) | FIELD_BIT(FIELD_HV_VOLTAGE),   false, 255},
+  {&objects.kw_watts_bar,        FIELD_BIT(FIELD_HV_CURRENT) | FIELD_BIT(FIELD_HV_VOLTAGE),   true,  255},
+  {&objects.mg1_rpm,             FIELD_BIT(FIELD_MG1_RPM),                                    false, 255},
+  {&objects.mg1_bar,             FIELD_BIT(FIELD_MG1_RPM),                                    true,  255},
+  {&objects.mg1_temp,            FIELD_BIT(FIELD_MG1_TEMP),                                   false, 255},
+  {&objects.mg2_rpm,             FIELD_BIT(FIELD_MG2_RPM),                                    false, 255},
+  {&objects.mg2_bar,             FIELD_BIT(FIELD_MG2_RPM),                                    true,  255},
+  {&objects.mg2_temp,            FIELD_BIT(FIELD_MG2_TEMP),                                   false, 255},
+  {&objects.battery_soc,         FIELD_BIT(FIELD_SOC),                                        false, 255},
+  {&objects.battery_temp,        FIELD_BIT(FIELD_TB1) | FIELD_BIT(FIELD_TB2) | FIELD_BIT(FIELD_TB3), false, 255},
+  {&objects.battery_intake_temp, FIELD_BIT(FIELD_HV_INTAKE),                                  false, 255},
+  {&objects.battery_fan_speed,   FIELD_BIT(FIELD_FAN),                                        false, 255},
+  {&objects.coolant_temp,        FIELD_BIT(FIELD_ECT),                                        false, 255},
+  {&objects.battery_voltage,     FIELD_BIT(FIELD_HV_VOLTAGE),                                 false, 255},
+  {&objects.battery_amperage,    FIELD_BIT(FIELD_HV_CURRENT),                                 false, 255},
+  {&objects.ebar_label,          FIELD_BIT(FIELD_EBAR),                                       false, 255},
+  {&objects.ebar_bar,            FIELD_BIT(FIELD_EBAR),                                       true,  255},
+};
+
+static void update_widget_freshness(uint32_t bits) {
+  for (FreshWidget& w : freshWidgets) {
+    uint8_t worst = dash_wire::FRESH;
+    for (uint8_t f = 0; f < dash_wire::FIELD_COUNT; f++) {
+      if (!(w.fields & (1u << f))) continue;
+      const uint8_t fr = dash_wire::freshness(bits, (dash_wire::Field)f);
+      if (fr > worst) worst = fr;
+    }
+    if (!changed(w.shown, worst)) continue;
+
+    const lv_style_prop_t prop = w.bar ? LV_STYLE_BG_OPA : LV_STYLE_TEXT_OPA;
+    const lv_style_selector_t part = w.bar ? LV_PART_INDICATOR : LV_PART_MAIN;
+    if (worst <= dash_wire::LATE) {
+      lv_obj_remove_local_style_prop(*w.obj, prop, part);  // back to the theme's look
+    } else {
+      const lv_opa_t opa = (worst == dash_wire::STALE) ? LV_OPA_40 : LV_OPA_20;
+      if (w.bar) lv_obj_set_style_bg_opa(*w.obj, opa, part);
+      else       lv_obj_set_style_text_opa(*w.obj, opa, part);
+    }
+  }
+}
+
+// ===== HV block heat strip =====
+// One cell per 0x2181 block along the bottom of the battery panel, coloured
+// by how far the block sits from the pack mean: green within BLOCK_NEAR_MV,
+// shading to red above and blue below, full colour at BLOCK_FULL_MV. A weak
+// block shows up as one cell drifting under load. Built here rather than in
+// the generated screens.c, which only knows fixed widgets.
+static const int BLOCK_NEAR_MV = 20;
+static const int BLOCK_FULL_MV = 100;
+static const int BLOCK_CELL_W = 12;
+static const int BLOCK_CELL_GAP = 1;
+static const int BLOCK_CELL_H = 8;
+static const unsigned long BLOCKS_STALE_MS = 3000;  // the adapter resends every second
+
+static lv_obj_t* blockStrip = nullptr;
+static lv_obj_t* blockCells[dash_wire::HV_BLOCK_COUNT];
+static int16_t   prev_block_shade[dash_wire::HV_BLOCK_COUNT];
+static uint8_t   prev_blocks_fresh = 255;
+
+static void create_block_strip() {
+  const int w = dash_wire::HV_BLOCK_COUNT * (BLOCK_CELL_W + BLOCK_CELL_GAP) - BLOCK_CELL_GAP;
+  blockStrip = lv_obj_create(objects.battery_info_panel);
+  lv_obj_remove_style_all(blockStrip);
+  lv_obj_set_size(blockStrip, w, BLOCK_CELL_H);
+  lv_obj_align(blockStrip, LV_ALIGN_BOTTOM_MID, 0, 14);  // into the panel's bottom padding
+  lv_obj_clear_flag(blockStrip, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+  for (uint8_t i = 0; i < dash_wire::HV_BLOCK_COUNT; i++) {
+    lv_obj_t* cell = lv_obj_create(blockStrip);
+    lv_obj_remove_style_all(cell);
+    lv_obj_set_size(cell, BLOCK_CELL_W, BLOCK_CELL_H);
+    lv_obj_set_pos(cell, i * (BLOCK_CELL_W + BLOCK_CELL_GAP), 0);
+    lv_obj_set_style_bg_color(cell, lv_color_hex(0x2f3237), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(cell, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_set_style_border_color(cell, lv_color_hex(0x000000), LV_PART_MAIN);
+    lv_obj_set_style_border_width(cell, 1, LV_PART_MAIN);
+    lv_obj_clear_flag(cell, LV_OBJ_FLAG_CLICKABLE);
+    blockCells[i] = cell;
+    prev_block_shade[i] = INT16_MIN;
+  }
+}
+
+static void update_block_strip(unsigned long now) {
+  uint8_t fr = haveBlocks ? lastBlocks.freshness : (uint8_t)dash_wire::NO_DATA;
+  if (haveBlocks && now - lastBlocksMs >= BLOCKS_STALE_MS) fr = dash_wire::STALE;
+  if (changed(prev_blocks_fresh, fr)) {
+    if (fr <= dash_wire::LATE) lv_obj_remove_local_style_prop(blockStrip, LV_STYLE_OPA, LV_PART_MAIN);
+    else lv_obj_set_style_opa(blockStrip, fr == dash_wire::STALE ? LV_OPA_40 : LV_OPA_20, LV_PART_MAIN);
+  }
+  if (!haveBlocks) return;
+
+  int32_t mv[dash_wire::HV_BLOCK_COUNT];
+  int32_t sum = 0;
+  for (uint8_t i = 0; i < dash_wire::HV_BLOCK_COUNT; i++) {
+    mv[i] = dash_wire::HvBlock::to<1000>(dash_wire::blockRaw(lastBlocks, i));
+    sum += mv[i];
+  }
+  const int32_t mean = fixedDivRound32(sum, dash_wire::HV_BLOCK_COUNT);
+
+  for (uint8_t i = 0; i < dash_wire::HV_BLOCK_COUNT; i++) {
+    // shade: 0 = green, +255 = full red, -255 = full blue
+    const int dev = constrain((int)(mv[i] - mean), -BLOCK_FULL_MV, BLOCK_FULL_MV);
+    int16_t shade = 0;
+    if (dev > BLOCK_NEAR_MV)  shade = (int16_t)((dev - BLOCK_NEAR_MV) * 255 / (BLOCK_FULL_MV - BLOCK_NEAR_MV));
+    if (dev < -BLOCK_NEAR_MV) shade = (int16_t)((dev + BLOCK_NEAR_MV) * 255 / (BLOCK_FULL_MV - BLOCK_NEAR_MV));
+    if (!changed(prev_block_shade[i], shade)) continue;
+    const lv_color_t c = shade >= 0 ? lv_color_mix(g_red, g_green, (uint8_t)shade)
+                                    : lv_color_mix(g_blue, g_green, (uint8_t)-shade);
+    lv_obj_set_style_bg_color(blockCells[i], c, LV_PART_MAIN);
+  }
+}
+
 static void update_signed_range_bar(lv_obj_t* bar, int value, int max_abs_value,
                                     int& prev_start, int& prev_value, uint8_t& prev_sign) {
   value = constrain(value, -max_abs_value, max_abs_value);
@@ -564,9 +758,23 @@ static void update_signed_range_bar(lv_obj_t* bar, int value, int max_abs_value,
 }
 
 void loop() {
+  loop_profile::beginPass(loopProfile);
   pollUart();
+  loop_profile::endStage(loopProfile, STAGE_UART);
   lv_timer_handler();
+  loop_profile::endStage(loopProfile, STAGE_LVGL);
   pollUart();
+  loop_profile::endStage(loopProfile, STAGE_UART);
+
+  static unsigned long lastSub = 0;
+  if (lastSub == 0 || millis() - lastSub >= SUB_RENEW_MS) {
+    sendSubscriptions();
+    lastSub = millis();
+  }
+  while (Serial.available()) {
+    if (Serial.read() == 'p') loop_profile::print(loopProfile, Serial);
+  }
+  loop_profile::endStage(loopProfile, STAGE_SUBS);
 
   // UI update cadence (every ~50 ms)
   static unsigned long lastUi = 0;
@@ -579,7 +787,7 @@ void loop() {
       lv_obj_add_flag(objects.no_data_label, LV_OBJ_FLAG_HIDDEN);
 
       // ===== RPM =====
-      int rpm_val = (int)lrintf(lastPacket.rpm);
+      int rpm_val = dash_wire::Rpm::to(lastPacket.rpm);
       int rpm_bar_val = constrain(rpm_val, 0, 5500);
       if (changed(prev_rpm_bar, rpm_bar_val)) {
         lv_bar_set_value(objects.rpm_bar, rpm_bar_val, LV_ANIM_OFF);
@@ -589,19 +797,21 @@ void loop() {
       }
 
       // ===== Watts bar & label =====
-      int watts = (int)lrintf(lastPacket.hv_voltage_V * lastPacket.hv_current_A);
+      // raw V is half-volts, raw A centiamps: W = rawV * rawA / 200
+      const int32_t va_raw = (int32_t)lastPacket.hv_voltage * lastPacket.hv_current;
+      int watts = (int)fixedDivRound(va_raw, 200);
       int watts_bar = constrain(watts, -KW_BAR_MAX_W, KW_BAR_MAX_W);
       if (changed(prev_watts_bar, watts_bar)) {
         update_signed_range_bar(objects.kw_watts_bar, watts_bar, KW_BAR_MAX_W, prev_kw_start, prev_kw_value, prev_kw_sign);
       }
       if (changed(prev_watts, watts)) {
-        int kw_centi = (int)lrintf(watts / 10.0f);
+        int kw_centi = (int)fixedDivRound(va_raw, 2000);
         label_set_centi(objects.kw_label, kw_centi, "\nkW");
       }
 
       // ===== MG1 / MG2 RPM bars and labels =====
-      int mg1_rpm = (int)lrintf(lastPacket.mg1_rpm);
-      int mg2_rpm = (int)lrintf(lastPacket.mg2_rpm);
+      int mg1_rpm = dash_wire::MgRpm::to(lastPacket.mg1_rpm);
+      int mg2_rpm = dash_wire::MgRpm::to(lastPacket.mg2_rpm);
       update_signed_range_bar(objects.mg1_bar, mg1_rpm, MG_BAR_MAX_RPM, prev_mg1_start, prev_mg1_value, prev_mg1_sign);
       update_signed_range_bar(objects.mg2_bar, mg2_rpm, MG_BAR_MAX_RPM, prev_mg2_start, prev_mg2_value, prev_mg2_sign);
 
@@ -612,8 +822,8 @@ void loop() {
         lv_label_set_text_fmt(objects.mg2_rpm, "%d", mg2_rpm);
       }
 
-      int mg1_temp = (int)lrintf(lastPacket.mg1_temp_F);
-      int mg2_temp = (int)lrintf(lastPacket.mg2_temp_F);
+      int mg1_temp = dash_wire::MgTemp::to(lastPacket.mg1_temp);
+      int mg2_temp = dash_wire::MgTemp::to(lastPacket.mg2_temp);
       if (changed(prev_mg1_temp, mg1_temp)) {
         lv_label_set_text_fmt(objects.mg1_temp, "%d°", mg1_temp);
       }
@@ -622,7 +832,7 @@ void loop() {
       }
 
       // ===== Battery SoC panel =====
-      int soc_centi = (int)lrintf(lastPacket.soc_pct * 100.0f);
+      int soc_centi = dash_wire::Soc::to<100>(lastPacket.soc);
       if (changed(prev_soc_centi, soc_centi)) {
         label_set_centi(objects.battery_soc, soc_centi, "%\nSoC");
       }
@@ -637,8 +847,8 @@ void loop() {
       }
 
       // ===== Battery temp (avg) integer label + banded color =====
-      float battery_temp_avg = (lastPacket.tb1_C + lastPacket.tb2_C + lastPacket.tb3_C) / 3.0f;
-      int btF_round = (int)lrintf(c_to_f(battery_temp_avg));
+      uint16_t battery_temp_avg = (uint16_t)fixedDivRound32((int32_t)lastPacket.tb1 + lastPacket.tb2 + lastPacket.tb3, 3);
+      int btF_round = HvTempF::to(battery_temp_avg);
       if (changed(prev_btF, btF_round)) {
         lv_label_set_text_fmt(objects.battery_temp, "%d°", btF_round);
       }
@@ -654,7 +864,7 @@ void loop() {
       }
 
       // ===== Intake temp integer label + banded color =====
-      int intakeF_round = (int)lrintf(c_to_f(lastPacket.hv_intake_C));
+      int intakeF_round = HvTempF::to(lastPacket.hv_intake);
       static int prev_intake_label = INT_MIN;
       if (changed(prev_intake_label, intakeF_round)) {
         lv_label_set_text_fmt(objects.battery_intake_temp, "%d°\nIntake", intakeF_round);
@@ -671,7 +881,7 @@ void loop() {
       }
 
       // ===== Battery fan info =====
-      int bfs = (int)lrintf(lastPacket.bfs);
+      int bfs = dash_wire::FanMode::to(lastPacket.bfs);
       if (changed(prev_bfs, bfs)) {
         lv_label_set_text_fmt(objects.battery_fan_speed, "S: %d", bfs);
       }
@@ -689,21 +899,27 @@ void loop() {
       }
 
       // ===== Engine coolant temp =====
-      int ectF_round = (int)lrint(c_to_f(lastPacket.ect_C));
+      int ectF_round = CoolantF::to(lastPacket.ect);
       if (changed(prev_ectF, ectF_round)) {
         lv_label_set_text_fmt(objects.coolant_temp, "Coolant: %d°", ectF_round);
       }
 
       // ===== Battery V/A labels (two decimals, no %f) =====
-      int battery_voltage_centi = (int)lrintf(lastPacket.hv_voltage_V * 100.0f);
-      int battery_amperage_centi = (int)lrintf(lastPacket.hv_current_A * 100.0f);
+      int battery_voltage_centi = dash_wire::HvVoltage::to<100>(lastPacket.hv_voltage);
+      int battery_amperage_centi = dash_wire::HvCurrent::to<100>(lastPacket.hv_current);
       if (changed(prev_batt_v_centi, battery_voltage_centi)) label_set_centi(objects.battery_voltage, battery_voltage_centi, "V");
       if (changed(prev_batt_a_centi, battery_amperage_centi)) label_set_centi(objects.battery_amperage, battery_amperage_centi, "A");
 
       // ===== Shift LED strip =====
-      updateShiftStrip(lastPacket.ebar, (float)rpm_val);
+      updateShiftStrip(lastPacket.ebar, rpm_val);
       led_maybe_show();  // single WS2812 transfer per frame
 
+      // ===== Per-value freshness from the adapter =====
+      update_widget_freshness(lastPacket.freshness);
+
+      // ===== HV block heat strip =====
+      update_block_strip(now);
+
       // ===== Dimming and screen off on change =====
       uint8_t dim_now = lastPacket.dim ? 1 : 0;
       uint8_t off_now = lastPacket.off ? 1 : 0;
@@ -744,7 +960,7 @@ void loop() {
       
 
       // ===== Ebar & drain labels (on change) =====
-      int ebar_round = (int)lrintf(lastPacket.ebar);
+      int ebar_round = lastPacket.ebar;
       if (changed(prev_ebar, ebar_round)) {
         lv_label_set_text_fmt(objects.ebar_label, "%d", ebar_round);
         // update ebar bar
@@ -761,4 +977,5 @@ void loop() {
       lv_obj_clear_flag(objects.no_data_label, LV_OBJ_FLAG_HIDDEN);
     }
   }
+  loop_profile::endStage(loopProfile, STAGE_UI);
 }
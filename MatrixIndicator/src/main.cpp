@@ -59,9 +59,50 @@ void showGas() {
 volatile uint8_t last_flags = 0;
 volatile unsigned long last_rx = 0;
 
+// subscription uplink ---------------------------------------------------------------------------------------
+// We only use the flags byte, which the adapter builds from passive frames.
+// Subscribing tells it so; layout copied from CANAdapter/src/subscriptions.h.
+#define SUB_MAX_ENTRIES     12
+#pragma pack(push,1)
+struct SubEntryWire {
+  uint8_t  signal;
+  uint16_t periodMs;
+};
+struct SubscribeMsg {
+  uint8_t consumer;
+  uint8_t count;
+  SubEntryWire entries[SUB_MAX_ENTRIES];
+};
+#pragma pack(pop)
+
+#define SUB_CONSUMER_MATRIX 2
+#define SUB_SIG_FLAGS       0x40
+#define SUB_RENEW_MS        2000
+uint8_t adapter_mac[6];
+volatile bool have_adapter = false;  // learned from the first flags packet
+
+void sendSubscription() {
+  if (!have_adapter) return;
+  if (!esp_now_is_peer_exist(adapter_mac)) {
+    esp_now_peer_info_t peer = {};
+    memcpy(peer.peer_addr, adapter_mac, 6);
+    peer.channel = 0;
+    peer.encrypt = false;
+    esp_now_add_peer(&peer);
+  }
+  SubscribeMsg msg = {};
+  msg.consumer = SUB_CONSUMER_MATRIX;
+  msg.count = 1;
+  msg.entries[0] = {SUB_SIG_FLAGS, 500};
+  esp_now_send(adapter_mac, (const uint8_t*)&msg, 2 + msg.count * sizeof(SubEntryWire));
+}
 
-void onDataRecv(const uint8_t*, const uint8_t* data, int len) {
+void onDataRecv(const uint8_t* mac, const uint8_t* data, int len) {
   if (len < 1) return;
+  if (!have_adapter) {
+    memcpy(adapter_mac, mac, 6);
+    have_adapter = true;
+  }
   last_flags = data[0];
   last_rx = millis();
 
@@ -166,6 +207,12 @@ void setup() {
 
 
 void loop() {
+  static unsigned long last_sub = 0;
+  if (have_adapter && (last_sub == 0 || millis() - last_sub >= SUB_RENEW_MS)) {
+    sendSubscription();
+    last_sub = millis();
+  }
+
   // show ev without m
   // showEv();
   // delay(3000);
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""Decode the CANAdapter's binary poll trace (CANAdapter/src/trace.h) from a raw serial capture.
+
+Capture with streaming on ('x' on the console), e.g. ``cat /dev/ttyUSB0 > trace.bin``.
+Console text in between the frames is skipped. Event, sensor and signal names
+are read from the firmware sources so they can't drift from the build.
+"""
+
+from __future__ import annotations
+
+import argparse
+import re
+import statistics
+import struct
+from collections import defaultdict
+from dataclasses import dataclass
+from pathlib import Path
+
+
+SYNC = b"\xA5\x5A"
+HEADER = struct.Struct("<BI")  # count, index of the first record
+RECORD = struct.Struct("<IBBH")  # us, event, sensor, arg
+NO_SENSOR = 0xFF
+
+EVENT_RE = re.compile(r"^\s*TRACE_([A-Z_]+)(?:\s*=\s*(\d+))?,")
+SENSOR_RE = re.compile(r"^\s*SENSOR_([A-Z0-9_]+)\s*=\s*(\d+),")
+SENSOR_NAME_RE = re.compile(r'case SENSOR_([A-Z0-9_]+): return "([^"]+)";')
+SIGNAL_RE = re.compile(r'^\s*\{"([a-z0-9_]+)",\s*SIGNAL_')
+
+PCI = {0x0: "SF", 0x1: "FF", 0x2: "CF", 0x3: "FC"}
+
+
+@dataclass
+class Event:
+    index: int
+    us: int  # unwrapped
+    event: int
+    sensor: int
+    arg: int
+
+
+class Names:
+    def __init__(self, src: Path) -> None:
+        self.events: dict[int, str] = {}
+        value = 0
+        for line in (src / "trace.h").read_text().splitlines():
+            m = EVENT_RE.match(line)
+            if not m or m.group(1) in ("EVENT_COUNT", "NO_SENSOR"):
+                continue
+            value = int(m.group(2)) if m.group(2) else value + 1
+            self.events[value] = m.group(1)
+
+        main = (src / "main.cpp").read_text()
+        ids = {m.group(1): int(m.group(2)) for m in map(SENSOR_RE.match, main.splitlines()) if m}
+        self.sensors = {ids[m.group(1)]: m.group(2) for m in SENSOR_NAME_RE.finditer(main) if m.group(1) in ids}
+
+        table = (src / "signal_store.cpp").read_text().split("INFO[SIG_COUNT]", 1)[-1]
+        self.signals = [m.group(1) for m in map(SIGNAL_RE.match, table.splitlines()) if m]
+
+    def event(self, e: int) -> str:
+        return self.events.get(e, f"EVENT_{e}")
+
+    def sensor(self, s: int) -> str:
+        return "-" if s == NO_SENSOR else self.sensors.get(s, f"sensor_{s}")
+
+    def signal(self, s: int) -> str:
+        return self.signals[s] if s < len(self.signals) else f"signal_{s}"
+
+
+def read_frames(data: bytes) -> tuple[list[tuple[int, list[tuple]]], int]:
+    """Every well formed frame in the capture, and how many candidates failed the check."""
+    frames = []
+    bad = 0
+    pos = 0
+    while True:
+        pos = data.find(SYNC, pos)
+        if pos < 0 or pos + 2 + HEADER.size > len(data):
+            break
+        count, first = HEADER.unpack_from(data, pos + 2)
+        end = pos + 2 + HEADER.size + count * RECORD.size
+        if count == 0 or end >= len(data):
+            pos += 1
+            continue
+        check = 0
+        for b in data[pos:end]:
+            check ^= b
+        if check != data[end]:
+            bad += 1
+            pos += 1
+            continue
+        body = pos + 2 + HEADER.size
+        frames.append((first, [RECORD.unpack_from(data, body + i * RECORD.size) for i in range(count)]))
+        pos = end + 1
+    return frames, bad
+
+
+def timeline(frames: list[tuple[int, list[tuple]]]) -> tuple[list[Event], list[tuple[int, int]]]:
+    """Events in record order with the 32-bit clock unwrapped, plus holes as (index after, count)."""
+    events: list[Event] = []
+    holes: list[tuple[int, int]] = []
+    expected = None
+    last_raw = None
+    wraps = 0
+    for first, records in frames:
+        if expected is not None and first < expected:
+            # The stream was restarted and replayed the ring: start over.
+            events.clear()
+            holes.clear()
+            last_raw = None
+            wraps = 0
+        elif expected is not None and first > expected:
+            holes.append((first, first - expected))
+        for i, (us, event, sensor, arg) in enumerate(records):
+            if last_raw is not None and us < last_raw and last_raw - us > 1 << 31:
+                wraps += 1
+            last_raw = us
+            events.append(Event(first + i, us + (wraps << 32), event, sensor, arg))
+        expected = first + len(records)
+    return events, holes
+
+
+def describe(e: Event, names: Names) -> str:
+    kind = names.event(e.event)
+    if kind in ("RX", "STRAY_RX"):
+        return f"{names.sensor(e.sensor)} id=0x{e.arg & 0x7FF:03X} {PCI.get(e.arg >> 12, '?')}"
+    if kind in ("DONE", "TIMEOUT", "WAITING"):
+        return f"{names.sensor(e.sensor)} {e.arg} ms"
+    if kind == "REQ":
+        return f"{names.sensor(e.sensor)} batch={e.arg}"
+    if kind == "VALUE":
+        raw = e.arg - 0x10000 if e.arg & 0x8000 else e.arg
+        return f"{names.signal(e.sensor)} raw={raw} (0x{e.arg:04X})"
+    if kind == "WINDOW_BUSY":
+        return "on" if e.arg else "off"
+    if kind == "WINDOW_WAIT":
+        return f"in_flight={e.arg}"
+    if kind == "FC":
+        return f"id=0x{e.arg & 0x7FF:03X}" + (" overflow" if e.arg & 0x8000 else "")
+    return f"{names.sensor(e.sensor)} arg={e.arg}"
+
+
+def print_timeline(events: list[Event], holes: list[tuple[int, int]], names: Names, gap_ms: float) -> None:
+    hole_at = dict(holes)
+    t0 = events[0].us
+    prev = None
+    last_rx = None
+    for e in events:
+        if e.index in hole_at:
+            print(f"{'':>12}  ... {hole_at[e.index]} events lost")
+        kind = names.event(e.event)
+        dt = 0 if prev is None else e.us - prev
+        if prev is not None and dt >= gap_ms * 1000:
+            since_rx = "" if last_rx is None else f" since_last_rx={(e.us - last_rx) / 1000:.1f} ms"
+            print(f"{'':>12}  --- gap {dt / 1000:.1f} ms{since_rx}")
+        print(f"{(e.us - t0) / 1000:12.3f}  +{dt / 1000:8.3f}  {kind:<12} {describe(e, names)}")
+        if kind in ("RX", "STRAY_RX"):
+            last_rx = e.us
+        prev = e.us
+
+
+def print_summary(events: list[Event], holes: list[tuple[int, int]], names: Names, bad: int) -> None:
+    span = (events[-1].us - events[0].us) / 1e6
+    lost = sum(n for _, n in holes)
+    print(f"{len(events)} events over {span:.1f} s, {lost} lost in {len(holes)} holes, {bad} bad frames")
+    counts: dict[int, dict[str, int]] = defaultdict(lambda: defaultdict(int))
+    trips: dict[int, list[int]] = defaultdict(list)
+    for e in events:
+        kind = names.event(e.event)
+        if kind in ("REQ", "DONE", "TIMEOUT", "RX", "STRAY_RX"):
+            counts[e.sensor][kind] += 1
+        if kind == "DONE":
+            trips[e.sensor].append(e.arg)
+    print(f"{'sensor':<12} {'req':>6} {'done':>6} {'tmo':>5} {'rx':>6} {'stray':>5} {'p50_ms':>6} {'max_ms':>6}")
+    for sensor in sorted(counts):
+        c = counts[sensor]
+        t = trips[sensor]
+        p50 = f"{statistics.median(t):.0f}" if t else ""
+        worst = f"{max(t)}" if t else ""
+        print(
+            f"{names.sensor(sensor):<12} {c['REQ']:>6} {c['DONE']:>6} {c['TIMEOUT']:>5} {c['RX']:>6} "
+            f"{c['STRAY_RX']:>5} {p50:>6} {worst:>6}"
+        )
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser()
+    parser.add_argument("capture", type=Path)
+    parser.add_argument("--src", type=Path, default=Path(__file__).resolve().parent.parent / "CANAdapter" / "src")
+    parser.add_argument("--gap-ms", type=float, default=100.0, help="mark quiet stretches at least this long")
+    parser.add_argument("--summary", action="store_true", help="per sensor counts and round trips only")
+    args = parser.parse_args()
+
+    names = Names(args.src)
+    frames, bad = read_frames(args.capture.read_bytes())
+    events, holes = timeline(frames)
+    if not events:
+        raise SystemExit(f"{args.capture}: no trace frames ({bad} bad)")
+    if not args.summary:
+        print_timeline(events, holes, names, args.gap_ms)
+        print()
+    print_summary(events, holes, names, bad)
+
+
+if __name__ == "__main__":
+    main()